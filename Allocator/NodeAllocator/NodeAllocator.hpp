@@ -0,0 +1,409 @@
+#ifndef NODE_ALLOCATOR_HPP
+#define NODE_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// 链式结构的节点分配策略，LinkedQueue 和 SingleLinkedList 共用
+// 所有策略都提供同样的接口：
+//   NodeT* create(Args&&... args)  分配并构造一个节点
+//   void destroy(NodeT* p)         析构并回收一个节点
+// 容器持有策略对象，节点只能由创建它的那个策略对象回收。
+// 策略的额外能力通过 NodeAllocatorTraits 描述。
+
+// 空闲槽位：节点被回收后，其内存被复用为空闲链表的指针
+struct FreeSlot {
+    FreeSlot* next;
+};
+
+// 默认策略：每个节点单独 new/delete
+template<typename NodeT>
+class NewDeleteAllocator {
+public:
+    template<typename... Args>
+    NodeT* create(Args&&... args) {
+        return new NodeT(std::forward<Args>(args)...);
+    }
+
+    void destroy(NodeT* p) {
+        delete p;
+    }
+};
+
+// 空闲链表策略：回收的节点内存挂到空闲链表上，下次分配优先复用
+template<typename NodeT>
+class FreeListAllocator {
+private:
+    static_assert(sizeof(NodeT) >= sizeof(FreeSlot), "Node too small to hold a free-list link");
+
+    FreeSlot* freeList;
+    size_t cached;      // 空闲链表中的节点数
+    size_t maxCached;   // 空闲链表的上限，超出的节点直接释放
+
+public:
+    explicit FreeListAllocator(size_t limit = static_cast<size_t>(-1))
+        : freeList(nullptr), cached(0), maxCached(limit) {}
+
+    ~FreeListAllocator() {
+        while (freeList != nullptr) {
+            FreeSlot* next = freeList->next;
+            ::operator delete(freeList);
+            freeList = next;
+        }
+    }
+
+    FreeListAllocator(const FreeListAllocator&) = delete;
+    FreeListAllocator& operator=(const FreeListAllocator&) = delete;
+
+    template<typename... Args>
+    NodeT* create(Args&&... args) {
+        void* mem;
+        if (freeList != nullptr) {
+            mem = freeList;
+            freeList = freeList->next;
+            --cached;
+        } else {
+            mem = ::operator new(sizeof(NodeT));
+        }
+        try {
+            return new (mem) NodeT(std::forward<Args>(args)...);
+        } catch (...) {
+            release(mem);
+            throw;
+        }
+    }
+
+    void destroy(NodeT* p) {
+        p->~NodeT();
+        release(p);
+    }
+
+    // 空闲链表中缓存的节点数
+    size_t cachedCount() const {
+        return cached;
+    }
+
+private:
+    void release(void* mem) {
+        if (cached >= maxCached) {
+            ::operator delete(mem);
+            return;
+        }
+        FreeSlot* slot = static_cast<FreeSlot*>(mem);
+        slot->next = freeList;
+        freeList = slot;
+        ++cached;
+    }
+};
+
+// 分块（slab）策略：一次申请 ChunkSize 个节点的连续内存块，块内顺序切分，
+// 回收的节点进入空闲链表复用。内存块在分配器析构时统一释放。
+template<typename NodeT, size_t ChunkSize = 256>
+class SlabAllocator {
+private:
+    static_assert(sizeof(NodeT) >= sizeof(FreeSlot), "Node too small to hold a free-list link");
+    static_assert(ChunkSize > 0, "ChunkSize must be positive");
+
+    typedef typename std::aligned_storage<sizeof(NodeT), alignof(NodeT)>::type Slot;
+
+    // 内存块头部，把所有块串成链表以便统一释放
+    struct Chunk {
+        Chunk* next;
+        Slot slots[ChunkSize];
+    };
+
+    Chunk* chunks;      // 已申请的内存块
+    size_t used;        // 当前块中已切分的槽位数
+    FreeSlot* freeList; // 回收的槽位
+    size_t chunkCount;
+
+public:
+    SlabAllocator() : chunks(nullptr), used(ChunkSize), freeList(nullptr), chunkCount(0) {}
+
+    ~SlabAllocator() {
+        while (chunks != nullptr) {
+            Chunk* next = chunks->next;
+            delete chunks;
+            chunks = next;
+        }
+    }
+
+    SlabAllocator(const SlabAllocator&) = delete;
+    SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+    template<typename... Args>
+    NodeT* create(Args&&... args) {
+        void* mem;
+        if (freeList != nullptr) {
+            mem = freeList;
+            freeList = freeList->next;
+        } else {
+            if (used == ChunkSize) {
+                Chunk* chunk = new Chunk;
+                chunk->next = chunks;
+                chunks = chunk;
+                used = 0;
+                ++chunkCount;
+            }
+            mem = &chunks->slots[used++];
+        }
+        try {
+            return new (mem) NodeT(std::forward<Args>(args)...);
+        } catch (...) {
+            release(mem);
+            throw;
+        }
+    }
+
+    void destroy(NodeT* p) {
+        p->~NodeT();
+        release(p);
+    }
+
+    // 已申请的内存块数
+    size_t chunksAllocated() const {
+        return chunkCount;
+    }
+
+private:
+    void release(void* mem) {
+        FreeSlot* slot = static_cast<FreeSlot*>(mem);
+        slot->next = freeList;
+        freeList = slot;
+    }
+};
+
+// 线程本地缓存策略：同一线程内所有使用该节点类型的容器共享一个空闲链表，
+// 适合大量短生命周期容器反复创建/销毁的场景。节点可以在任意线程回收，
+// 回收时进入当前线程的缓存；缓存超过 MaxCached 后直接释放。
+// 线程退出时缓存先于静态/全局对象析构，此后该线程上的分配和回收直接使用
+// ::operator new / ::operator delete，静态的容器在程序退出时仍可安全析构。
+template<typename NodeT, size_t MaxCached = 4096>
+class ThreadCacheAllocator {
+private:
+    static_assert(sizeof(NodeT) >= sizeof(FreeSlot), "Node too small to hold a free-list link");
+
+    struct Cache {
+        FreeSlot* head;
+        size_t count;
+
+        Cache() : head(nullptr), count(0) {}
+
+        ~Cache() {
+            while (head != nullptr) {
+                FreeSlot* next = head->next;
+                ::operator delete(head);
+                head = next;
+            }
+            count = 0;
+            destroyed() = true;
+        }
+    };
+
+    static Cache& cache() {
+        static thread_local Cache instance;
+        return instance;
+    }
+
+    // 当前线程的缓存是否已经析构。bool 没有析构函数，缓存析构后仍可读取
+    static bool& destroyed() {
+        static thread_local bool flag = false;
+        return flag;
+    }
+
+public:
+    template<typename... Args>
+    NodeT* create(Args&&... args) {
+        void* mem;
+        Cache* c = destroyed() ? nullptr : &cache();
+        if (c != nullptr && c->head != nullptr) {
+            mem = c->head;
+            c->head = c->head->next;
+            --c->count;
+        } else {
+            mem = ::operator new(sizeof(NodeT));
+        }
+        try {
+            return new (mem) NodeT(std::forward<Args>(args)...);
+        } catch (...) {
+            release(mem);
+            throw;
+        }
+    }
+
+    void destroy(NodeT* p) {
+        p->~NodeT();
+        release(p);
+    }
+
+    // 当前线程缓存的节点数
+    static size_t cachedCount() {
+        return destroyed() ? 0 : cache().count;
+    }
+
+private:
+    static void release(void* mem) {
+        if (destroyed() || cache().count >= MaxCached) {
+            ::operator delete(mem);
+            return;
+        }
+        Cache& c = cache();
+        FreeSlot* slot = static_cast<FreeSlot*>(mem);
+        slot->next = c.head;
+        c.head = slot;
+        ++c.count;
+    }
+};
+
+// 区域（arena）策略：节点从大块连续内存中按顺序切出，连续创建的节点在内存中相邻，
+// 遍历时接近顺序访问。单个回收的节点进入空闲链表复用；reset() 不逐个析构，
+// 直接丢弃全部节点，每个区域只需 O(1)。ArenaNodes 为默认区域容量（节点数）。
+template<typename NodeT, size_t ArenaNodes = 4096>
+class ArenaAllocator {
+private:
+    static_assert(sizeof(NodeT) >= sizeof(FreeSlot), "Node too small to hold a free-list link");
+    static_assert(ArenaNodes > 0, "ArenaNodes must be positive");
+
+    typedef typename std::aligned_storage<sizeof(NodeT), alignof(NodeT)>::type Slot;
+
+    // 区域头部，槽位紧跟在头部之后
+    struct Arena {
+        Arena* next;
+        size_t capacity;
+
+        Slot* slots() {
+            return reinterpret_cast<Slot*>(this + 1);
+        }
+    };
+
+    static_assert(sizeof(Arena) % alignof(Slot) == 0, "Arena header breaks slot alignment");
+
+    Arena* arenas;      // 所有区域，当前区域在链表头
+    size_t used;        // 当前区域中已切分的槽位数
+    FreeSlot* freeList; // 回收的槽位
+    size_t arenaCount;
+    size_t reservedBytes;
+
+    void newArena(size_t capacity) {
+        Arena* arena = static_cast<Arena*>(::operator new(sizeof(Arena) + sizeof(Slot) * capacity));
+        arena->next = arenas;
+        arena->capacity = capacity;
+        arenas = arena;
+        used = 0;
+        ++arenaCount;
+        reservedBytes += sizeof(Arena) + sizeof(Slot) * capacity;
+    }
+
+    void release(void* mem) {
+        FreeSlot* slot = static_cast<FreeSlot*>(mem);
+        slot->next = freeList;
+        freeList = slot;
+    }
+
+public:
+    ArenaAllocator() : arenas(nullptr), used(0), freeList(nullptr), arenaCount(0), reservedBytes(0) {}
+
+    ~ArenaAllocator() {
+        while (arenas != nullptr) {
+            Arena* next = arenas->next;
+            ::operator delete(arenas);
+            arenas = next;
+        }
+    }
+
+    ArenaAllocator(const ArenaAllocator&) = delete;
+    ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+
+    template<typename... Args>
+    NodeT* create(Args&&... args) {
+        void* mem;
+        if (freeList != nullptr) {
+            mem = freeList;
+            freeList = freeList->next;
+        } else {
+            if (arenas == nullptr || used == arenas->capacity) {
+                newArena(ArenaNodes);
+            }
+            mem = &arenas->slots()[used++];
+        }
+        try {
+            return new (mem) NodeT(std::forward<Args>(args)...);
+        } catch (...) {
+            release(mem);
+            throw;
+        }
+    }
+
+    void destroy(NodeT* p) {
+        p->~NodeT();
+        release(p);
+    }
+
+    // 保证接下来的 n 次 create 从同一块连续内存中顺序切出
+    void reserve(size_t n) {
+        if (arenas == nullptr || arenas->capacity - used < n) {
+            newArena(n > ArenaNodes ? n : ArenaNodes);
+        }
+    }
+
+    // 丢弃所有节点（不调用析构函数），只保留当前区域以便复用。
+    // 调用方需保证节点不再被访问，且节点类型无需析构
+    void reset() {
+        Arena* keep = arenas;
+        if (keep != nullptr) {
+            Arena* p = keep->next;
+            while (p != nullptr) {
+                Arena* next = p->next;
+                reservedBytes -= sizeof(Arena) + sizeof(Slot) * p->capacity;
+                ::operator delete(p);
+                --arenaCount;
+                p = next;
+            }
+            keep->next = nullptr;
+        }
+        used = 0;
+        freeList = nullptr;
+    }
+
+    // 已申请的区域数
+    size_t arenasAllocated() const {
+        return arenaCount;
+    }
+
+    // 区域占用的总字节数
+    size_t bytesReserved() const {
+        return reservedBytes;
+    }
+};
+
+// 策略能力描述：
+//   interchangeable ：节点可以交给同类型的另一个策略对象回收（无状态或全局状态），
+//                     容器之间可以直接转移节点
+//   bulkRelease     ：提供 reserve(n) 和 reset()，可以预留连续空间并整体丢弃节点
+template<typename Alloc>
+struct NodeAllocatorTraits {
+    static const bool interchangeable = false;
+    static const bool bulkRelease = false;
+};
+
+template<typename NodeT>
+struct NodeAllocatorTraits<NewDeleteAllocator<NodeT>> {
+    static const bool interchangeable = true;
+    static const bool bulkRelease = false;
+};
+
+template<typename NodeT, size_t MaxCached>
+struct NodeAllocatorTraits<ThreadCacheAllocator<NodeT, MaxCached>> {
+    static const bool interchangeable = true;
+    static const bool bulkRelease = false;
+};
+
+template<typename NodeT, size_t ArenaNodes>
+struct NodeAllocatorTraits<ArenaAllocator<NodeT, ArenaNodes>> {
+    static const bool interchangeable = false;
+    static const bool bulkRelease = true;
+};
+
+#endif // NODE_ALLOCATOR_HPP
@@ -122,6 +122,18 @@ public:
         return degree;
     }
 
+    // 遍历以from为起点的所有出边，对每条边调用visit(to, weight)
+    template<typename Visitor>
+    void forEachEdge(int from, Visitor visit) const {
+        if (from < 0 || from >= static_cast<int>(vertices.size())) {
+            throw std::out_of_range("Vertex index out of range");
+        }
+
+        for (int i = head[from]; i != -1; i = edges[i].next) {
+            visit(edges[i].to, edges[i].weight);
+        }
+    }
+
     // 获取顶点的入度
     int getInDegree(int vertex) const {
         if (vertex < 0 || vertex >= vertices.size()) {
@@ -225,6 +225,37 @@ void testWeightedEdges() {
     std::cout << "Weighted edges tests passed!" << std::endl;
 }
 
+void testForEachEdge() {
+    std::cout << "Testing edge visiting..." << std::endl;
+    
+    ChainForwardStar<char> graph(3, false);
+    graph.addEdge(0, 1, 4);
+    graph.addEdge(0, 2, 7);
+    
+    // 依次访问顶点 0 的出边（后添加的边先访问）
+    int count = 0, weightSum = 0, lastTo = -1;
+    graph.forEachEdge(0, [&](int to, int weight) {
+        count++;
+        weightSum += weight;
+        lastTo = to;
+    });
+    assert(count == 2 && weightSum == 11 && lastTo == 1 && "Vertex A should have edges to C and B");
+    
+    // 无向图的反向边
+    graph.forEachEdge(2, [&](int to, int weight) {
+        assert(to == 0 && weight == 7 && "Vertex C should have a single edge to A");
+    });
+    
+    try {
+        graph.forEachEdge(3, [](int, int) {});
+        assert(false && "Should throw exception for invalid vertex");
+    } catch (const std::out_of_range&) {
+        // Expected exception
+    }
+    
+    std::cout << "Edge visiting tests passed!" << std::endl;
+}
+
 int main() {
     try {
         testBasicOperations();
@@ -233,6 +264,7 @@ int main() {
         testTopologicalSort();
         testErrorHandling();
         testWeightedEdges();
+        testForEachEdge();
         
         std::cout << "\nAll tests passed successfully!" << std::endl;
         return 0;
@@ -7,6 +7,7 @@
 #include <vector>
 #include <climits>
 #include <stdexcept>
+#include "../../Heap/IndexedHeap/IndexedHeap.hpp"
 
 template<typename T, size_t MAX_SIZE = 100>
 class ListUDG {
@@ -184,10 +185,16 @@ public:
     }
 
     // 最小生成树 Prim 算法
-    void Prim(int start) {
+    // useHeap 为 true 时用索引堆选出权重最小的顶点，O((V + E) log V)，适合稀疏图；
+    // 否则每轮逐个扫描所有顶点，O(V^2)
+    void Prim(int start, bool useHeap = false) {
         if (start < 0 || start >= vertexNum) {
             throw std::invalid_argument("Invalid starting vertex");
         }
+        if (useHeap) {
+            PrimHeap(start);
+            return;
+        }
 
         std::vector<bool> included(vertexNum, false);
         std::vector<int> weights(vertexNum, INT_MAX);
@@ -300,6 +307,51 @@ private:
         return -1;
     }
 
+    // 使用索引堆的 Prim 算法：堆中保存尚未加入生成树、且与生成树相邻的顶点，
+    // 优先级为它到生成树的最小边权，发现更短的边时 decrease_key
+    void PrimHeap(int start) {
+        std::vector<bool> included(vertexNum, false);
+        std::vector<int> parent(vertexNum, -1);
+        IndexedHeap<int> heap(vertexNum);
+        int totalWeight = 0;
+
+        heap.push(start, 0);
+
+        std::cout << "Prim's MST starting from " << vertices[start].data << ":" << std::endl;
+
+        while (!heap.empty()) {
+            std::pair<size_t, int> top = heap.pop();
+            int u = static_cast<int>(top.first);
+            included[u] = true;
+            totalWeight += top.second;
+
+            // 打印边
+            if (parent[u] != -1) {
+                std::cout << vertices[parent[u]].data << " -- "
+                         << vertices[u].data << " : "
+                         << top.second << std::endl;
+            }
+
+            // 更新相邻顶点的权重
+            EdgeNode* current = vertices[u].firstEdge;
+            while (current != nullptr) {
+                int v = current->index;
+                if (!included[v]) {
+                    if (!heap.contains(v)) {
+                        parent[v] = u;
+                        heap.push(v, current->weight);
+                    } else if (current->weight < heap.key(v)) {
+                        parent[v] = u;
+                        heap.decrease_key(v, current->weight);
+                    }
+                }
+                current = current->next;
+            }
+        }
+
+        std::cout << "Total MST weight: " << totalWeight << std::endl;
+    }
+
     // 深度优先搜索的递归辅助函数
     void DFS(int v, std::vector<bool>& visited) {
         visited[v] = true;
@@ -1,6 +1,7 @@
 #include "ListUDG.hpp"
 #include <cassert>
 #include <sstream>
+#include <cstdlib>
 
 // 辅助函数：捕获标准输出
 class CaptureOutput {
@@ -108,6 +109,74 @@ void testPrimMST() {
     std::cout << "Prim's MST algorithm tests passed!" << std::endl;
 }
 
+// 统计 Prim 输出中的边数，并取出总权重
+int totalWeightOf(const std::string& output, int& edges) {
+    edges = 0;
+    for (size_t p = output.find(" -- "); p != std::string::npos; p = output.find(" -- ", p + 1)) {
+        edges++;
+    }
+    std::string label = "Total MST weight: ";
+    size_t p = output.find(label);
+    assert(p != std::string::npos && "Prim output should show total weight");
+    return std::atoi(output.c_str() + p + label.size());
+}
+
+void testPrimWithHeap() {
+    std::cout << "Testing Prim's MST with indexed heap..." << std::endl;
+
+    // 随机稀疏图，边权均为 1：连通时生成树恰好 n - 1 条边
+    const int n = 80;
+    const int m = 200;
+    int vertices[n];
+    int edges[m][2];
+    for (int i = 0; i < n; i++) {
+        vertices[i] = i;
+    }
+    std::srand(11);
+    for (int i = 0; i < m; i++) {
+        if (i < n - 1) {
+            edges[i][0] = i;          // 一条链保证连通
+            edges[i][1] = i + 1;
+        } else {
+            edges[i][0] = std::rand() % n;
+            edges[i][1] = (edges[i][0] + 1 + std::rand() % (n - 1)) % n;
+        }
+    }
+    ListUDG<int> graph(vertices, n, edges, m);
+
+    for (int start = 0; start < n; start += 19) {
+        int scanEdges, heapEdges;
+        std::string scan, heap;
+        {
+            CaptureOutput capture;
+            graph.Prim(start);
+            scan = capture.getOutput();
+        }
+        {
+            CaptureOutput capture;
+            graph.Prim(start, true);
+            heap = capture.getOutput();
+        }
+        assert(totalWeightOf(scan, scanEdges) == totalWeightOf(heap, heapEdges) &&
+               "Both Prim paths should give the same MST weight");
+        assert(heapEdges == n - 1 && scanEdges == n - 1 && "MST should have n - 1 edges");
+    }
+
+    // 不连通的图只生成起点所在连通分量的生成树
+    char chars[] = {'A', 'B', 'C', 'D'};
+    char charEdges[][2] = {{'A', 'B'}, {'C', 'D'}};
+    ListUDG<char> split(chars, 4, charEdges, 2);
+    {
+        CaptureOutput capture;
+        split.Prim(2, true);
+        int count;
+        assert(totalWeightOf(capture.getOutput(), count) == 1 && count == 1 &&
+               "Only the component of the start vertex should be spanned");
+    }
+
+    std::cout << "Prim's MST with indexed heap tests passed!" << std::endl;
+}
+
 void testErrorHandling() {
     std::cout << "Testing error handling..." << std::endl;
     
@@ -169,6 +238,7 @@ int main() {
         testBasicOperations();
         testGraphTraversal();
         testPrimMST();
+        testPrimWithHeap();
         testErrorHandling();
         testDisconnectedGraph();
         
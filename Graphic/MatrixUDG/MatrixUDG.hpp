@@ -6,6 +6,8 @@
 #include <stack>
 #include <vector>
 #include <climits>
+#include <stdexcept>
+#include "../../Heap/IndexedHeap/IndexedHeap.hpp"
 
 template<typename T, size_t MAX_SIZE = 100>
 class MatrixUDG {
@@ -158,10 +160,16 @@ public:
     }
 
     // 最小生成树 Prim 算法
-    void Prim(int start) {
+    // useHeap 为 true 时用索引堆选出权重最小的顶点（O(V^2 + V log V)），否则逐个扫描（O(V^2)）。
+    // 邻接矩阵找邻接顶点本身就要 O(V)，两者同阶；索引堆主要用于与邻接表版本保持一致的接口
+    void Prim(int start, bool useHeap = false) {
         if (start < 0 || start >= vertexNum) {
             throw std::invalid_argument("Invalid starting vertex");
         }
+        if (useHeap) {
+            PrimHeap(start);
+            return;
+        }
 
         std::vector<int> weights(vertexNum, INT_MAX);
         std::vector<bool> included(vertexNum, false);
@@ -252,6 +260,50 @@ private:
         return -1;
     }
 
+    // 使用索引堆的 Prim 算法：堆中保存尚未加入生成树、且与生成树相邻的顶点，
+    // 优先级为它到生成树的最小边权，发现更短的边时 decrease_key
+    void PrimHeap(int start) {
+        std::vector<bool> included(vertexNum, false);
+        std::vector<int> parent(vertexNum, -1);
+        IndexedHeap<int> heap(vertexNum);
+        int totalWeight = 0;
+
+        heap.push(start, 0);
+
+        std::cout << "Prim's MST starting from " << vertices[start] << ":" << std::endl;
+
+        while (!heap.empty()) {
+            std::pair<size_t, int> top = heap.pop();
+            int u = static_cast<int>(top.first);
+            included[u] = true;
+            totalWeight += top.second;
+
+            // 打印边
+            if (parent[u] != -1) {
+                std::cout << vertices[parent[u]] << " -- "
+                         << vertices[u] << " : "
+                         << matrix[u][parent[u]] << std::endl;
+            }
+
+            // 更新相邻顶点的权重
+            for (int v = 0; v < vertexNum; v++) {
+                int w = matrix[u][v];
+                if (!w || included[v]) {
+                    continue;
+                }
+                if (!heap.contains(v)) {
+                    parent[v] = u;
+                    heap.push(v, w);
+                } else if (w < heap.key(v)) {
+                    parent[v] = u;
+                    heap.decrease_key(v, w);
+                }
+            }
+        }
+
+        std::cout << "Total MST weight: " << totalWeight << std::endl;
+    }
+
     // 深度优先搜索的递归辅助函数
     void DFS(int v, std::vector<bool>& visited) {
         visited[v] = true;
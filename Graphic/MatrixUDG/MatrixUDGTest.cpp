@@ -1,6 +1,7 @@
 #include "MatrixUDG.hpp"
 #include <cassert>
 #include <sstream>
+#include <cstdlib>
 
 // 辅助函数：捕获标准输出
 class CaptureOutput {
@@ -104,6 +105,67 @@ void testPrimMST() {
     std::cout << "Prim's MST algorithm tests passed!" << std::endl;
 }
 
+// 从 Prim 的输出中取出总权重
+int totalWeightOf(const std::string& output) {
+    std::string label = "Total MST weight: ";
+    size_t p = output.find(label);
+    assert(p != std::string::npos && "Prim output should show total weight");
+    return std::atoi(output.c_str() + p + label.size());
+}
+
+void testPrimWithHeap() {
+    std::cout << "Testing Prim's MST with indexed heap..." << std::endl;
+
+    // 固定的小图：MST 为 B-C(1) + A-B(2)
+    char small[] = {'A', 'B', 'C'};
+    int smallMatrix[][100] = {
+        {0, 2, 3},
+        {2, 0, 1},
+        {3, 1, 0}
+    };
+    MatrixUDG<char> smallGraph(small, 3, smallMatrix);
+    {
+        CaptureOutput capture;
+        smallGraph.Prim(0, true);
+        std::string output = capture.getOutput();
+        assert(totalWeightOf(output) == 3 && "MST weight should be 3");
+        assert(output.find("B -- C : 1") != std::string::npos && "MST should contain edge B-C");
+    }
+
+    // 随机带权图：两种实现的总权重相同
+    const int n = 60;
+    static int matrix[100][100];
+    int vertices[n];
+    std::srand(7);
+    for (int i = 0; i < n; i++) {
+        vertices[i] = i;
+        for (int j = 0; j < i; j++) {
+            int w = std::rand() % 4 == 0 ? 1 + std::rand() % 50 : 0;
+            if (j == i - 1) {
+                w = 1 + std::rand() % 100;   // 保证连通
+            }
+            matrix[i][j] = matrix[j][i] = w;
+        }
+    }
+    MatrixUDG<int> graph(vertices, n, matrix);
+    for (int start = 0; start < n; start += 17) {
+        std::string scan, heap;
+        {
+            CaptureOutput capture;
+            graph.Prim(start);
+            scan = capture.getOutput();
+        }
+        {
+            CaptureOutput capture;
+            graph.Prim(start, true);
+            heap = capture.getOutput();
+        }
+        assert(totalWeightOf(scan) == totalWeightOf(heap) && "Both Prim paths should give the same MST weight");
+    }
+
+    std::cout << "Prim's MST with indexed heap tests passed!" << std::endl;
+}
+
 void testErrorHandling() {
     std::cout << "Testing error handling..." << std::endl;
     
@@ -165,6 +227,7 @@ int main() {
         testBasicOperations();
         testGraphTraversal();
         testPrimMST();
+        testPrimWithHeap();
         testErrorHandling();
         testDisconnectedGraph();
         
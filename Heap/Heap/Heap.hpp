@@ -4,11 +4,85 @@
 #include <vector>
 #include <stdexcept>
 #include <functional>
+#include <utility>
+#include <iterator>
+#include <memory>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <algorithm>
+#ifndef HEAP_NO_THREADS
+#include <thread>
+#endif
+#include "HeapSimd.hpp"
 
-template<typename T, typename Compare = std::less<T>>
+/**
+ * @brief 让下标 1 的元素从缓存行边界开始的分配器
+ * @details d 叉堆中节点 i 的子节点为 d*i+1 ~ d*i+d，每组兄弟节点的起点相对下标 1
+ * 偏移 d*i 个元素。下标 1 对齐到缓存行后，只要一组兄弟节点的字节数整除缓存行大小，
+ * 每组兄弟节点都落在同一个缓存行内，选择子节点时只访问一个缓存行
+ */
+template<typename T>
+struct GroupAlignedAllocator {
+    typedef T value_type;
+    static const size_t CACHE_LINE = 64;
+
+    GroupAlignedAllocator() {}
+
+    template<typename U>
+    GroupAlignedAllocator(const GroupAlignedAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+        // 多分配一个缓存行用于对齐，再多分配一个指针的位置记录原始地址
+        char* raw = static_cast<char*>(::operator new(n * sizeof(T) + CACHE_LINE + sizeof(void*)));
+        std::uintptr_t second = reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*) + sizeof(T);
+        second = (second + CACHE_LINE - 1) & ~static_cast<std::uintptr_t>(CACHE_LINE - 1);
+        char* p = reinterpret_cast<char*>(second - sizeof(T));
+        std::memcpy(p - sizeof(void*), &raw, sizeof(void*));
+        return reinterpret_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_t) {
+        char* raw;
+        std::memcpy(&raw, reinterpret_cast<char*>(p) - sizeof(void*), sizeof(void*));
+        ::operator delete(raw);
+    }
+
+    bool operator==(const GroupAlignedAllocator&) const { return true; }
+    bool operator!=(const GroupAlignedAllocator&) const { return false; }
+};
+
+/**
+ * @brief 通用堆
+ * @tparam T 元素类型
+ * @tparam Compare 比较函数对象，comp(a, b) 为 true 表示 a 应在 b 之上，默认为最小堆
+ * @tparam Arity 每个节点的子节点数（2、4、8 ...），默认为二叉堆。
+ * 叉数越大树越矮，pop 经过的层数（大堆上即缓存未命中次数）越少，但每层要比较更多子节点
+ * @tparam CacheAligned 是否让每组兄弟节点对齐到缓存行（见 GroupAlignedAllocator）
+ * @note 元素为有符号 32 位整数、float 或 double 且比较函数为 std::less / std::greater 时，
+ * 4 叉和 8 叉堆用 SIMD 指令一次选出最优的子节点
+ */
+template<typename T, typename Compare = std::less<T>, size_t Arity = 2, bool CacheAligned = false>
 class Heap {
+    static_assert(Arity >= 2, "Arity must be at least 2");
+
+public:
+    typedef typename std::conditional<CacheAligned, GroupAlignedAllocator<T>, std::allocator<T>>::type allocator_type;
+
 private:
-    std::vector<T> data;     // 存储堆元素的数组
+    // 子节点选择方式：0 为调用比较函数，1 / 2 为向量化求最小 / 最大值
+    static const int SIMD_SELECT =
+        !heap_simd::Selectable<T>::value || (Arity != 4 && Arity != 8) ? 0 :
+        std::is_same<Compare, std::less<T>>::value ? 1 :
+        std::is_same<Compare, std::greater<T>>::value ? 2 : 0;
+
+    // 元素不少于这个数时才用多线程建堆，更小的堆线程的启动开销比建堆本身还大
+    static const size_t PARALLEL_HEAPIFY_MIN = 1 << 16;
+
+    // push_range 中新元素不少于原有元素的 1/BULK_RATIO 时按段重新调整，否则逐个上浮
+    static const size_t BULK_RATIO = 8;
+
+    std::vector<T, allocator_type> data;     // 存储堆元素的数组
     Compare comp;            // 比较函数对象，默认为最小堆
 
     /**
@@ -17,70 +91,253 @@ private:
      * @return 父节点的索引
      */
     size_t parent(size_t index) const {
-        return (index - 1) / 2;
+        return (index - 1) / Arity;
     }
 
     /**
-     * @brief 获取左子节点的索引
+     * @brief 获取第一个子节点的索引，其余子节点紧随其后
      * @param index 当前节点的索引
-     * @return 左子节点的索引
+     * @return 第一个子节点的索引
      */
-    size_t left_child(size_t index) const {
-        return 2 * index + 1;
+    size_t first_child(size_t index) const {
+        return Arity * index + 1;
     }
 
     /**
-     * @brief 获取右子节点的索引
-     * @param index 当前节点的索引
-     * @return 右子节点的索引
+     * @brief 在从 first 开始的一组兄弟节点中找出最应该在上面的一个
+     * @param first 第一个子节点的索引，需小于元素个数
+     * @param n 元素个数
+     * @return 最优子节点的索引，有多个时返回第一个
      */
-    size_t right_child(size_t index) const {
-        return 2 * index + 2;
+    size_t best_child(size_t first, size_t n) const {
+        size_t last = first + Arity < n ? first + Arity : n;
+        return best_child(first, last, std::integral_constant<int, SIMD_SELECT>());
+    }
+
+    size_t best_child(size_t first, size_t last, std::integral_constant<int, 0>) const {
+        size_t best = first;
+        for (size_t i = first + 1; i < last; ++i) {
+            if (comp(data[i], data[best])) {
+                best = i;
+            }
+        }
+        return best;
+    }
+
+    template<int Select>
+    size_t best_child(size_t first, size_t last, std::integral_constant<int, Select>) const {
+        if (last - first < Arity) {
+            return best_child(first, last, std::integral_constant<int, 0>());
+        }
+        return first + heap_simd::best<Select == 2>(&data[first], static_cast<int>(Arity));
+    }
+
+    /**
+     * @brief 接管或复制初始数据
+     */
+    void assign(std::vector<T>&& init_data, std::true_type) {
+        data = std::move(init_data);
+    }
+
+    void assign(std::vector<T>&& init_data, std::false_type) {
+        data.assign(std::make_move_iterator(init_data.begin()), std::make_move_iterator(init_data.end()));
+        init_data.clear();
     }
 
     /**
      * @brief 向上调整堆
      * @param index 需要向上调整的节点索引
      * @details
-     * 1. 比较当前节点与其父节点
-     * 2. 如果违反堆的性质，则交换它们
-     * 3. 重复此过程直到满足堆的性质
+     * 1. 把当前节点的元素移出，留下一个"空位"
+     * 2. 父节点比移出的元素更靠后时，把父节点移入空位，空位上移
+     * 3. 找到位置后把元素移入空位
+     * 每层只移动一次元素，而交换需要移动三次
      * @time O(log n)
      */
     void sift_up(size_t index) {
-        while (index > 0 && comp(data[index], data[parent(index)])) {
-            std::swap(data[index], data[parent(index)]);
-            index = parent(index);
+        T value = std::move(data[index]);
+        place_up(index, value);
+    }
+
+    /**
+     * @brief 从空位 hole 开始向上为 value 寻找位置并放入
+     * @param hole 空位的索引
+     * @param value 要放入的元素，会被移走
+     * @time O(log n)
+     */
+    void place_up(size_t hole, T& value) {
+        while (hole > 0 && comp(value, data[parent(hole)])) {
+            data[hole] = std::move(data[parent(hole)]);
+            hole = parent(hole);
         }
+        data[hole] = std::move(value);
     }
 
     /**
-     * @brief 向下调整堆
+     * @brief 向下调整堆（迭代）
      * @param index 需要向下调整的节点索引
      * @details
-     * 1. 找出当前节点和其两个子节点中的最小值（最大堆则找最大值）
-     * 2. 如果当前节点不是最小值，则与最小值交换
-     * 3. 重复此过程直到满足堆的性质
+     * 1. 把当前节点的元素移出，留下一个"空位"
+     * 2. 找出空位所有子节点中的最小值（最大堆则找最大值）
+     * 3. 如果它比移出的元素更靠前，则移入空位，空位下移；否则停止
+     * 4. 把元素移入空位
      * @time O(log n)
      */
     void sift_down(size_t index) {
-        size_t min_index = index;
-        size_t l = left_child(index);
-        size_t r = right_child(index);
+        size_t n = data.size();
+        T value = std::move(data[index]);
+        size_t hole = index;
+        while (first_child(hole) < n) {
+            size_t child = best_child(first_child(hole), n);
+            if (!comp(data[child], value)) {
+                break;
+            }
+            data[hole] = std::move(data[child]);
+            hole = child;
+        }
+        data[hole] = std::move(value);
+    }
 
-        if (l < data.size() && comp(data[l], data[min_index])) {
-            min_index = l;
+    /**
+     * @brief 从堆顶的空位开始重新放入最后一个元素（Floyd 自底向上调整）
+     * @param last 原来的最后一个元素，已从数组中移除
+     * @details
+     * 1. 空位沿着最小的子节点一直下移到叶子，每层只在子节点之间比较
+     * 2. 再从叶子处为 last 向上寻找位置
+     * 最后一个元素通常属于底层，向上调整一般只走一两步，
+     * 比普通向下调整每层少一次比较
+     * @time O(log n)
+     */
+    void sift_hole_from_root(T& last) {
+        size_t n = data.size();
+        size_t hole = 0;
+        while (first_child(hole) < n) {
+            size_t child = best_child(first_child(hole), n);
+            data[hole] = std::move(data[child]);
+            hole = child;
+        }
+        place_up(hole, last);
+    }
+
+    /**
+     * @brief 自底向上建堆
+     * @param threads 线程数，0 表示使用硬件线程数；元素少于 PARALLEL_HEAPIFY_MIN 时总是单线程
+     * @time O(n)
+     */
+    void heapify(unsigned threads = 1) {
+        if (data.size() < 2) {
+            return;
+        }
+#ifndef HEAP_NO_THREADS
+        if (threads == 0) {
+            threads = std::thread::hardware_concurrency();
         }
-        if (r < data.size() && comp(data[r], data[min_index])) {
-            min_index = r;
+        if (threads > 1 && data.size() >= PARALLEL_HEAPIFY_MIN) {
+            parallel_heapify(threads);
+            return;
         }
+#else
+        (void)threads;
+#endif
+        // 从最后一个非叶子节点开始向下调整
+        for (size_t i = parent(data.size() - 1) + 1; i-- > 0; ) {
+            sift_down(i);
+        }
+    }
 
-        if (min_index != index) {
-            std::swap(data[index], data[min_index]);
-            sift_down(min_index);
+    /**
+     * @brief 对以 [first, last)（同一层的连续节点）为根的子树自底向上建堆
+     * @details 这些子树在每一层的节点也是连续的一段：[first, last) 的子节点为
+     * [first_child(first), first_child(last))。逐层向上，对每段中的非叶子节点向下调整
+     */
+    void heapify_subtrees(size_t first, size_t last) {
+        size_t n = data.size();
+        size_t internal_end = parent(n - 1) + 1;   // 非叶子节点为 [0, internal_end)
+        std::vector<std::pair<size_t, size_t>> levels;
+        while (first < internal_end) {
+            levels.push_back(std::make_pair(first, std::min(last, internal_end)));
+            first = first_child(first);
+            last = first_child(last);
+        }
+        for (size_t l = levels.size(); l-- > 0; ) {
+            for (size_t i = levels[l].second; i-- > levels[l].first; ) {
+                sift_down(i);
+            }
         }
     }
 
+#ifndef HEAP_NO_THREADS
+    /**
+     * @brief 多线程建堆
+     * @details 选一层节点数不少于 4 倍线程数的层，这一层的节点为根的子树互不相交，
+     * 把它们分成连续的几段交给各个线程分别建堆；之后由当前线程调整上面的几层。
+     * 上面几层只有 O(线程数) 个节点，几乎全部工作都可以并行
+     */
+    void parallel_heapify(unsigned threads) {
+        size_t level_start = 0;
+        size_t level_size = 1;
+        while (level_size < static_cast<size_t>(threads) * 4) {
+            level_start = first_child(level_start);
+            level_size *= Arity;
+        }
+        size_t level_end = std::min(level_start + level_size, data.size());
+        if (level_start >= level_end) {
+            heapify(1);
+            return;
+        }
+
+        size_t roots = level_end - level_start;
+        std::vector<std::thread> workers;
+        try {
+            for (unsigned w = 0; w < threads; ++w) {
+                size_t first = level_start + roots * w / threads;
+                size_t last = level_start + roots * (w + 1) / threads;
+                workers.push_back(std::thread(&Heap::heapify_subtrees, this, first, last));
+            }
+        } catch (...) {
+            // 线程创建失败：等已启动的线程结束后再抛出，可结合的 std::thread 析构会终止程序
+            for (size_t w = 0; w < workers.size(); ++w) {
+                workers[w].join();
+            }
+            throw;
+        }
+        for (size_t w = 0; w < workers.size(); ++w) {
+            workers[w].join();
+        }
+        for (size_t i = level_start; i-- > 0; ) {
+            sift_down(i);
+        }
+    }
+#endif
+
+    /**
+     * @brief 插入新元素后最多保留 k 个元素
+     */
+    template<typename U>
+    bool push_bounded_impl(U&& value, size_t k) {
+        if (data.size() < k) {
+            push(std::forward<U>(value));
+            return true;
+        }
+        if (k == 0 || !comp(data[0], value)) {
+            return false;
+        }
+        T incoming(std::forward<U>(value));
+        sift_hole_from_root(incoming);
+        return true;
+    }
+
+    template<typename U>
+    T replace_top_impl(U&& value) {
+        if (empty()) {
+            throw std::runtime_error("堆为空");
+        }
+        T result = std::move(data[0]);
+        T incoming(std::forward<U>(value));
+        sift_hole_from_root(incoming);
+        return result;
+    }
+
 public:
     /**
      * @brief 默认构造函数
@@ -92,14 +349,27 @@ public:
      * @brief 使用初始数据构造堆
      * @param init_data 初始数据
      * @param compare 比较函数对象
+     * @param threads 建堆使用的线程数，默认单线程，0 表示使用硬件线程数
+     * @note 多线程建堆时比较函数和元素的移动不能抛出异常，比较函数对象会被多个线程同时调用
      * @time O(n)，其中n为初始数据的大小
      */
-    Heap(const std::vector<T>& init_data, const Compare& compare = Compare())
-        : data(init_data), comp(compare) {
-        // 从最后一个非叶子节点开始向下调整
-        for (int i = (data.size() - 2) / 2; i >= 0; --i) {
-            sift_down(i);
-        }
+    Heap(const std::vector<T>& init_data, const Compare& compare = Compare(), unsigned threads = 1)
+        : data(init_data.begin(), init_data.end()), comp(compare) {
+        heapify(threads);
+    }
+
+    /**
+     * @brief 接管初始数据的存储构造堆，不复制元素
+     * @param init_data 初始数据，构造后为空
+     * @param compare 比较函数对象
+     * @param threads 建堆使用的线程数，默认单线程，0 表示使用硬件线程数
+     * @note CacheAligned 为 true 时存储需要重新分配，元素被逐个移动过来
+     * @time O(n)
+     */
+    Heap(std::vector<T>&& init_data, const Compare& compare = Compare(), unsigned threads = 1)
+        : comp(compare) {
+        assign(std::move(init_data), std::is_same<allocator_type, std::allocator<T>>());
+        heapify(threads);
     }
 
     /**
@@ -113,19 +383,118 @@ public:
     }
 
     /**
-     * @brief 删除堆顶元素
+     * @brief 插入新元素（移动）
+     * @param value 要插入的值，会被移走
+     * @time O(log n)
+     */
+    void push(T&& value) {
+        data.push_back(std::move(value));
+        sift_up(data.size() - 1);
+    }
+
+    /**
+     * @brief 用参数原地构造新元素并插入
+     * @param args 传给 T 构造函数的参数
+     * @time O(log n)
+     */
+    template<typename... Args>
+    void emplace(Args&&... args) {
+        data.emplace_back(std::forward<Args>(args)...);
+        sift_up(data.size() - 1);
+    }
+
+    /**
+     * @brief 批量插入 [first, last) 中的元素
+     * @details 先把元素全部追加到数组末尾。新元素较少时逐个上浮；
+     * 较多时（不少于原有元素的 1/BULK_RATIO）只对新元素的祖先自底向上重新调整：
+     * 新元素在每一层的祖先是连续的一段，逐层向上对这一段向下调整，
+     * 代价为 O(k + log n · log k)，新元素多于原有元素时等同于重新建堆
+     * @param threads 重新建堆时使用的线程数，默认单线程，0 表示使用硬件线程数
+     * @time O(min(k log n, n + k))，k 为新元素个数
+     */
+    template<typename InputIt>
+    void push_range(InputIt first, InputIt last, unsigned threads = 1) {
+        size_t old_size = data.size();
+        data.insert(data.end(), first, last);
+        size_t added = data.size() - old_size;
+        if (added == 0) {
+            return;
+        }
+        if (added >= old_size) {
+            heapify(threads);
+        } else if (added * BULK_RATIO >= old_size) {
+            size_t lo = old_size;
+            size_t hi = data.size();
+            while (lo > 0) {
+                lo = parent(lo);
+                hi = parent(hi - 1) + 1;
+                for (size_t i = hi; i-- > lo; ) {
+                    sift_down(i);
+                }
+            }
+        } else {
+            for (size_t i = old_size; i < data.size(); ++i) {
+                sift_up(i);
+            }
+        }
+    }
+
+    /**
+     * @brief 有界插入：插入后堆中最多保留 k 个元素
+     * @param value 要插入的值
+     * @param k 保留的元素个数
+     * @return value 是否被保留
+     * @details 堆中不足 k 个元素时直接插入；否则只有 value 比堆顶更靠后时才替换堆顶，
+     * 只做一次从堆顶开始的调整，不必先 push 再 pop。
+     * 默认的最小堆用这种方式保留最大的 k 个元素，堆顶为其中最小的一个（即门槛）
+     * @time 被丢弃时 O(1)，否则 O(log k)
+     */
+    bool push_bounded(const T& value, size_t k) {
+        return push_bounded_impl(value, k);
+    }
+
+    /**
+     * @brief 有界插入（移动），见 push_bounded(const T&, size_t)
+     */
+    bool push_bounded(T&& value, size_t k) {
+        return push_bounded_impl(std::move(value), k);
+    }
+
+    /**
+     * @brief 用 value 替换堆顶并返回原来的堆顶，相当于 pop 后 push，但只调整一次
+     * @throw std::runtime_error 如果堆为空
+     * @time O(log n)
+     */
+    T replace_top(const T& value) {
+        return replace_top_impl(value);
+    }
+
+    /**
+     * @brief 用 value 替换堆顶（移动），见 replace_top(const T&)
+     */
+    T replace_top(T&& value) {
+        return replace_top_impl(std::move(value));
+    }
+
+    /**
+     * @brief 删除并返回堆顶元素
+     * @return 被移出的堆顶元素
      * @throw std::runtime_error 如果堆为空
      * @time O(log n)
      */
-    void pop() {
+    T pop() {
         if (empty()) {
             throw std::runtime_error("堆为空");
         }
-        data[0] = data.back();
-        data.pop_back();
-        if (!empty()) {
-            sift_down(0);
+        T result = std::move(data[0]);
+        if (data.size() > 1) {
+            T last = std::move(data.back());
+            data.pop_back();
+            sift_hole_from_root(last);
+        } else {
+            data.pop_back();
         }
+        return result;
     }
 
     /**
@@ -172,7 +541,7 @@ public:
      * @return 存储堆元素的vector的常引用
      * @note 主要用于测试
      */
-    const std::vector<T>& get_data() const {
+    const std::vector<T, allocator_type>& get_data() const {
         return data;
     }
 };
@@ -0,0 +1,109 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "Heap.hpp"
+
+// 不同叉数和布局的堆在不同规模下的吞吐量（int 键，最小堆），对比
+//   d2        ：二叉堆（默认）
+//   d4 / d8   ：4 叉 / 8 叉堆
+//   d4a / d8a ：同上，兄弟节点组对齐到缓存行（4 叉一组 16 字节，8 叉一组 32 字节）
+//   d8a-s     ：d8a，但关闭 SIMD，逐个比较子节点
+// 对每个 n 测量（每次操作的平均耗时，ns）：
+//   push ：随机插入 n 个元素
+//   hold ：保持 n 个元素，反复 pop 再 push 一个比弹出值稍大的随机键（离散事件模拟的典型用法）
+//   pop  ：弹出全部 n 个元素
+// 用法：./HeapArityBenchmark [maxN]，默认 2^23
+
+typedef std::chrono::steady_clock Clock;
+
+static volatile long sink;
+
+struct Result {
+    double push;
+    double hold;
+    double pop;
+};
+
+static std::uint32_t nextRandom(std::uint32_t& seed) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+static double elapsedNs(Clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+template<typename H>
+Result run(const std::vector<int>& keys) {
+    long n = static_cast<long>(keys.size());
+    long holdOps = n < 1000000 ? 1000000 : n;
+    Result best = {0, 0, 0};
+    for (int round = 0; round < 3; ++round) {
+        H heap;
+        Clock::time_point start = Clock::now();
+        for (long i = 0; i < n; ++i) {
+            heap.push(keys[i]);
+        }
+        double push = elapsedNs(start) / n;
+
+        std::uint32_t seed = 12345;
+        long sum = 0;
+        start = Clock::now();
+        for (long i = 0; i < holdOps; ++i) {
+            int top = heap.pop();
+            sum += top;
+            heap.push(top + static_cast<int>(nextRandom(seed) & 0xFFFF));
+        }
+        double hold = elapsedNs(start) / holdOps;
+
+        start = Clock::now();
+        while (!heap.empty()) {
+            sum += heap.pop();
+        }
+        double pop = elapsedNs(start) / n;
+        sink = sink + sum;
+
+        if (round == 0 || push < best.push) best.push = push;
+        if (round == 0 || hold < best.hold) best.hold = hold;
+        if (round == 0 || pop < best.pop) best.pop = pop;
+    }
+    return best;
+}
+
+static void print(const char* name, const Result& r) {
+    std::cout << std::setw(8) << name << std::fixed << std::setprecision(1)
+              << std::setw(10) << r.push << std::setw(10) << r.hold << std::setw(10) << r.pop << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    long maxN = argc > 1 ? std::atol(argv[1]) : 1L << 23;
+
+    const char* levels[] = {"scalar", "sse4.1", "avx2"};
+    std::cout << "SIMD level: " << levels[heap_simd::level()] << ", ns per operation" << std::endl;
+    for (long n = 1L << 10; n <= maxN; n <<= 3) {
+        std::vector<int> keys(n);
+        std::uint32_t seed = 2463534242u;
+        for (long i = 0; i < n; ++i) {
+            keys[i] = static_cast<int>(nextRandom(seed) >> 2);
+        }
+        std::cout << "\nn = " << n << " (" << n * sizeof(int) / 1024 << " KiB)" << std::endl;
+        std::cout << std::setw(8) << "heap" << std::setw(10) << "push" << std::setw(10) << "hold"
+                  << std::setw(10) << "pop" << std::endl;
+        print("d2", run<Heap<int, std::less<int>, 2>>(keys));
+        print("d4", run<Heap<int, std::less<int>, 4>>(keys));
+        print("d8", run<Heap<int, std::less<int>, 8>>(keys));
+        print("d4a", run<Heap<int, std::less<int>, 4, true>>(keys));
+        print("d8a", run<Heap<int, std::less<int>, 8, true>>(keys));
+        heap_simd::Level level = heap_simd::level();
+        heap_simd::setLevel(heap_simd::LevelScalar);
+        print("d8a-s", run<Heap<int, std::less<int>, 8, true>>(keys));
+        heap_simd::setLevel(level);
+    }
+    return 0;
+}
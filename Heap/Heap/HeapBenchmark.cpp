@@ -0,0 +1,227 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+#include <queue>
+#include <string>
+#include <vector>
+#include "Heap.hpp"
+
+// 优先队列的比较次数、元素移动次数和耗时，对比
+//   legacy ：改动前的 Heap（每层 std::swap，递归 sift_down，pop 前先复制 top()）
+//   Heap   ：空位调整 + Floyd 自底向上 pop，pop 返回移出的堆顶
+//   std    ：std::priority_queue，堆顶用 std::move(const_cast<T&>(top())) 移出后再 pop
+// 元素为模拟调度任务的 Task（优先级 + 名字 + 负载数组），每次复制都要分配内存。
+// 对每个 n：先随机插入 n 个元素，再全部弹出，统计每次操作的平均值。
+// 用法：./HeapBenchmark [maxN]，默认 10^6
+
+typedef std::chrono::steady_clock Clock;
+
+static long comparisons = 0;
+static long moves = 0;
+static long copies = 0;
+static volatile long sink;
+
+struct Task {
+    int priority;
+    std::string name;
+    std::vector<int> payload;
+
+    Task() : priority(0) {}
+    Task(int p) : priority(p), name("task"), payload(8, p) {}
+    Task(const Task& other) : priority(other.priority), name(other.name), payload(other.payload) { ++copies; }
+    Task(Task&& other) noexcept
+        : priority(other.priority), name(std::move(other.name)), payload(std::move(other.payload)) { ++moves; }
+    Task& operator=(const Task& other) {
+        priority = other.priority;
+        name = other.name;
+        payload = other.payload;
+        ++copies;
+        return *this;
+    }
+    Task& operator=(Task&& other) noexcept {
+        priority = other.priority;
+        name = std::move(other.name);
+        payload = std::move(other.payload);
+        ++moves;
+        return *this;
+    }
+};
+
+// 优先级小的任务先执行
+struct TaskLess {
+    bool operator()(const Task& a, const Task& b) const {
+        ++comparisons;
+        return a.priority < b.priority;
+    }
+};
+
+// std::priority_queue 堆顶是"最大"的元素，比较方向相反
+struct TaskGreater {
+    bool operator()(const Task& a, const Task& b) const {
+        ++comparisons;
+        return b.priority < a.priority;
+    }
+};
+
+// 改动前的实现，保留用于对比
+template<typename T, typename Compare>
+class LegacyHeap {
+private:
+    std::vector<T> data;
+    Compare comp;
+
+    size_t parent(size_t index) const { return (index - 1) / 2; }
+    size_t left_child(size_t index) const { return 2 * index + 1; }
+    size_t right_child(size_t index) const { return 2 * index + 2; }
+
+    void sift_up(size_t index) {
+        while (index > 0 && comp(data[index], data[parent(index)])) {
+            std::swap(data[index], data[parent(index)]);
+            index = parent(index);
+        }
+    }
+
+    void sift_down(size_t index) {
+        size_t min_index = index;
+        size_t l = left_child(index);
+        size_t r = right_child(index);
+        if (l < data.size() && comp(data[l], data[min_index])) {
+            min_index = l;
+        }
+        if (r < data.size() && comp(data[r], data[min_index])) {
+            min_index = r;
+        }
+        if (min_index != index) {
+            std::swap(data[index], data[min_index]);
+            sift_down(min_index);
+        }
+    }
+
+public:
+    void push(const T& value) {
+        data.push_back(value);
+        sift_up(data.size() - 1);
+    }
+
+    void pop() {
+        data[0] = data.back();
+        data.pop_back();
+        if (!data.empty()) {
+            sift_down(0);
+        }
+    }
+
+    const T& top() const { return data[0]; }
+    bool empty() const { return data.empty(); }
+    void reserve(size_t n) { data.reserve(n); }
+};
+
+struct Counts {
+    double cmp;
+    double move;
+    double copy;
+    double ns;
+};
+
+static void reset() {
+    comparisons = 0;
+    moves = 0;
+    copies = 0;
+}
+
+static Counts snapshot(Clock::time_point start, long ops) {
+    Counts c;
+    c.ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / ops;
+    c.cmp = static_cast<double>(comparisons) / ops;
+    c.move = static_cast<double>(moves) / ops;
+    c.copy = static_cast<double>(copies) / ops;
+    return c;
+}
+
+static void print(const char* name, const char* op, const Counts& c) {
+    std::cout << std::setw(8) << name << std::setw(6) << op << std::fixed << std::setprecision(2)
+              << std::setw(10) << c.cmp << std::setw(10) << c.move << std::setw(10) << c.copy
+              << std::setw(12) << std::setprecision(1) << c.ns << std::endl;
+}
+
+// 各实现的插入和弹出方式
+static void pushTask(LegacyHeap<Task, TaskLess>& heap, int p) {
+    heap.push(Task(p));   // 只有 push(const T&)
+}
+
+static void pushTask(Heap<Task, TaskLess>& heap, int p) {
+    heap.emplace(p);
+}
+
+static void pushTask(std::priority_queue<Task, std::vector<Task>, TaskGreater>& heap, int p) {
+    heap.emplace(p);
+}
+
+static int popTask(LegacyHeap<Task, TaskLess>& heap) {
+    Task t = heap.top();  // pop() 不返回元素，只能先复制
+    heap.pop();
+    return t.priority;
+}
+
+static int popTask(Heap<Task, TaskLess>& heap) {
+    return heap.pop().priority;
+}
+
+static int popTask(std::priority_queue<Task, std::vector<Task>, TaskGreater>& heap) {
+    Task t = std::move(const_cast<Task&>(heap.top()));
+    heap.pop();
+    return t.priority;
+}
+
+template<typename Queue>
+void run(const char* name, const std::vector<int>& keys) {
+    long n = static_cast<long>(keys.size());
+    Queue heap;
+    // 先插入再全部弹出一遍，让 vector 的容量稳定，不计扩容
+    for (long i = 0; i < n; ++i) {
+        pushTask(heap, keys[i]);
+    }
+    while (!heap.empty()) {
+        popTask(heap);
+    }
+
+    reset();
+    Clock::time_point start = Clock::now();
+    for (long i = 0; i < n; ++i) {
+        pushTask(heap, keys[i]);
+    }
+    Counts pushCounts = snapshot(start, n);
+
+    reset();
+    long sum = 0;
+    start = Clock::now();
+    while (!heap.empty()) {
+        sum += popTask(heap);
+    }
+    Counts popCounts = snapshot(start, n);
+    sink = sink + sum;
+
+    print(name, "push", pushCounts);
+    print(name, "pop", popCounts);
+}
+
+int main(int argc, char* argv[]) {
+    long maxN = argc > 1 ? std::atol(argv[1]) : 1000000;
+
+    std::cout << "per operation: comparisons, moves, copies, ns" << std::endl;
+    for (long n = 1000; n <= maxN; n *= 10) {
+        std::vector<int> keys(n);
+        std::srand(42);
+        for (long i = 0; i < n; ++i) {
+            keys[i] = std::rand();
+        }
+        std::cout << "\nn = " << n << std::endl;
+        std::cout << std::setw(8) << "heap" << std::setw(6) << "op" << std::setw(10) << "cmp"
+                  << std::setw(10) << "moves" << std::setw(10) << "copies" << std::setw(12) << "ns" << std::endl;
+        run<LegacyHeap<Task, TaskLess>>("legacy", keys);
+        run<Heap<Task, TaskLess>>("Heap", keys);
+        run<std::priority_queue<Task, std::vector<Task>, TaskGreater>>("std", keys);
+    }
+    return 0;
+}
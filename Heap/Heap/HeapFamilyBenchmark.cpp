@@ -0,0 +1,315 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <queue>
+#include <vector>
+#include <functional>
+#include "Heap.hpp"
+#include "../IndexedHeap/IndexedHeap.hpp"
+#include "../PairingHeap/PairingHeap.hpp"
+#include "../RadixHeap/RadixHeap.hpp"
+
+// 同一组负载下比较各种堆，用于按负载选择数据结构（键均为 uint64，最小堆）
+//   d2 / d4  ：Heap 二叉堆 / 4 叉堆
+//   pairing  ：PairingHeap
+//   radix    ：RadixHeap（只适用于单调的键）
+//   indexed  ：IndexedHeap（只用于 Dijkstra）
+//   std::pq  ：std::priority_queue
+// 负载（每次操作的平均耗时，ns）：
+//   random   ：插入 n 个随机键，再全部弹出；按 push + pop 计为 2n 次操作
+//   dijkstra ：随机图（n 个顶点、8n 条边、边权 1 ~ 1000）上的 Dijkstra，按边数计。
+//              键为 (距离 << 32 | 顶点)，天然单调。支持 decrease-key 的堆更新已有元素，
+//              其余的堆插入重复元素，弹出时跳过过期的
+//   meld     ：n/16 个各含 16 个随机键的堆两两合并直到只剩一个，每次合并后弹出一次堆顶；
+//              按合并次数计。没有合并操作的堆把较小的堆逐个插入较大的堆
+// 用法：./HeapFamilyBenchmark [n]，默认 2^20
+
+typedef std::chrono::steady_clock Clock;
+typedef std::uint64_t Key;
+
+static volatile Key sink;
+
+static std::uint64_t nextRandom(std::uint64_t& seed) {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    return seed;
+}
+
+static double elapsedNs(Clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+typedef Heap<Key> BinaryHeap;
+typedef Heap<Key, std::less<Key>, 4> QuaternaryHeap;
+typedef PairingHeap<Key> Pairing;
+typedef RadixHeap<Key> Radix;
+typedef std::priority_queue<Key, std::vector<Key>, std::greater<Key>> StdQueue;
+
+// ---------- 统一的 push / pop / meld ----------
+
+template<typename H>
+Key popKey(H& heap) {
+    return heap.pop();
+}
+
+Key popKey(StdQueue& heap) {
+    Key top = heap.top();
+    heap.pop();
+    return top;
+}
+
+template<typename H>
+void meldInto(H& into, H& from) {
+    while (!from.empty()) {
+        into.push(popKey(from));
+    }
+}
+
+template<typename T, typename C, size_t A, bool Aligned>
+void meldInto(Heap<T, C, A, Aligned>& into, Heap<T, C, A, Aligned>& from) {
+    for (size_t i = 0; i < from.get_data().size(); ++i) {
+        into.push(from.get_data()[i]);
+    }
+    from.clear();
+}
+
+void meldInto(Pairing& into, Pairing& from) {
+    into.meld(from);
+}
+
+// ---------- 负载 ----------
+
+template<typename H>
+double runRandom(const std::vector<Key>& keys) {
+    H heap;
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < keys.size(); ++i) {
+        heap.push(keys[i]);
+    }
+    Key sum = 0;
+    while (!heap.empty()) {
+        sum += popKey(heap);
+    }
+    sink = sink + sum;
+    return elapsedNs(start) / (2.0 * keys.size());
+}
+
+template<typename H>
+double runMeld(const std::vector<Key>& keys) {
+    const size_t group = 16;
+    std::vector<H> heaps(keys.size() / group);
+    for (size_t i = 0; i < heaps.size() * group; ++i) {
+        heaps[i / group].push(keys[i]);
+    }
+    Key sum = 0;
+    Clock::time_point start = Clock::now();
+    for (size_t step = 1; step < heaps.size(); step *= 2) {
+        for (size_t i = 0; i + step < heaps.size(); i += 2 * step) {
+            if (heaps[i].size() < heaps[i + step].size()) {
+                std::swap(heaps[i], heaps[i + step]);
+            }
+            meldInto(heaps[i], heaps[i + step]);
+            sum += popKey(heaps[i]);
+        }
+    }
+    sink = sink + sum;
+    return elapsedNs(start) / (heaps.size() - 1);
+}
+
+// 邻接数组（CSR）表示的有向图
+struct Graph {
+    std::vector<std::uint32_t> offset;
+    std::vector<std::uint32_t> target;
+    std::vector<std::uint32_t> weight;
+};
+
+static const Key INF = ~static_cast<Key>(0);
+
+static Key encode(Key dist, std::uint32_t v) {
+    return dist << 32 | v;
+}
+
+// 插入重复元素的 Dijkstra
+template<typename H>
+double runDijkstraLazy(const Graph& g, Key& checksum) {
+    size_t n = g.offset.size() - 1;
+    std::vector<Key> dist(n, INF);
+    H heap;
+    Clock::time_point start = Clock::now();
+    dist[0] = 0;
+    heap.push(encode(0, 0));
+    while (!heap.empty()) {
+        Key item = popKey(heap);
+        std::uint32_t u = static_cast<std::uint32_t>(item);
+        Key d = item >> 32;
+        if (d != dist[u]) {
+            continue;   // 过期的元素
+        }
+        for (std::uint32_t e = g.offset[u]; e < g.offset[u + 1]; ++e) {
+            std::uint32_t v = g.target[e];
+            Key nd = d + g.weight[e];
+            if (nd < dist[v]) {
+                dist[v] = nd;
+                heap.push(encode(nd, v));
+            }
+        }
+    }
+    double ns = elapsedNs(start) / g.target.size();
+    checksum = 0;
+    for (size_t i = 0; i < n; ++i) {
+        checksum += dist[i] == INF ? 0 : dist[i];
+    }
+    return ns;
+}
+
+// 配对堆：用句柄 decrease_key
+double runDijkstraPairing(const Graph& g, Key& checksum) {
+    size_t n = g.offset.size() - 1;
+    std::vector<Key> dist(n, INF);
+    std::vector<Pairing::handle> handle(n, nullptr);
+    std::vector<bool> done(n, false);
+    Pairing heap;
+    Clock::time_point start = Clock::now();
+    dist[0] = 0;
+    handle[0] = heap.push(encode(0, 0));
+    while (!heap.empty()) {
+        Key item = heap.pop();
+        std::uint32_t u = static_cast<std::uint32_t>(item);
+        Key d = item >> 32;
+        done[u] = true;
+        for (std::uint32_t e = g.offset[u]; e < g.offset[u + 1]; ++e) {
+            std::uint32_t v = g.target[e];
+            Key nd = d + g.weight[e];
+            if (nd < dist[v]) {
+                dist[v] = nd;
+                if (handle[v] == nullptr) {
+                    handle[v] = heap.push(encode(nd, v));
+                } else if (!done[v]) {
+                    heap.decrease_key(handle[v], encode(nd, v));
+                }
+            }
+        }
+    }
+    double ns = elapsedNs(start) / g.target.size();
+    checksum = 0;
+    for (size_t i = 0; i < n; ++i) {
+        checksum += dist[i] == INF ? 0 : dist[i];
+    }
+    return ns;
+}
+
+// 索引堆：用顶点编号 decrease_key
+double runDijkstraIndexed(const Graph& g, Key& checksum) {
+    size_t n = g.offset.size() - 1;
+    std::vector<Key> dist(n, INF);
+    IndexedHeap<Key> heap(n);
+    Clock::time_point start = Clock::now();
+    dist[0] = 0;
+    heap.push(0, 0);
+    while (!heap.empty()) {
+        std::pair<size_t, Key> top = heap.pop();
+        size_t u = top.first;
+        for (std::uint32_t e = g.offset[u]; e < g.offset[u + 1]; ++e) {
+            std::uint32_t v = g.target[e];
+            Key nd = top.second + g.weight[e];
+            if (nd < dist[v]) {
+                if (dist[v] == INF) {
+                    heap.push(v, nd);
+                } else {
+                    heap.decrease_key(v, nd);
+                }
+                dist[v] = nd;
+            }
+        }
+    }
+    double ns = elapsedNs(start) / g.target.size();
+    checksum = 0;
+    for (size_t i = 0; i < n; ++i) {
+        checksum += dist[i] == INF ? 0 : dist[i];
+    }
+    return ns;
+}
+
+// ---------- 输出 ----------
+
+template<typename F>
+double best3(F f) {
+    double best = 0;
+    for (int round = 0; round < 3; ++round) {
+        double t = f();
+        if (round == 0 || t < best) best = t;
+    }
+    return best;
+}
+
+static void cell(double ns) {
+    std::cout << std::fixed << std::setprecision(1) << std::setw(10) << ns;
+}
+
+static void emptyCell() {
+    std::cout << std::setw(10) << "-";
+}
+
+int main(int argc, char* argv[]) {
+    long n = argc > 1 ? std::atol(argv[1]) : 1L << 20;
+
+    std::vector<Key> keys(n);
+    std::uint64_t seed = 88172645463325252ULL;
+    for (long i = 0; i < n; ++i) {
+        keys[i] = nextRandom(seed) >> 16;
+    }
+
+    Graph g;
+    const int degree = 8;
+    g.offset.resize(n + 1);
+    for (long u = 0; u <= n; ++u) {
+        g.offset[u] = static_cast<std::uint32_t>(u * degree);
+    }
+    for (long e = 0; e < n * degree; ++e) {
+        g.target.push_back(static_cast<std::uint32_t>(nextRandom(seed) % n));
+        g.weight.push_back(static_cast<std::uint32_t>(nextRandom(seed) % 1000 + 1));
+    }
+
+    std::cout << "n = " << n << ", ns per operation (best of 3)" << std::endl;
+    std::cout << std::setw(10) << "workload" << std::setw(10) << "d2" << std::setw(10) << "d4"
+              << std::setw(10) << "pairing" << std::setw(10) << "radix" << std::setw(10) << "indexed"
+              << std::setw(10) << "std::pq" << std::endl;
+
+    std::cout << std::setw(10) << "random";
+    cell(best3([&]() { return runRandom<BinaryHeap>(keys); }));
+    cell(best3([&]() { return runRandom<QuaternaryHeap>(keys); }));
+    cell(best3([&]() { return runRandom<Pairing>(keys); }));
+    cell(best3([&]() { return runRandom<Radix>(keys); }));
+    emptyCell();
+    cell(best3([&]() { return runRandom<StdQueue>(keys); }));
+    std::cout << std::endl;
+
+    Key sums[6];
+    std::cout << std::setw(10) << "dijkstra";
+    cell(best3([&]() { return runDijkstraLazy<BinaryHeap>(g, sums[0]); }));
+    cell(best3([&]() { return runDijkstraLazy<QuaternaryHeap>(g, sums[1]); }));
+    cell(best3([&]() { return runDijkstraPairing(g, sums[2]); }));
+    cell(best3([&]() { return runDijkstraLazy<Radix>(g, sums[3]); }));
+    cell(best3([&]() { return runDijkstraIndexed(g, sums[4]); }));
+    cell(best3([&]() { return runDijkstraLazy<StdQueue>(g, sums[5]); }));
+    std::cout << std::endl;
+    for (int i = 1; i < 6; ++i) {
+        if (sums[i] != sums[0]) {
+            std::cout << "distance checksum mismatch" << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << std::setw(10) << "meld";
+    cell(best3([&]() { return runMeld<BinaryHeap>(keys); }));
+    cell(best3([&]() { return runMeld<QuaternaryHeap>(keys); }));
+    cell(best3([&]() { return runMeld<Pairing>(keys); }));
+    emptyCell();
+    emptyCell();
+    cell(best3([&]() { return runMeld<StdQueue>(keys); }));
+    std::cout << std::endl;
+    return 0;
+}
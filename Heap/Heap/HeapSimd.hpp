@@ -0,0 +1,233 @@
+#ifndef HEAP_SIMD_HPP
+#define HEAP_SIMD_HPP
+
+// d 叉堆的子节点选择内核：在连续的 4 个或 8 个兄弟节点中找出第一个最小（或最大）元素的下标。
+// 对有符号 32 位整数、float 和 double 使用 AVX2 / SSE4.1 向量化实现，
+// 运行时按 simd::level() 选择指令集，其余类型以及非 x86 平台使用标量实现。
+// 定义 HEAP_NO_SIMD 可以在编译期关闭向量化。
+
+#include <cstdint>
+#include <type_traits>
+#include "../../Simd/SimdLevel/SimdLevel.hpp"
+
+#if !defined(HEAP_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define HEAP_SIMD_X86 1
+#include <immintrin.h>
+#define HEAP_TARGET_AVX2 __attribute__((target("avx2")))
+#define HEAP_TARGET_SSE41 __attribute__((target("sse4.1")))
+#else
+#define HEAP_SIMD_X86 0
+#endif
+
+namespace heap_simd {
+
+// 指令集级别与全局开关见 Simd/SimdLevel/SimdLevel.hpp
+using simd::Level;
+using simd::LevelScalar;
+using simd::LevelSSE41;
+using simd::LevelAVX2;
+using simd::supportedLevel;
+using simd::level;
+using simd::setLevel;
+
+// 是否有向量化内核
+template<typename T>
+struct Selectable {
+    static const bool value = HEAP_SIMD_X86 &&
+        (std::is_same<T, float>::value || std::is_same<T, double>::value ||
+         (std::is_integral<T>::value && std::is_signed<T>::value && sizeof(T) == 4));
+};
+
+namespace detail {
+
+// 标量实现：严格更优才替换，保证返回第一个最优元素，与堆的标量路径一致
+template<bool Max, typename T>
+int scalarBest(const T* p, int n) {
+    int best = 0;
+    for (int i = 1; i < n; ++i) {
+        if (Max ? p[best] < p[i] : p[i] < p[best]) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+#if HEAP_SIMD_X86
+
+// 先把向量规约成所有通道都等于最优值，再找第一个等于最优值的通道。
+// 掩码为 0（只可能出现在含 NaN 的浮点数据中）时返回 -1，由调用方改用标量实现
+
+// ---------- SSE4.1 ----------
+
+template<bool Max> HEAP_TARGET_SSE41 inline __m128i pick(__m128i a, __m128i b) {
+    return Max ? _mm_max_epi32(a, b) : _mm_min_epi32(a, b);
+}
+template<bool Max> HEAP_TARGET_SSE41 inline __m128 pick(__m128 a, __m128 b) {
+    return Max ? _mm_max_ps(a, b) : _mm_min_ps(a, b);
+}
+template<bool Max> HEAP_TARGET_SSE41 inline __m128d pick(__m128d a, __m128d b) {
+    return Max ? _mm_max_pd(a, b) : _mm_min_pd(a, b);
+}
+
+template<bool Max> HEAP_TARGET_SSE41 inline __m128i reduce(__m128i m) {
+    m = pick<Max>(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+    return pick<Max>(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+}
+template<bool Max> HEAP_TARGET_SSE41 inline __m128 reduce(__m128 m) {
+    m = pick<Max>(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+    return pick<Max>(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 0, 3, 2)));
+}
+template<bool Max> HEAP_TARGET_SSE41 inline __m128d reduce(__m128d m) {
+    return pick<Max>(m, _mm_shuffle_pd(m, m, 1));
+}
+
+HEAP_TARGET_SSE41 inline __m128i load4(const int32_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+HEAP_TARGET_SSE41 inline __m128 load4(const float* p) { return _mm_loadu_ps(p); }
+HEAP_TARGET_SSE41 inline int eqMask(__m128i a, __m128i b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); }
+HEAP_TARGET_SSE41 inline int eqMask(__m128 a, __m128 b) { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+HEAP_TARGET_SSE41 inline int eqMask(__m128d a, __m128d b) { return _mm_movemask_pd(_mm_cmpeq_pd(a, b)); }
+
+// 4 个 32 位元素占一个向量，8 个占两个
+template<bool Max, typename T>
+HEAP_TARGET_SSE41 int sse41Best4(const T* p) {
+    auto v = load4(p);
+    int mask = eqMask(v, reduce<Max>(v));
+    return mask != 0 ? __builtin_ctz(mask) : -1;
+}
+
+template<bool Max, typename T>
+HEAP_TARGET_SSE41 int sse41Best8(const T* p) {
+    auto v0 = load4(p);
+    auto v1 = load4(p + 4);
+    auto m = reduce<Max>(pick<Max>(v0, v1));
+    int mask = eqMask(v0, m) | (eqMask(v1, m) << 4);
+    return mask != 0 ? __builtin_ctz(mask) : -1;
+}
+
+// double 每个向量 2 个
+template<bool Max>
+HEAP_TARGET_SSE41 int sse41BestF64(const double* p, int n) {
+    __m128d m = _mm_loadu_pd(p);
+    for (int i = 2; i < n; i += 2) {
+        m = pick<Max>(m, _mm_loadu_pd(p + i));
+    }
+    m = reduce<Max>(m);
+    int mask = 0;
+    for (int i = 0; i < n; i += 2) {
+        mask |= eqMask(_mm_loadu_pd(p + i), m) << i;
+    }
+    return mask != 0 ? __builtin_ctz(mask) : -1;
+}
+
+// ---------- AVX2 ----------
+
+template<bool Max> HEAP_TARGET_AVX2 inline __m256i pick(__m256i a, __m256i b) {
+    return Max ? _mm256_max_epi32(a, b) : _mm256_min_epi32(a, b);
+}
+template<bool Max> HEAP_TARGET_AVX2 inline __m256 pick(__m256 a, __m256 b) {
+    return Max ? _mm256_max_ps(a, b) : _mm256_min_ps(a, b);
+}
+template<bool Max> HEAP_TARGET_AVX2 inline __m256d pick(__m256d a, __m256d b) {
+    return Max ? _mm256_max_pd(a, b) : _mm256_min_pd(a, b);
+}
+
+template<bool Max> HEAP_TARGET_AVX2 inline __m256i reduce(__m256i m) {
+    m = pick<Max>(m, _mm256_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+    m = pick<Max>(m, _mm256_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+    return pick<Max>(m, _mm256_permute2x128_si256(m, m, 1));
+}
+template<bool Max> HEAP_TARGET_AVX2 inline __m256 reduce(__m256 m) {
+    m = pick<Max>(m, _mm256_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+    m = pick<Max>(m, _mm256_shuffle_ps(m, m, _MM_SHUFFLE(1, 0, 3, 2)));
+    return pick<Max>(m, _mm256_permute2f128_ps(m, m, 1));
+}
+template<bool Max> HEAP_TARGET_AVX2 inline __m256d reduce(__m256d m) {
+    m = pick<Max>(m, _mm256_shuffle_pd(m, m, 5));
+    return pick<Max>(m, _mm256_permute2f128_pd(m, m, 1));
+}
+
+HEAP_TARGET_AVX2 inline __m256i load8(const int32_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+HEAP_TARGET_AVX2 inline __m256 load8(const float* p) { return _mm256_loadu_ps(p); }
+HEAP_TARGET_AVX2 inline int eqMask(__m256i a, __m256i b) { return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))); }
+HEAP_TARGET_AVX2 inline int eqMask(__m256 a, __m256 b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)); }
+HEAP_TARGET_AVX2 inline int eqMask(__m256d a, __m256d b) { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)); }
+
+// 8 个 32 位元素正好一个向量；4 个时 SSE4.1 已经足够
+template<bool Max, typename T>
+HEAP_TARGET_AVX2 int avx2Best8(const T* p) {
+    auto v = load8(p);
+    int mask = eqMask(v, reduce<Max>(v));
+    return mask != 0 ? __builtin_ctz(mask) : -1;
+}
+
+// double 每个向量 4 个
+template<bool Max>
+HEAP_TARGET_AVX2 int avx2BestF64(const double* p, int n) {
+    __m256d m = _mm256_loadu_pd(p);
+    for (int i = 4; i < n; i += 4) {
+        m = pick<Max>(m, _mm256_loadu_pd(p + i));
+    }
+    m = reduce<Max>(m);
+    int mask = 0;
+    for (int i = 0; i < n; i += 4) {
+        mask |= eqMask(_mm256_loadu_pd(p + i), m) << i;
+    }
+    return mask != 0 ? __builtin_ctz(mask) : -1;
+}
+
+template<bool Max, typename T>
+int vectorBest(const T* p, int n, int level) {
+    if (n == 8 && level >= LevelAVX2) {
+        return avx2Best8<Max>(p);
+    }
+    if (n == 4) {
+        return sse41Best4<Max>(p);
+    }
+    return sse41Best8<Max>(p);
+}
+
+template<bool Max>
+int vectorBest(const double* p, int n, int level) {
+    if (level >= LevelAVX2) {
+        return avx2BestF64<Max>(p, n);
+    }
+    return sse41BestF64<Max>(p, n);
+}
+
+#endif // HEAP_SIMD_X86
+
+template<bool Max, typename T>
+int best(const T* p, int n, std::true_type) {
+#if HEAP_SIMD_X86
+    int level = simd::level();
+    if (level != LevelScalar && (n == 4 || n == 8)) {
+        int index = vectorBest<Max>(reinterpret_cast<const typename std::conditional<
+            std::is_integral<T>::value, int32_t, T>::type*>(p), n, level);
+        if (index >= 0) {
+            return index;
+        }
+    }
+#endif
+    return scalarBest<Max>(p, n);
+}
+
+template<bool Max, typename T>
+int best(const T* p, int n, std::false_type) {
+    return scalarBest<Max>(p, n);
+}
+
+} // namespace detail
+
+// ---------- 对外接口 ----------
+
+// 返回 p[0..n) 中第一个最小元素（Max 为 true 时为最大元素）的下标。
+// n 为 4 或 8 且元素类型可向量化时使用向量指令，否则使用标量实现
+template<bool Max, typename T>
+int best(const T* p, int n) {
+    return detail::best<Max>(p, n, std::integral_constant<bool, Selectable<T>::value>());
+}
+
+} // namespace heap_simd
+
+#endif // HEAP_SIMD_HPP
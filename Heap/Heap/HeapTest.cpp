@@ -2,6 +2,14 @@
 #include <cassert>
 #include <string>
 #include <functional>
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <cstdint>
+#include <vector>
+#include <sstream>
+#include <iterator>
+#include <thread>
 #include "Heap.hpp"
 
 void testEmptyHeap() {
@@ -131,6 +139,394 @@ void testClear() {
     std::cout << "清空操作测试通过！" << std::endl;
 }
 
+// 统计移动和复制次数的元素
+struct MoveCounter {
+    static int moves;
+    static int copies;
+    int key;
+
+    MoveCounter(int k = 0) : key(k) {}
+    MoveCounter(const MoveCounter& other) : key(other.key) { ++copies; }
+    MoveCounter(MoveCounter&& other) noexcept : key(other.key) { ++moves; }
+    MoveCounter& operator=(const MoveCounter& other) { key = other.key; ++copies; return *this; }
+    MoveCounter& operator=(MoveCounter&& other) noexcept { key = other.key; ++moves; return *this; }
+    bool operator<(const MoveCounter& other) const { return key < other.key; }
+};
+int MoveCounter::moves = 0;
+int MoveCounter::copies = 0;
+
+void testPopReturnsTop() {
+    std::cout << "测试 pop 返回堆顶..." << std::endl;
+    Heap<int> heap;
+    std::srand(2024);
+    std::vector<int> values;
+    for (int i = 0; i < 1000; ++i) {
+        int v = std::rand() % 300;   // 含重复值
+        values.push_back(v);
+        heap.push(v);
+    }
+    std::sort(values.begin(), values.end());
+    for (size_t i = 0; i < values.size(); ++i) {
+        assert(heap.top() == values[i]);
+        assert(heap.pop() == values[i]);
+    }
+    assert(heap.empty());
+
+    // 交替插入和删除
+    std::vector<int> reference;
+    for (int i = 0; i < 5000; ++i) {
+        if (reference.empty() || std::rand() % 3 != 0) {
+            int v = std::rand();
+            heap.push(v);
+            reference.push_back(v);
+        } else {
+            std::vector<int>::iterator m = std::min_element(reference.begin(), reference.end());
+            assert(heap.pop() == *m);
+            reference.erase(m);
+        }
+        assert(heap.size() == reference.size());
+    }
+
+    std::cout << "pop 返回堆顶测试通过！" << std::endl;
+}
+
+void testMoveOnlyType() {
+    std::cout << "测试只能移动的类型..." << std::endl;
+    struct PtrLess {
+        bool operator()(const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) const {
+            return *a < *b;
+        }
+    };
+    Heap<std::unique_ptr<int>, PtrLess> heap;
+    heap.push(std::unique_ptr<int>(new int(5)));
+    heap.emplace(new int(2));
+    heap.emplace(new int(8));
+    std::unique_ptr<int> p(new int(1));
+    heap.push(std::move(p));
+    assert(*heap.top() == 1);
+
+    std::unique_ptr<int> first = heap.pop();
+    assert(*first == 1 && *heap.top() == 2);
+    assert(*heap.pop() == 2 && *heap.pop() == 5 && *heap.pop() == 8);
+    assert(heap.empty());
+
+    std::vector<std::unique_ptr<int>> init;
+    for (int i = 5; i > 0; --i) {
+        init.push_back(std::unique_ptr<int>(new int(i)));
+    }
+    Heap<std::unique_ptr<int>, PtrLess> built(std::move(init));
+    assert(built.size() == 5 && *built.top() == 1);
+
+    std::cout << "只能移动的类型测试通过！" << std::endl;
+}
+
+void testMoveCount() {
+    std::cout << "测试元素移动次数..." << std::endl;
+    const int n = 1023;   // 10 层满二叉树
+    Heap<MoveCounter> heap;
+    heap.emplace(0);
+    MoveCounter::moves = 0;
+    MoveCounter::copies = 0;
+
+    // 逆序插入，每次都上浮到堆顶：移出 1 次 + 每层 1 次 + 放入 1 次（不计 vector 扩容）
+    for (int i = 1; i < n; ++i) {
+        heap.push(MoveCounter(-i));
+    }
+    assert(MoveCounter::copies == 0 && "push 右值不应复制元素");
+
+    MoveCounter::moves = 0;
+    heap.pop();
+    // 移出堆顶、移出最后一个元素、最多 9 层下移、放入、返回值（可能被省略）
+    assert(MoveCounter::moves <= 1 + 1 + 9 + 1 + 1);
+    assert(MoveCounter::copies == 0 && "pop 不应复制元素");
+
+    std::cout << "元素移动次数测试通过！" << std::endl;
+}
+
+// 检查堆性质：每个节点都不比它的父节点更应该在上面
+template<typename H, typename Compare>
+bool isHeap(const H& heap, size_t arity, Compare comp) {
+    const auto& data = heap.get_data();
+    for (size_t i = 1; i < data.size(); ++i) {
+        if (comp(data[i], data[(i - 1) / arity])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 随机插入和删除，与排序结果对照，并返回最终的存储内容
+template<typename T, typename Compare, size_t Arity, bool Aligned>
+std::vector<T> checkArity(unsigned seed) {
+    Heap<T, Compare, Arity, Aligned> heap;
+    Compare comp;
+    std::srand(seed);
+    std::vector<T> reference;
+    for (int i = 0; i < 3000; ++i) {
+        if (reference.empty() || std::rand() % 3 != 0) {
+            T v = static_cast<T>(std::rand() % 500 - 250);   // 含重复值和负数
+            heap.push(v);
+            reference.push_back(v);
+        } else {
+            std::sort(reference.begin(), reference.end(), comp);
+            assert(heap.pop() == reference.front());
+            reference.erase(reference.begin());
+        }
+    }
+    assert(heap.size() == reference.size());
+    assert(isHeap(heap, Arity, comp));
+    if (Aligned && heap.size() > 1) {
+        assert(reinterpret_cast<std::uintptr_t>(&heap.get_data()[1]) % 64 == 0 && "下标 1 应对齐到缓存行");
+    }
+    std::vector<T> result(heap.get_data().begin(), heap.get_data().end());
+
+    std::vector<T> init(reference.rbegin(), reference.rend());
+    Heap<T, Compare, Arity, Aligned> built(init);
+    assert(isHeap(built, Arity, comp));
+    std::sort(reference.begin(), reference.end(), comp);
+    for (size_t i = 0; i < reference.size(); ++i) {
+        assert(built.pop() == reference[i]);
+    }
+    return result;
+}
+
+template<typename T, typename Compare>
+void checkAllArities() {
+    checkArity<T, Compare, 2, false>(7);
+    checkArity<T, Compare, 3, false>(7);
+    checkArity<T, Compare, 4, false>(7);
+    checkArity<T, Compare, 8, false>(7);
+    checkArity<T, Compare, 4, true>(7);
+    checkArity<T, Compare, 8, true>(7);
+}
+
+// SIMD 与标量实现选出的子节点必须完全一致（有多个最优时都取第一个），堆的布局也就完全一致
+template<typename T, typename Compare, size_t Arity>
+void checkSimdMatchesScalar() {
+    heap_simd::setLevel(heap_simd::LevelScalar);
+    std::vector<T> scalar = checkArity<T, Compare, Arity, true>(11);
+    heap_simd::setLevel(heap_simd::LevelSSE41);
+    std::vector<T> sse = checkArity<T, Compare, Arity, true>(11);
+    heap_simd::setLevel(heap_simd::LevelAVX2);
+    std::vector<T> avx = checkArity<T, Compare, Arity, true>(11);
+    assert(scalar == sse && scalar == avx && "不同指令集得到的堆布局应相同");
+}
+
+void testArity() {
+    std::cout << "测试多叉堆和缓存行对齐..." << std::endl;
+
+    checkAllArities<int, std::less<int>>();
+    checkAllArities<int, std::greater<int>>();
+    checkAllArities<float, std::less<float>>();
+    checkAllArities<double, std::greater<double>>();
+    checkAllArities<long long, std::less<long long>>();   // 没有向量化内核，走标量路径
+
+    checkSimdMatchesScalar<int, std::less<int>, 4>();
+    checkSimdMatchesScalar<int, std::greater<int>, 8>();
+    checkSimdMatchesScalar<float, std::less<float>, 8>();
+    checkSimdMatchesScalar<double, std::less<double>, 4>();
+    checkSimdMatchesScalar<double, std::greater<double>, 8>();
+    heap_simd::setLevel(heap_simd::LevelAVX2);
+
+    // 自定义类型同样可以使用多叉堆
+    Heap<std::string, std::less<std::string>, 4, true> words;
+    const char* input[] = {"pear", "apple", "fig", "kiwi", "banana", "cherry"};
+    for (int i = 0; i < 6; ++i) {
+        words.emplace(input[i]);
+    }
+    assert(words.pop() == "apple" && words.pop() == "banana" && words.top() == "cherry");
+
+    std::cout << "多叉堆和缓存行对齐测试通过！" << std::endl;
+}
+
+// 弹出全部元素，返回弹出的顺序
+template<typename H>
+std::vector<typename std::decay<decltype(std::declval<H&>().pop())>::type> drain(H& heap) {
+    std::vector<typename std::decay<decltype(std::declval<H&>().pop())>::type> result;
+    while (!heap.empty()) {
+        result.push_back(heap.pop());
+    }
+    return result;
+}
+
+void testReplaceTop() {
+    std::cout << "测试替换堆顶..." << std::endl;
+    Heap<int> heap(std::vector<int>{5, 3, 8, 1, 9});
+    assert(heap.replace_top(7) == 1);
+    assert(heap.size() == 5 && heap.top() == 3);
+    assert(heap.replace_top(0) == 3);
+    assert(heap.top() == 0);
+    std::vector<int> expected = {0, 5, 7, 8, 9};
+    assert(drain(heap) == expected);
+
+    try {
+        heap.replace_top(1);
+        assert(false);  // 不应该到达这里
+    } catch (const std::runtime_error& e) {
+        // 期望抛出异常
+    }
+
+    struct PtrLess {
+        bool operator()(const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) const {
+            return *a < *b;
+        }
+    };
+    Heap<std::unique_ptr<int>, PtrLess> ptrs;
+    ptrs.push(std::unique_ptr<int>(new int(2)));
+    ptrs.push(std::unique_ptr<int>(new int(4)));
+    std::unique_ptr<int> old = ptrs.replace_top(std::unique_ptr<int>(new int(3)));
+    assert(*old == 2 && *ptrs.top() == 3);
+    std::cout << "替换堆顶测试通过！" << std::endl;
+}
+
+void testPushBounded() {
+    std::cout << "测试有界插入（Top-K）..." << std::endl;
+    std::srand(5);
+    std::vector<int> stream(20000);
+    for (size_t i = 0; i < stream.size(); ++i) {
+        stream[i] = std::rand() % 5000;   // 含重复值
+    }
+    std::vector<int> sorted(stream);
+    std::sort(sorted.begin(), sorted.end());
+
+    size_t ks[] = {0, 1, 10, 1000, 20000, 30000};
+    for (size_t k : ks) {
+        // 最小堆保留最大的 k 个
+        Heap<int> largest;
+        // 最大堆保留最小的 k 个
+        Heap<int, std::greater<int>, 4> smallest;
+        for (size_t i = 0; i < stream.size(); ++i) {
+            largest.push_bounded(stream[i], k);
+            smallest.push_bounded(stream[i], k);
+            assert(largest.size() <= k && smallest.size() <= k);
+        }
+        size_t kept = std::min(k, stream.size());
+        std::vector<int> expected_largest(sorted.end() - kept, sorted.end());
+        std::vector<int> expected_smallest(sorted.begin(), sorted.begin() + kept);
+        std::reverse(expected_smallest.begin(), expected_smallest.end());
+        assert(drain(largest) == expected_largest);
+        assert(drain(smallest) == expected_smallest);
+    }
+
+    Heap<int> heap;
+    assert(heap.push_bounded(5, 2) && heap.push_bounded(3, 2));
+    assert(!heap.push_bounded(1, 2) && "比门槛小的元素不保留");
+    assert(!heap.push_bounded(3, 2) && "与门槛相等的元素不保留");
+    assert(heap.push_bounded(4, 2) && heap.top() == 4);
+
+    // 被丢弃的元素不会被移动
+    Heap<MoveCounter> counters;
+    counters.push_bounded(MoveCounter(10), 1);
+    MoveCounter small(1);
+    int moves = MoveCounter::moves;
+    assert(!counters.push_bounded(std::move(small), 1));
+    assert(MoveCounter::moves == moves && small.key == 1);
+    std::cout << "有界插入测试通过！" << std::endl;
+}
+
+// 在已有 base 个元素的堆上批量插入 added 个元素
+template<size_t Arity>
+void checkPushRange(size_t base, size_t added, bool descending) {
+    std::vector<int> init(base);
+    std::vector<int> batch(added);
+    for (size_t i = 0; i < base; ++i) init[i] = std::rand() % 1000;
+    for (size_t i = 0; i < added; ++i) batch[i] = descending ? -static_cast<int>(i) : std::rand() % 1000;
+
+    Heap<int, std::less<int>, Arity> heap(init);
+    heap.push_range(batch.begin(), batch.end());
+    assert(heap.size() == base + added);
+    assert(isHeap(heap, Arity, std::less<int>()));
+
+    std::vector<int> expected(init);
+    expected.insert(expected.end(), batch.begin(), batch.end());
+    std::sort(expected.begin(), expected.end());
+    assert(drain(heap) == expected);
+}
+
+void testPushRange() {
+    std::cout << "测试批量插入..." << std::endl;
+    std::srand(9);
+    size_t sizes[][2] = {{0, 0}, {0, 7}, {10, 0}, {1000, 3}, {1000, 100}, {1000, 125},
+                         {1000, 400}, {1000, 999}, {1000, 1000}, {100, 5000}};
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        for (int descending = 0; descending < 2; ++descending) {
+            checkPushRange<2>(sizes[i][0], sizes[i][1], descending != 0);
+            checkPushRange<3>(sizes[i][0], sizes[i][1], descending != 0);
+            checkPushRange<8>(sizes[i][0], sizes[i][1], descending != 0);
+        }
+    }
+
+    // 只能单次遍历的输入迭代器
+    Heap<int> heap;
+    std::istringstream input("5 2 9 1");
+    heap.push_range(std::istream_iterator<int>(input), std::istream_iterator<int>());
+    std::vector<int> expected = {1, 2, 5, 9};
+    assert(drain(heap) == expected);
+    std::cout << "批量插入测试通过！" << std::endl;
+}
+
+template<typename T, typename Compare, size_t Arity, bool Aligned>
+void checkParallelBuild(size_t n, unsigned threads) {
+    std::vector<T> init(n);
+    for (size_t i = 0; i < n; ++i) init[i] = static_cast<T>(std::rand() % 100000);
+    Heap<T, Compare, Arity, Aligned> heap(init, Compare(), threads);
+    assert(heap.size() == n);
+    assert(isHeap(heap, Arity, Compare()));
+
+    std::vector<T> expected(init);
+    std::sort(expected.begin(), expected.end(), Compare());
+    assert(drain(heap) == expected);
+
+    // 接管存储的构造函数同样支持多线程
+    Heap<T, Compare, Arity, Aligned> moved(std::move(init), Compare(), threads);
+    assert(isHeap(moved, Arity, Compare()) && moved.size() == n);
+}
+
+void testParallelBuild() {
+    std::cout << "测试多线程建堆..." << std::endl;
+    std::srand(13);
+    size_t sizes[] = {0, 1, 1000, 65536, 65537, 200003};
+    unsigned threads[] = {0, 1, 2, 3, 8, 64};
+    for (size_t n : sizes) {
+        for (unsigned t : threads) {
+            checkParallelBuild<int, std::less<int>, 2, false>(n, t);
+            checkParallelBuild<int, std::greater<int>, 8, true>(n, t);
+        }
+    }
+    checkParallelBuild<double, std::less<double>, 4, true>(100000, 4);
+    checkParallelBuild<long long, std::greater<long long>, 3, false>(100000, 5);
+    std::cout << "多线程建堆测试通过！" << std::endl;
+}
+
+// 带状态的比较函数：记录比较次数，并检查总是在构造堆的线程中被调用
+struct CountingLess {
+    long* count;
+    std::thread::id owner;
+
+    bool operator()(int a, int b) const {
+        assert(std::this_thread::get_id() == owner);
+        ++*count;
+        return a < b;
+    }
+};
+
+void testDefaultSingleThreaded() {
+    std::cout << "测试默认单线程建堆..." << std::endl;
+    long count = 0;
+    CountingLess less = {&count, std::this_thread::get_id()};
+    std::vector<int> init(200000);
+    for (size_t i = 0; i < init.size(); ++i) init[i] = std::rand();
+
+    // 不指定线程数时，大数组建堆和批量插入也只在当前线程中比较
+    Heap<int, CountingLess> heap(init, less);
+    Heap<int, CountingLess> moved(std::vector<int>(init), less);
+    heap.push_range(init.begin(), init.end());
+    assert(heap.size() == 2 * init.size() && moved.size() == init.size());
+    assert(isHeap(heap, 2, less) && isHeap(moved, 2, less));
+    assert(count > 0);
+    std::cout << "默认单线程建堆测试通过！" << std::endl;
+}
+
 int main() {
     std::cout << "开始堆测试..." << std::endl;
     
@@ -140,6 +536,15 @@ int main() {
     testHeapify();
     testCustomType();
     testClear();
+    testPopReturnsTop();
+    testMoveOnlyType();
+    testMoveCount();
+    testArity();
+    testReplaceTop();
+    testPushBounded();
+    testPushRange();
+    testParallelBuild();
+    testDefaultSingleThreaded();
     
     std::cout << "所有测试通过！" << std::endl;
     return 0;
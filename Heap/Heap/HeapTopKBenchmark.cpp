@@ -0,0 +1,170 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include <functional>
+#include "Heap.hpp"
+
+// 一、数据流 Top-K：从 N 个随机 int 中取最大的 k 个，对比
+//   push-all ：全部插入最大堆，再弹出 k 个（原来的做法，堆中有 N 个元素）
+//   push-pop ：最小堆中超过 k 个元素时 push 后立即 pop
+//   bounded  ：最小堆 push_bounded，只与堆顶比较，需要时 replace-top
+// 二、批量建堆：用 n 个随机 int 建堆，对比
+//   push       ：逐个 push
+//   range 4K   ：每批 4096 个调用 push_range
+//   range 256K ：每批 2^18 个调用 push_range
+//   ctor t=1   ：Heap(const std::vector<T>&) 单线程
+//   ctor t=4   ：4 个线程
+//   ctor t=hw  ：硬件线程数
+// 用法：./HeapTopKBenchmark [N] [n]，默认 N = 10^7，n = 2^22
+
+typedef std::chrono::steady_clock Clock;
+
+static volatile long sink;
+
+static std::uint32_t nextRandom(std::uint32_t& seed) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+static double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+template<typename F>
+double best3(F f) {
+    double best = 0;
+    for (int round = 0; round < 3; ++round) {
+        double t = f();
+        if (round == 0 || t < best) best = t;
+    }
+    return best;
+}
+
+// 返回 k 个结果之和用于核对
+double topkPushAll(const std::vector<int>& stream, size_t k, long& check) {
+    Clock::time_point start = Clock::now();
+    Heap<int, std::greater<int>> heap;
+    for (size_t i = 0; i < stream.size(); ++i) {
+        heap.push(stream[i]);
+    }
+    long sum = 0;
+    for (size_t i = 0; i < k && !heap.empty(); ++i) {
+        sum += heap.pop();
+    }
+    double ms = elapsedMs(start);
+    check = sum;
+    return ms;
+}
+
+double topkPushPop(const std::vector<int>& stream, size_t k, long& check) {
+    Clock::time_point start = Clock::now();
+    Heap<int> heap;
+    for (size_t i = 0; i < stream.size(); ++i) {
+        heap.push(stream[i]);
+        if (heap.size() > k) {
+            heap.pop();
+        }
+    }
+    long sum = 0;
+    while (!heap.empty()) {
+        sum += heap.pop();
+    }
+    double ms = elapsedMs(start);
+    check = sum;
+    return ms;
+}
+
+double topkBounded(const std::vector<int>& stream, size_t k, long& check) {
+    Clock::time_point start = Clock::now();
+    Heap<int> heap;
+    for (size_t i = 0; i < stream.size(); ++i) {
+        heap.push_bounded(stream[i], k);
+    }
+    long sum = 0;
+    while (!heap.empty()) {
+        sum += heap.pop();
+    }
+    double ms = elapsedMs(start);
+    check = sum;
+    return ms;
+}
+
+double buildPush(const std::vector<int>& keys) {
+    Clock::time_point start = Clock::now();
+    Heap<int> heap;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        heap.push(keys[i]);
+    }
+    double ms = elapsedMs(start);
+    sink = sink + heap.top();
+    return ms;
+}
+
+double buildRange(const std::vector<int>& keys, size_t batch) {
+    Clock::time_point start = Clock::now();
+    Heap<int> heap;
+    for (size_t i = 0; i < keys.size(); i += batch) {
+        size_t end = i + batch < keys.size() ? i + batch : keys.size();
+        heap.push_range(keys.begin() + i, keys.begin() + end, 1);
+    }
+    double ms = elapsedMs(start);
+    sink = sink + heap.top();
+    return ms;
+}
+
+double buildCtor(const std::vector<int>& keys, unsigned threads) {
+    Clock::time_point start = Clock::now();
+    Heap<int> heap(keys, std::less<int>(), threads);
+    double ms = elapsedMs(start);
+    sink = sink + heap.top();
+    return ms;
+}
+
+int main(int argc, char* argv[]) {
+    long streamSize = argc > 1 ? std::atol(argv[1]) : 10000000L;
+    long buildSize = argc > 2 ? std::atol(argv[2]) : 1L << 22;
+
+    std::uint32_t seed = 2463534242u;
+    std::vector<int> stream(streamSize);
+    for (long i = 0; i < streamSize; ++i) {
+        stream[i] = static_cast<int>(nextRandom(seed) >> 1);
+    }
+
+    std::cout << "Top-K over " << streamSize << " random ints, ms (best of 3)" << std::endl;
+    std::cout << std::setw(10) << "k" << std::setw(12) << "push-all" << std::setw(12) << "push-pop"
+              << std::setw(12) << "bounded" << std::endl;
+    size_t ks[] = {10, 1000, 100000};
+    for (size_t k : ks) {
+        long a = 0, b = 0, c = 0;
+        double pushAll = best3([&]() { return topkPushAll(stream, k, a); });
+        double pushPop = best3([&]() { return topkPushPop(stream, k, b); });
+        double bounded = best3([&]() { return topkBounded(stream, k, c); });
+        if (a != b || a != c) {
+            std::cout << "result mismatch" << std::endl;
+            return 1;
+        }
+        std::cout << std::setw(10) << k << std::fixed << std::setprecision(1)
+                  << std::setw(12) << pushAll << std::setw(12) << pushPop << std::setw(12) << bounded << std::endl;
+    }
+
+    std::vector<int> keys(stream.begin(), stream.begin() + (buildSize < streamSize ? buildSize : streamSize));
+    unsigned hw = std::thread::hardware_concurrency();
+    std::cout << "\nBuild a heap of " << keys.size() << " random ints, ms (best of 3), "
+              << hw << " hardware threads" << std::endl;
+    std::cout << std::setw(12) << "push" << std::setw(12) << "range 4K" << std::setw(12) << "range 256K"
+              << std::setw(12) << "ctor t=1" << std::setw(12) << "ctor t=4" << std::setw(12) << "ctor t=hw" << std::endl;
+    std::cout << std::fixed << std::setprecision(1)
+              << std::setw(12) << best3([&]() { return buildPush(keys); })
+              << std::setw(12) << best3([&]() { return buildRange(keys, 4096); })
+              << std::setw(12) << best3([&]() { return buildRange(keys, 1 << 18); })
+              << std::setw(12) << best3([&]() { return buildCtor(keys, 1); })
+              << std::setw(12) << best3([&]() { return buildCtor(keys, 4); })
+              << std::setw(12) << best3([&]() { return buildCtor(keys, 0); }) << std::endl;
+    return 0;
+}
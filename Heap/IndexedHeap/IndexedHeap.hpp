@@ -0,0 +1,322 @@
+#ifndef INDEXED_HEAP_HPP
+#define INDEXED_HEAP_HPP
+
+#include <vector>
+#include <stdexcept>
+#include <functional>
+#include <utility>
+#include <cstddef>
+
+/**
+ * @brief 索引堆（可寻址的优先队列）
+ * @tparam Key 优先级类型
+ * @tparam Compare 比较函数对象，comp(a, b) 为 true 表示 a 应在 b 之上，默认为最小堆
+ * @tparam Arity 每个节点的子节点数，默认为二叉堆
+ * @details 每个元素由外部编号 id（0 ~ capacity-1，例如图的顶点编号）标识，
+ * 另外维护 id 到堆中位置的映射，因此可以在 O(log n) 时间内修改或删除任意元素，
+ * 适用于 Dijkstra、Prim 等需要 decrease-key 的算法
+ */
+template<typename Key, typename Compare = std::less<Key>, size_t Arity = 2>
+class IndexedHeap {
+    static_assert(Arity >= 2, "Arity must be at least 2");
+
+private:
+    static const size_t NONE = static_cast<size_t>(-1);   // 不在堆中的 id 的位置
+
+    struct Entry {
+        Key key;
+        size_t id;
+
+        Entry(const Key& k, size_t i) : key(k), id(i) {}
+    };
+
+    std::vector<Entry> data;     // 堆数组，优先级与 id 放在一起，比较时不必再查表
+    std::vector<size_t> pos;     // pos[id] 为 id 在堆数组中的位置，不在堆中时为 NONE
+    Compare comp;                // 比较函数对象
+
+    size_t parent(size_t index) const {
+        return (index - 1) / Arity;
+    }
+
+    size_t first_child(size_t index) const {
+        return Arity * index + 1;
+    }
+
+    /**
+     * @brief 把元素放到位置 index，并更新它的位置映射
+     */
+    void place(size_t index, Entry&& entry) {
+        pos[entry.id] = index;
+        data[index] = std::move(entry);
+    }
+
+    /**
+     * @brief 向上调整堆（空位法，每层一次移动）
+     * @param index 需要向上调整的位置
+     * @time O(log n)
+     */
+    void sift_up(size_t index) {
+        Entry entry = std::move(data[index]);
+        while (index > 0 && comp(entry.key, data[parent(index)].key)) {
+            place(index, std::move(data[parent(index)]));
+            index = parent(index);
+        }
+        place(index, std::move(entry));
+    }
+
+    /**
+     * @brief 向下调整堆（空位法，每层一次移动）
+     * @param index 需要向下调整的位置
+     * @time O(log n)
+     */
+    void sift_down(size_t index) {
+        size_t n = data.size();
+        Entry entry = std::move(data[index]);
+        while (first_child(index) < n) {
+            size_t first = first_child(index);
+            size_t last = first + Arity < n ? first + Arity : n;
+            size_t best = first;
+            for (size_t i = first + 1; i < last; ++i) {
+                if (comp(data[i].key, data[best].key)) {
+                    best = i;
+                }
+            }
+            if (!comp(data[best].key, entry.key)) {
+                break;
+            }
+            place(index, std::move(data[best]));
+            index = best;
+        }
+        place(index, std::move(entry));
+    }
+
+    /**
+     * @brief 删除位置 index 上的元素，用最后一个元素填补
+     * @time O(log n)
+     */
+    void remove_at(size_t index) {
+        pos[data[index].id] = NONE;
+        size_t lastIndex = data.size() - 1;
+        if (index != lastIndex) {
+            data[index] = std::move(data[lastIndex]);
+            data.pop_back();
+            pos[data[index].id] = index;
+            // 填补进来的元素可能需要上浮，也可能需要下沉
+            if (index > 0 && comp(data[index].key, data[parent(index)].key)) {
+                sift_up(index);
+            } else {
+                sift_down(index);
+            }
+        } else {
+            data.pop_back();
+        }
+    }
+
+    void check_id(size_t id) const {
+        if (id >= pos.size()) {
+            throw std::out_of_range("id 超出范围");
+        }
+    }
+
+    /**
+     * @brief 返回 id 在堆中的位置，不在堆中时抛出异常
+     */
+    size_t position(size_t id) const {
+        check_id(id);
+        if (pos[id] == NONE) {
+            throw std::invalid_argument("id 不在堆中");
+        }
+        return pos[id];
+    }
+
+public:
+    /**
+     * @brief 构造函数
+     * @param capacity id 的取值范围为 [0, capacity)
+     * @param compare 比较函数对象
+     */
+    explicit IndexedHeap(size_t capacity = 0, const Compare& compare = Compare())
+        : pos(capacity, NONE), comp(compare) {
+        data.reserve(capacity);
+    }
+
+    /**
+     * @brief id 的取值范围 [0, capacity())
+     */
+    size_t capacity() const {
+        return pos.size();
+    }
+
+    /**
+     * @brief 扩大 id 的取值范围，已有元素不变
+     * @param capacity 新的取值范围，小于当前范围时不做任何事
+     */
+    void reserve(size_t capacity) {
+        if (capacity > pos.size()) {
+            pos.resize(capacity, NONE);
+        }
+    }
+
+    /**
+     * @brief 插入元素
+     * @param id 元素编号
+     * @param key 优先级
+     * @throw std::out_of_range 如果 id 超出范围
+     * @throw std::invalid_argument 如果 id 已在堆中
+     * @time O(log n)
+     */
+    void push(size_t id, const Key& key) {
+        check_id(id);
+        if (pos[id] != NONE) {
+            throw std::invalid_argument("id 已在堆中");
+        }
+        data.push_back(Entry(key, id));
+        pos[id] = data.size() - 1;
+        sift_up(data.size() - 1);
+    }
+
+    /**
+     * @brief 删除并返回堆顶元素
+     * @return 堆顶元素的 id 和优先级
+     * @throw std::runtime_error 如果堆为空
+     * @time O(log n)
+     */
+    std::pair<size_t, Key> pop() {
+        if (empty()) {
+            throw std::runtime_error("堆为空");
+        }
+        std::pair<size_t, Key> result(data[0].id, std::move(data[0].key));
+        remove_at(0);
+        return result;
+    }
+
+    /**
+     * @brief 获取堆顶元素的优先级
+     * @throw std::runtime_error 如果堆为空
+     * @time O(1)
+     */
+    const Key& top() const {
+        if (empty()) {
+            throw std::runtime_error("堆为空");
+        }
+        return data[0].key;
+    }
+
+    /**
+     * @brief 获取堆顶元素的 id
+     * @throw std::runtime_error 如果堆为空
+     * @time O(1)
+     */
+    size_t top_id() const {
+        if (empty()) {
+            throw std::runtime_error("堆为空");
+        }
+        return data[0].id;
+    }
+
+    /**
+     * @brief 判断 id 是否在堆中
+     * @time O(1)
+     */
+    bool contains(size_t id) const {
+        return id < pos.size() && pos[id] != NONE;
+    }
+
+    /**
+     * @brief 获取 id 的优先级
+     * @throw std::out_of_range / std::invalid_argument 如果 id 超出范围或不在堆中
+     * @time O(1)
+     */
+    const Key& key(size_t id) const {
+        return data[position(id)].key;
+    }
+
+    /**
+     * @brief 把 id 的优先级改为更靠前的 key（最小堆中即减小）
+     * @throw std::invalid_argument 如果 id 不在堆中，或 key 比原优先级更靠后
+     * @time O(log n)
+     */
+    void decrease_key(size_t id, const Key& key) {
+        size_t index = position(id);
+        if (comp(data[index].key, key)) {
+            throw std::invalid_argument("新的优先级比原来更靠后");
+        }
+        data[index].key = key;
+        sift_up(index);
+    }
+
+    /**
+     * @brief 把 id 的优先级改为更靠后的 key（最小堆中即增大）
+     * @throw std::invalid_argument 如果 id 不在堆中，或 key 比原优先级更靠前
+     * @time O(log n)
+     */
+    void increase_key(size_t id, const Key& key) {
+        size_t index = position(id);
+        if (comp(key, data[index].key)) {
+            throw std::invalid_argument("新的优先级比原来更靠前");
+        }
+        data[index].key = key;
+        sift_down(index);
+    }
+
+    /**
+     * @brief 修改 id 的优先级，方向不限
+     * @throw std::invalid_argument 如果 id 不在堆中
+     * @time O(log n)
+     */
+    void update(size_t id, const Key& key) {
+        size_t index = position(id);
+        bool up = comp(key, data[index].key);
+        data[index].key = key;
+        if (up) {
+            sift_up(index);
+        } else {
+            sift_down(index);
+        }
+    }
+
+    /**
+     * @brief 删除 id
+     * @return id 在堆中时返回 true，否则返回 false
+     * @time O(log n)
+     */
+    bool erase(size_t id) {
+        if (!contains(id)) {
+            return false;
+        }
+        remove_at(pos[id]);
+        return true;
+    }
+
+    /**
+     * @brief 检查堆是否为空
+     * @time O(1)
+     */
+    bool empty() const {
+        return data.empty();
+    }
+
+    /**
+     * @brief 获取堆中元素个数
+     * @time O(1)
+     */
+    size_t size() const {
+        return data.size();
+    }
+
+    /**
+     * @brief 清空堆，id 的取值范围不变
+     * @time O(n)
+     */
+    void clear() {
+        for (size_t i = 0; i < data.size(); ++i) {
+            pos[data[i].id] = NONE;
+        }
+        data.clear();
+    }
+};
+
+template<typename Key, typename Compare, size_t Arity>
+const size_t IndexedHeap<Key, Compare, Arity>::NONE;
+
+#endif // INDEXED_HEAP_HPP
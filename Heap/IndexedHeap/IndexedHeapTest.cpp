@@ -0,0 +1,205 @@
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <functional>
+#include "IndexedHeap.hpp"
+
+void testBasicOperations() {
+    std::cout << "测试基本操作..." << std::endl;
+    IndexedHeap<int> heap(10);
+
+    assert(heap.empty() && heap.size() == 0 && heap.capacity() == 10);
+    heap.push(3, 30);
+    heap.push(7, 10);
+    heap.push(1, 20);
+    assert(heap.size() == 3);
+    assert(heap.top() == 10 && heap.top_id() == 7);
+    assert(heap.contains(3) && heap.contains(7) && !heap.contains(0) && !heap.contains(100));
+    assert(heap.key(1) == 20);
+
+    std::pair<size_t, int> top = heap.pop();
+    assert(top.first == 7 && top.second == 10);
+    assert(!heap.contains(7));
+    assert(heap.top_id() == 1);
+
+    // 弹出后 id 可以再次插入
+    heap.push(7, 5);
+    assert(heap.top_id() == 7);
+
+    heap.clear();
+    assert(heap.empty() && !heap.contains(1) && !heap.contains(3));
+    heap.push(3, 1);
+    assert(heap.top_id() == 3);
+
+    std::cout << "基本操作测试通过！" << std::endl;
+}
+
+void testKeyUpdates() {
+    std::cout << "测试修改优先级..." << std::endl;
+    IndexedHeap<int> heap(5);
+    for (int i = 0; i < 5; ++i) {
+        heap.push(i, 10 * (i + 1));   // 10 20 30 40 50
+    }
+
+    heap.decrease_key(4, 5);
+    assert(heap.top_id() == 4 && heap.key(4) == 5);
+    heap.increase_key(4, 35);
+    assert(heap.top_id() == 0);
+    heap.increase_key(0, 100);
+    assert(heap.top_id() == 1);
+    heap.update(0, 1);
+    assert(heap.top_id() == 0);
+    heap.update(0, 25);
+    assert(heap.top_id() == 1);
+
+    assert(heap.erase(1));
+    assert(!heap.erase(1));
+    assert(heap.top_id() == 0);
+
+    int order[] = {0, 2, 4, 3};   // 25 30 35 40
+    for (int i = 0; i < 4; ++i) {
+        assert(heap.pop().first == static_cast<size_t>(order[i]));
+    }
+    assert(heap.empty());
+
+    std::cout << "修改优先级测试通过！" << std::endl;
+}
+
+void testErrors() {
+    std::cout << "测试异常处理..." << std::endl;
+    IndexedHeap<int> heap(3);
+
+    bool thrown = false;
+    try { heap.pop(); } catch (const std::runtime_error&) { thrown = true; }
+    assert(thrown && "空堆 pop 应抛出异常");
+
+    thrown = false;
+    try { heap.top(); } catch (const std::runtime_error&) { thrown = true; }
+    assert(thrown && "空堆 top 应抛出异常");
+
+    thrown = false;
+    try { heap.push(3, 1); } catch (const std::out_of_range&) { thrown = true; }
+    assert(thrown && "id 超出范围应抛出异常");
+
+    heap.push(0, 10);
+    thrown = false;
+    try { heap.push(0, 5); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown && "重复插入应抛出异常");
+
+    thrown = false;
+    try { heap.decrease_key(0, 20); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown && "decrease_key 不能增大优先级");
+
+    thrown = false;
+    try { heap.increase_key(0, 5); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown && "increase_key 不能减小优先级");
+
+    thrown = false;
+    try { heap.decrease_key(1, 5); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown && "不在堆中的 id 不能修改优先级");
+
+    heap.reserve(10);
+    heap.push(9, 1);
+    assert(heap.capacity() == 10 && heap.top_id() == 9);
+
+    std::cout << "异常处理测试通过！" << std::endl;
+}
+
+// 随机操作，与逐个扫描的朴素实现对照
+template<typename Compare, size_t Arity>
+void checkRandom(unsigned seed) {
+    const int n = 200;
+    IndexedHeap<int, Compare, Arity> heap(n);
+    Compare comp;
+    std::vector<int> keys(n);
+    std::vector<bool> present(n, false);
+    std::srand(seed);
+    for (int step = 0; step < 20000; ++step) {
+        int id = std::rand() % n;
+        int key = std::rand() % 1000;
+        switch (std::rand() % 5) {
+        case 0:
+            if (!present[id]) {
+                heap.push(id, key);
+                keys[id] = key;
+                present[id] = true;
+            }
+            break;
+        case 1:
+            if (present[id]) {
+                heap.update(id, key);
+                keys[id] = key;
+            }
+            break;
+        case 2:
+            if (present[id] && !comp(keys[id], key)) {
+                heap.decrease_key(id, key);
+                keys[id] = key;
+            } else if (present[id]) {
+                heap.increase_key(id, key);
+                keys[id] = key;
+            }
+            break;
+        case 3:
+            assert(heap.erase(id) == present[id]);
+            present[id] = false;
+            break;
+        default:
+            if (!heap.empty()) {
+                std::pair<size_t, int> top = heap.pop();
+                assert(present[top.first] && keys[top.first] == top.second);
+                for (int i = 0; i < n; ++i) {
+                    assert(!present[i] || !comp(keys[i], top.second));
+                }
+                present[top.first] = false;
+            }
+            break;
+        }
+        size_t count = 0;
+        for (int i = 0; i < n; ++i) {
+            assert(heap.contains(i) == present[i]);
+            if (present[i]) {
+                assert(heap.key(i) == keys[i]);
+                ++count;
+            }
+        }
+        assert(heap.size() == count);
+    }
+}
+
+void testRandomOperations() {
+    std::cout << "测试随机操作..." << std::endl;
+    checkRandom<std::less<int>, 2>(1);
+    checkRandom<std::greater<int>, 2>(2);
+    checkRandom<std::less<int>, 4>(3);
+    checkRandom<std::less<int>, 8>(4);
+    std::cout << "随机操作测试通过！" << std::endl;
+}
+
+void testStringKeys() {
+    std::cout << "测试字符串优先级..." << std::endl;
+    IndexedHeap<std::string> heap(3);
+    heap.push(0, "pear");
+    heap.push(1, "apple");
+    heap.push(2, "fig");
+    heap.decrease_key(0, "banana");
+    assert(heap.pop().second == "apple");
+    assert(heap.pop().first == 0);
+    assert(heap.pop().second == "fig");
+    std::cout << "字符串优先级测试通过！" << std::endl;
+}
+
+int main() {
+    std::cout << "开始索引堆测试..." << std::endl;
+
+    testBasicOperations();
+    testKeyUpdates();
+    testErrors();
+    testRandomOperations();
+    testStringKeys();
+
+    std::cout << "所有测试通过！" << std::endl;
+    return 0;
+}
@@ -0,0 +1,187 @@
+#ifndef MULTI_QUEUE_HPP
+#define MULTI_QUEUE_HPP
+
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <stdexcept>
+#include <functional>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include "../Heap/Heap.hpp"
+
+/**
+ * @brief 松弛的并发优先队列（MultiQueue）
+ * @tparam T 元素类型
+ * @tparam Compare 比较函数对象，comp(a, b) 为 true 表示 a 应先出队，默认为最小堆
+ * @tparam Arity 内部每个 Heap 的叉数
+ * @details 由 c·P 个各自带锁的 Heap 组成（P 为线程数，c 为松弛系数）：
+ * - push：随机选一个队列，try_lock 成功就插入，失败就换一个
+ * - try_pop：随机选两个队列，都锁住后从堆顶更优的那个弹出（best of two）
+ * 线程几乎不会争用同一把锁，代价是弹出的不一定是全局最优的元素。
+ * 弹出元素的排名误差（全局比它更优的元素个数）期望为 O(c·P)，c 越大争用越少、误差越大
+ */
+template<typename T, typename Compare = std::less<T>, size_t Arity = 2>
+class MultiQueue {
+private:
+    static const size_t CACHE_LINE = 64;
+
+    struct Queue {
+        std::mutex lock;
+        Heap<T, Compare, Arity> heap;
+        char padding[CACHE_LINE];   // 相邻队列的锁和堆不落在同一缓存行上
+    };
+
+    std::unique_ptr<Queue[]> queues;     // 各个队列
+    size_t queue_num;                    // 队列个数
+    std::atomic<size_t> element_num;     // 元素个数（近似）
+    Compare comp;                        // 比较函数对象
+
+    /**
+     * @brief 线程私有的 xorshift 随机数
+     */
+    static std::uint64_t next_random() {
+        static thread_local std::uint64_t seed = 0x9E3779B97F4A7C15ULL ^
+            reinterpret_cast<std::uintptr_t>(&seed);
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        return seed;
+    }
+
+    size_t random_queue() const {
+        return static_cast<size_t>(next_random() % queue_num);
+    }
+
+    template<typename U>
+    void push_impl(U&& value) {
+        for (;;) {
+            Queue& q = queues[random_queue()];
+            std::unique_lock<std::mutex> guard(q.lock, std::try_to_lock);
+            if (guard.owns_lock()) {
+                q.heap.push(std::forward<U>(value));
+                // 在锁内计数：弹出这个元素的线程要先拿到同一把锁，
+                // 它的 fetch_sub 一定排在这次 fetch_add 之后，计数不会减到 0 以下
+                element_num.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief 从已锁住的堆中弹出堆顶，计数同样在锁内减少
+     */
+    bool pop_from(Heap<T, Compare, Arity>& heap, T& out) {
+        out = heap.pop();
+        element_num.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+public:
+    /**
+     * @brief 构造函数
+     * @param threads 预计同时访问的线程数 P
+     * @param factor 松弛系数 c，队列个数为 c·P
+     * @param compare 比较函数对象
+     * @throw std::invalid_argument 如果 threads 或 factor 为 0
+     */
+    explicit MultiQueue(size_t threads, size_t factor = 2, const Compare& compare = Compare())
+        : queue_num(threads * factor), element_num(0), comp(compare) {
+        if (threads == 0 || factor == 0) {
+            throw std::invalid_argument("线程数和松弛系数必须大于 0");
+        }
+        queues.reset(new Queue[queue_num]);
+        for (size_t i = 0; i < queue_num; ++i) {
+            queues[i].heap = Heap<T, Compare, Arity>(compare);
+        }
+    }
+
+    /**
+     * @brief 插入元素，线程安全
+     * @time O(log n)，n 为单个队列中的元素个数
+     */
+    void push(const T& value) {
+        push_impl(value);
+    }
+
+    /**
+     * @brief 插入元素（移动），线程安全
+     */
+    void push(T&& value) {
+        push_impl(std::move(value));
+    }
+
+    /**
+     * @brief 弹出一个接近最优的元素，线程安全
+     * @param out 接收弹出的元素
+     * @return 成功弹出返回 true；所有队列都为空时返回 false
+     * @details 随机选两个队列，都锁住后从堆顶更优的那个弹出；任一个锁被占用就重新选，
+     * 重试 queue_count() 次后不再挑选。两个队列都为空（或一直抢不到锁）时，
+     * 从随机位置开始依次锁住每个队列，弹出第一个非空队列的堆顶
+     * @time O(log n)
+     */
+    bool try_pop(T& out) {
+        if (queue_num >= 2) {
+            for (size_t attempt = 0; attempt < queue_num; ++attempt) {
+                size_t a = random_queue();
+                size_t b = random_queue();
+                if (a == b) {
+                    b = (b + 1) % queue_num;
+                }
+                std::unique_lock<std::mutex> lock_a(queues[a].lock, std::try_to_lock);
+                if (!lock_a.owns_lock()) {
+                    continue;
+                }
+                std::unique_lock<std::mutex> lock_b(queues[b].lock, std::try_to_lock);
+                if (!lock_b.owns_lock()) {
+                    continue;
+                }
+                Heap<T, Compare, Arity>& ha = queues[a].heap;
+                Heap<T, Compare, Arity>& hb = queues[b].heap;
+                if (ha.empty() && hb.empty()) {
+                    break;
+                }
+                if (hb.empty() || (!ha.empty() && !comp(hb.top(), ha.top()))) {
+                    return pop_from(ha, out);
+                }
+                return pop_from(hb, out);
+            }
+        }
+
+        size_t start = random_queue();
+        for (size_t i = 0; i < queue_num; ++i) {
+            Queue& q = queues[(start + i) % queue_num];
+            std::lock_guard<std::mutex> guard(q.lock);
+            if (!q.heap.empty()) {
+                return pop_from(q.heap, out);
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief 元素个数，有其他线程同时插入或弹出时只是近似值
+     * @time O(1)
+     */
+    size_t size() const {
+        return element_num.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 是否为空，有其他线程同时插入或弹出时只是近似值
+     * @time O(1)
+     */
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief 内部队列的个数 c·P
+     */
+    size_t queue_count() const {
+        return queue_num;
+    }
+};
+
+#endif // MULTI_QUEUE_HPP
@@ -0,0 +1,225 @@
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "MultiQueue.hpp"
+
+// 扩展性测试：t 个线程（t = 1, 2, 4, ... N）共用一个优先队列，每个线程随机执行
+// 50% push（[0, 2^20) 内的随机键）和 50% try_pop，队列预先填入 2^18 个元素。对比
+//   locked ：一个 Heap + 全局 std::mutex（原来调度器的做法）
+//   MQ c=2 / MQ c=4 ：MultiQueue，松弛系数 2 / 4
+// 吞吐量：百万次操作/秒。
+// 排名误差：另跑一轮，每次操作完成后从全局计数器取一个序号并记录下来，按序号重放，
+// 统计每次弹出时队列中比弹出元素更小的元素个数（平均值 / 最大值）。
+// 序号在锁外获取，与真实的操作顺序略有出入，locked 一列即为这种测量方法本身的误差。
+// ideal c=2 为单线程使用同样多（2t 个）队列时的排名误差，即 MultiQueue 本身的松弛程度，
+// 不受线程调度影响；线程数超过 CPU 核数时，持锁的线程被切换出去会让那个队列停滞一个时间片，
+// 实测误差会明显大于这一列。
+// 用法：./MultiQueueBenchmark [最大线程数 N] [每轮总操作数]，默认 N = 64，2^21 次操作
+
+typedef std::chrono::steady_clock Clock;
+
+static const int KEY_BITS = 20;
+static const int PREFILL = 1 << 18;
+
+static volatile long sink;
+
+// 与 MultiQueue 相同接口的加锁堆
+class LockedHeap {
+private:
+    Heap<int> heap;
+    std::mutex mtx;
+
+public:
+    LockedHeap(size_t, size_t) {}
+
+    void push(int value) {
+        std::lock_guard<std::mutex> lock(mtx);
+        heap.push(value);
+    }
+
+    bool try_pop(int& out) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (heap.empty()) {
+            return false;
+        }
+        out = heap.pop();
+        return true;
+    }
+};
+
+static std::uint32_t nextRandom(std::uint32_t& seed) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+struct Event {
+    std::uint64_t ticket;
+    int key;
+    bool pop;
+
+    bool operator<(const Event& other) const {
+        return ticket < other.ticket;
+    }
+};
+
+struct Result {
+    double mops;
+    double meanRank;
+    long maxRank;
+};
+
+// 在键上计数的树状数组，用来求比某个键小的元素个数
+class Fenwick {
+private:
+    std::vector<long> tree;
+
+public:
+    explicit Fenwick(size_t n) : tree(n + 1, 0) {}
+
+    void add(int key, long delta) {
+        for (size_t i = static_cast<size_t>(key) + 1; i < tree.size(); i += i & (~i + 1)) {
+            tree[i] += delta;
+        }
+    }
+
+    // 键小于 key 的元素个数
+    long less(int key) const {
+        long sum = 0;
+        for (size_t i = static_cast<size_t>(key); i > 0; i -= i & (~i + 1)) {
+            sum += tree[i];
+        }
+        return sum;
+    }
+};
+
+template<typename Queue>
+Result run(int threads, size_t factor, long totalOps, bool record) {
+    Queue queue(threads, factor);
+    std::uint32_t seed = 2463534242u;
+    std::vector<int> prefill(PREFILL);
+    for (int i = 0; i < PREFILL; ++i) {
+        prefill[i] = static_cast<int>(nextRandom(seed) >> (32 - KEY_BITS));
+        queue.push(prefill[i]);
+    }
+
+    long opsPerThread = totalOps / threads;
+    std::atomic<std::uint64_t> ticket(0);
+    std::vector<std::vector<Event>> logs(threads);
+    std::atomic<bool> go(false);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.push_back(std::thread([&, t]() {
+            std::uint32_t local = 88675123u + 7919u * t;
+            std::vector<Event>& log = logs[t];
+            if (record) {
+                log.reserve(opsPerThread);
+            }
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            long sum = 0;
+            for (long i = 0; i < opsPerThread; ++i) {
+                std::uint32_t r = nextRandom(local);
+                if (r & 1) {
+                    int key = static_cast<int>(r >> (32 - KEY_BITS));
+                    queue.push(key);
+                    if (record) {
+                        Event e = {ticket.fetch_add(1), key, false};
+                        log.push_back(e);
+                    }
+                } else {
+                    int out;
+                    if (queue.try_pop(out)) {
+                        sum += out;
+                        if (record) {
+                            Event e = {ticket.fetch_add(1), out, true};
+                            log.push_back(e);
+                        }
+                    }
+                }
+            }
+            sink = sink + sum;
+        }));
+    }
+    Clock::time_point start = Clock::now();
+    go.store(true);
+    for (size_t i = 0; i < workers.size(); ++i) {
+        workers[i].join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    Result result = {opsPerThread * threads / seconds / 1e6, 0, 0};
+    if (!record) {
+        return result;
+    }
+    std::vector<Event> events;
+    for (int t = 0; t < threads; ++t) {
+        events.insert(events.end(), logs[t].begin(), logs[t].end());
+    }
+    std::sort(events.begin(), events.end());
+    Fenwick present(1 << KEY_BITS);
+    for (int i = 0; i < PREFILL; ++i) {
+        present.add(prefill[i], 1);
+    }
+    long pops = 0;
+    double rankSum = 0;
+    for (size_t i = 0; i < events.size(); ++i) {
+        if (events[i].pop) {
+            long rank = std::max(0L, present.less(events[i].key));
+            rankSum += rank;
+            result.maxRank = std::max(result.maxRank, rank);
+            ++pops;
+            present.add(events[i].key, -1);
+        } else {
+            present.add(events[i].key, 1);
+        }
+    }
+    result.meanRank = pops == 0 ? 0 : rankSum / pops;
+    return result;
+}
+
+int main(int argc, char* argv[]) {
+    int maxThreads = argc > 1 ? std::atoi(argv[1]) : 64;
+    long totalOps = argc > 2 ? std::atol(argv[2]) : 1L << 21;
+    if (maxThreads < 1) {
+        maxThreads = 1;
+    }
+
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency()
+              << ", prefill: " << PREFILL << ", ops per run: " << totalOps << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(10) << "locked" << std::setw(10) << "MQ c=2"
+              << std::setw(10) << "MQ c=4" << "   |" << std::setw(14) << "rank locked"
+              << std::setw(14) << "rank c=2" << std::setw(14) << "rank c=4"
+              << std::setw(14) << "ideal c=2" << std::endl;
+    std::cout << std::setw(8) << "" << std::setw(30) << "Mops/s" << "   |"
+              << std::setw(56) << "mean / max" << std::endl;
+    for (int t = 1; t <= maxThreads; t *= 2) {
+        Result locked = run<LockedHeap>(t, 1, totalOps, false);
+        Result mq2 = run<MultiQueue<int>>(t, 2, totalOps, false);
+        Result mq4 = run<MultiQueue<int>>(t, 4, totalOps, false);
+        Result lockedRank = run<LockedHeap>(t, 1, totalOps, true);
+        Result mq2Rank = run<MultiQueue<int>>(t, 2, totalOps, true);
+        Result mq4Rank = run<MultiQueue<int>>(t, 4, totalOps, true);
+        Result ideal = run<MultiQueue<int>>(1, 2 * t, totalOps, true);
+        std::cout << std::setw(8) << t << std::fixed << std::setprecision(2)
+                  << std::setw(10) << locked.mops << std::setw(10) << mq2.mops << std::setw(10) << mq4.mops
+                  << "   |" << std::setprecision(1)
+                  << std::setw(8) << lockedRank.meanRank << " /" << std::setw(4) << lockedRank.maxRank
+                  << std::setw(8) << mq2Rank.meanRank << " /" << std::setw(4) << mq2Rank.maxRank
+                  << std::setw(8) << mq4Rank.meanRank << " /" << std::setw(4) << mq4Rank.maxRank
+                  << std::setw(8) << ideal.meanRank << " /" << std::setw(4) << ideal.maxRank << std::endl;
+        if (t < maxThreads && t * 2 > maxThreads) {
+            t = maxThreads / 2;   // 最后一轮使用 maxThreads
+        }
+    }
+    return 0;
+}
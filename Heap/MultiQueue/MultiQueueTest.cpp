@@ -0,0 +1,163 @@
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include "MultiQueue.hpp"
+
+void testInvalidArguments() {
+    std::cout << "测试参数检查..." << std::endl;
+    bool thrown = false;
+    try { MultiQueue<int> q(0); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown && "线程数为 0 应抛出异常");
+
+    thrown = false;
+    try { MultiQueue<int> q(4, 0); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown && "松弛系数为 0 应抛出异常");
+
+    MultiQueue<int> q(4, 3);
+    assert(q.queue_count() == 12 && q.empty() && q.size() == 0);
+    int out = -1;
+    assert(!q.try_pop(out) && out == -1);
+    std::cout << "参数检查测试通过！" << std::endl;
+}
+
+void testExactWithFewQueues() {
+    std::cout << "测试单队列和双队列..." << std::endl;
+    // 1 个队列就是普通的堆；2 个队列时每次都比较两个堆顶，结果也是精确的
+    for (size_t factor = 1; factor <= 2; ++factor) {
+        MultiQueue<int> q(1, factor);
+        std::srand(3);
+        std::vector<int> values;
+        for (int i = 0; i < 2000; ++i) {
+            int v = std::rand() % 500;
+            q.push(v);
+            values.push_back(v);
+        }
+        assert(q.size() == 2000);
+        std::sort(values.begin(), values.end());
+        for (size_t i = 0; i < values.size(); ++i) {
+            int out;
+            assert(q.try_pop(out) && out == values[i]);
+        }
+        int out;
+        assert(q.empty() && !q.try_pop(out));
+    }
+
+    MultiQueue<int, std::greater<int>> max_queue(1, 2);
+    max_queue.push(1);
+    max_queue.push(3);
+    max_queue.push(2);
+    int out;
+    assert(max_queue.try_pop(out) && out == 3);
+    std::cout << "单队列和双队列测试通过！" << std::endl;
+}
+
+void testRelaxedOrder() {
+    std::cout << "测试松弛的出队顺序..." << std::endl;
+    // 单线程下检查每个元素恰好弹出一次，且排名误差远小于元素个数
+    MultiQueue<int> q(8, 2);
+    const int n = 20000;
+    std::vector<int> values(n);
+    for (int i = 0; i < n; ++i) values[i] = i;
+    std::srand(5);
+    std::random_shuffle(values.begin(), values.end());
+    for (int i = 0; i < n; ++i) q.push(values[i]);
+
+    std::vector<bool> popped(n, false);
+    int smallest = 0;          // 尚未弹出的最小元素
+    long total_error = 0;
+    int out;
+    while (q.try_pop(out)) {
+        assert(!popped[out]);
+        popped[out] = true;
+        total_error += out - smallest;   // 元素各不相同，比它小且未弹出的元素不超过 out - smallest 个
+        while (smallest < n && popped[smallest]) ++smallest;
+    }
+    assert(smallest == n && q.empty());
+    double mean_error = static_cast<double>(total_error) / n;
+    assert(mean_error < 10.0 * q.queue_count());
+
+    // 只能移动的元素类型
+    struct PtrLess {
+        bool operator()(const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) const {
+            return *a < *b;
+        }
+    };
+    MultiQueue<std::unique_ptr<int>, PtrLess> ptrs(2);
+    ptrs.push(std::unique_ptr<int>(new int(7)));
+    std::unique_ptr<int> p;
+    assert(ptrs.try_pop(p) && *p == 7);
+    std::cout << "松弛出队测试通过！平均排名误差 " << mean_error << std::endl;
+}
+
+void testConcurrent() {
+    std::cout << "测试多线程插入和弹出..." << std::endl;
+    const int threads = 8;
+    const int per_thread = 20000;
+    MultiQueue<int> q(threads, 2);
+    std::vector<std::atomic<int>> seen(threads * per_thread);
+    for (size_t i = 0; i < seen.size(); ++i) seen[i].store(0);
+    std::atomic<int> popped(0);
+
+    // 一半线程只插入，另一半线程交替插入和弹出
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.push_back(std::thread([&q, &seen, &popped, t]() {
+            for (int i = 0; i < per_thread; ++i) {
+                q.push(t * per_thread + i);
+                int out;
+                if (t % 2 == 1 && q.try_pop(out)) {
+                    seen[out].fetch_add(1);
+                    popped.fetch_add(1);
+                }
+            }
+        }));
+    }
+    // 插入和弹出同时进行时，近似的 size() 也不能回绕成很大的数
+    std::atomic<bool> done(false);
+    std::thread monitor([&q, &done]() {
+        while (!done.load()) {
+            assert(q.size() <= static_cast<size_t>(threads * per_thread));
+        }
+    });
+    for (size_t i = 0; i < workers.size(); ++i) workers[i].join();
+    done.store(true);
+    monitor.join();
+    assert(q.size() == static_cast<size_t>(threads * per_thread - popped.load()));
+
+    // 并发地弹出剩余元素
+    workers.clear();
+    for (int t = 0; t < threads; ++t) {
+        workers.push_back(std::thread([&q, &seen]() {
+            int out;
+            while (q.try_pop(out)) {
+                seen[out].fetch_add(1);
+            }
+        }));
+    }
+    for (size_t i = 0; i < workers.size(); ++i) workers[i].join();
+
+    for (size_t i = 0; i < seen.size(); ++i) {
+        assert(seen[i].load() == 1 && "每个元素恰好弹出一次");
+    }
+    int out;
+    assert(q.empty() && !q.try_pop(out));
+    std::cout << "多线程测试通过！" << std::endl;
+}
+
+int main() {
+    std::cout << "开始 MultiQueue 测试..." << std::endl;
+
+    testInvalidArguments();
+    testExactWithFewQueues();
+    testRelaxedOrder();
+    testConcurrent();
+
+    std::cout << "所有测试通过！" << std::endl;
+    return 0;
+}
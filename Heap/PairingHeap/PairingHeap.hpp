@@ -0,0 +1,418 @@
+#ifndef PAIRING_HEAP_HPP
+#define PAIRING_HEAP_HPP
+
+#include <stdexcept>
+#include <functional>
+#include <utility>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/**
+ * @brief 配对堆
+ * @tparam T 元素类型
+ * @tparam Compare 比较函数对象，comp(a, b) 为 true 表示 a 应在 b 之上，默认为最小堆
+ * @details 堆序多叉树，每个节点用“左孩子、右兄弟”表示。插入和合并只需比较一次根节点，
+ * 删除堆顶时把根的子树两两配对合并（two-pass），均摊 O(log n)。
+ * push 返回元素的句柄，用于 decrease_key
+ */
+template<typename T, typename Compare = std::less<T>>
+class PairingHeap {
+private:
+    // 空闲链表中节点的 value 已经析构，复用时重新原地构造
+    struct Node {
+        T value;
+        Node* child;      // 第一个子节点
+        Node* sibling;    // 右兄弟
+        Node* prev;       // 左兄弟；是第一个子节点时为父节点；根节点为 nullptr
+
+        template<typename... Args>
+        explicit Node(Args&&... args)
+            : value(std::forward<Args>(args)...), child(nullptr), sibling(nullptr), prev(nullptr) {}
+    };
+
+public:
+    /**
+     * @brief 元素句柄，元素被弹出之前一直有效，合并后仍然有效
+     */
+    typedef Node* handle;
+
+private:
+    Node* root;                 // 根节点
+    Node* free_list;            // 已弹出的节点，插入时复用，通过 sibling 串起来
+    Node* free_tail;            // free_list 的最后一个节点，合并时 O(1) 拼接
+    std::vector<void*> blocks;  // 节点所在的内存块
+    Node* block_next;           // 当前内存块中下一个未用的位置
+    size_t block_left;          // 当前内存块中未用的节点数
+    size_t block_size;          // 当前内存块的节点数
+    size_t count;               // 元素个数
+    Compare comp;               // 比较函数对象
+
+    static const size_t FIRST_BLOCK = 64;       // 第一个内存块的节点数，之后每块翻倍
+    static const size_t MAX_BLOCK = 1 << 16;    // 内存块的最大节点数
+
+    /**
+     * @brief 合并两棵树，较靠后的根成为较靠前的根的第一个子节点
+     * @param a 根节点，不能为空，sibling 和 prev 必须为空
+     * @param b 根节点，不能为空，sibling 和 prev 必须为空
+     * @return 合并后的根
+     * @time O(1)
+     */
+    Node* link(Node* a, Node* b) {
+        if (comp(b->value, a->value)) {
+            std::swap(a, b);
+        }
+        b->sibling = a->child;
+        if (a->child != nullptr) {
+            a->child->prev = b;
+        }
+        b->prev = a;
+        a->child = b;
+        return a;
+    }
+
+    Node* meld_roots(Node* a, Node* b) {
+        if (a == nullptr) return b;
+        if (b == nullptr) return a;
+        return link(a, b);
+    }
+
+    /**
+     * @brief 合并兄弟链表上的所有子树（two-pass）
+     * @details 第一遍从左到右两两合并，结果按相反顺序串起来；
+     * 第二遍从右到左依次合并到一起。迭代实现，不会因链表过长而栈溢出
+     * @param first 兄弟链表的第一个节点
+     * @return 合并后的根
+     */
+    Node* merge_pairs(Node* first) {
+        Node* pairs = nullptr;
+        while (first != nullptr) {
+            Node* a = first;
+            Node* b = a->sibling;
+            if (b == nullptr) {
+                first = nullptr;
+            } else {
+                first = b->sibling;
+                b->sibling = b->prev = nullptr;
+            }
+            a->sibling = a->prev = nullptr;
+            Node* merged = b == nullptr ? a : link(a, b);
+            merged->sibling = pairs;
+            pairs = merged;
+        }
+
+        Node* result = pairs;
+        if (result != nullptr) {
+            pairs = result->sibling;
+            result->sibling = nullptr;
+        }
+        while (pairs != nullptr) {
+            Node* next = pairs->sibling;
+            pairs->sibling = nullptr;
+            result = link(result, pairs);
+            pairs = next;
+        }
+        return result;
+    }
+
+    /**
+     * @brief 把节点连同它的子树从树中摘下
+     */
+    void cut(Node* node) {
+        if (node->prev->child == node) {
+            node->prev->child = node->sibling;
+        } else {
+            node->prev->sibling = node->sibling;
+        }
+        if (node->sibling != nullptr) {
+            node->sibling->prev = node->prev;
+        }
+        node->sibling = node->prev = nullptr;
+    }
+
+    /**
+     * @brief 分配新的内存块
+     * @details 节点按插入顺序连续存放，比逐个 new 的局部性好，也省去每个节点的分配开销
+     */
+    void add_block() {
+        block_size = blocks.empty() ? FIRST_BLOCK : block_size * 2;
+        if (block_size > MAX_BLOCK) {
+            block_size = MAX_BLOCK;
+        }
+        blocks.push_back(::operator new(block_size * sizeof(Node)));
+        block_next = static_cast<Node*>(blocks.back());
+        block_left = block_size;
+    }
+
+    template<typename... Args>
+    handle insert(Args&&... args) {
+        Node* node;
+        if (free_list != nullptr) {
+            // 先构造元素，构造抛出异常时节点仍留在空闲链表中
+            node = free_list;
+            new (&node->value) T(std::forward<Args>(args)...);
+            free_list = node->sibling;
+            if (free_list == nullptr) {
+                free_tail = nullptr;
+            }
+            node->sibling = node->prev = nullptr;
+        } else {
+            if (block_left == 0) {
+                add_block();
+            }
+            node = new (block_next) Node(std::forward<Args>(args)...);
+            ++block_next;
+            --block_left;
+        }
+        root = meld_roots(root, node);
+        ++count;
+        return node;
+    }
+
+    /**
+     * @brief 把以 node 为根的整棵树逐个节点交给 release
+     * @details 遇到有子节点的节点时把子节点链表接到当前位置之后，不用递归也不用额外空间
+     */
+    template<typename Release>
+    static void release_tree(Node* node, Release release) {
+        while (node != nullptr) {
+            if (node->child != nullptr) {
+                Node* last = node->child;
+                while (last->sibling != nullptr) {
+                    last = last->sibling;
+                }
+                last->sibling = node->sibling;
+                node->sibling = node->child;
+                node->child = nullptr;
+            }
+            Node* next = node->sibling;
+            release(node);
+            node = next;
+        }
+    }
+
+    /**
+     * @brief 析构节点中的元素并把节点放入空闲链表
+     */
+    void recycle(Node* node) {
+        node->value.~T();
+        node->child = nullptr;
+        node->sibling = free_list;
+        if (free_list == nullptr) {
+            free_tail = node;
+        }
+        free_list = node;
+    }
+
+    static void destroy_node(Node* node) {
+        node->~Node();
+    }
+
+    /**
+     * @brief 析构所有元素并释放内存块
+     * @details 空闲链表中的节点已不含元素，随内存块一起释放即可
+     */
+    void destroy() {
+        release_tree(root, destroy_node);
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            ::operator delete(blocks[i]);
+        }
+        blocks.clear();
+        reset();
+    }
+
+    void reset() {
+        root = free_list = free_tail = block_next = nullptr;
+        block_left = block_size = count = 0;
+    }
+
+    /**
+     * @brief 接管 other 的内存块和空闲节点，other 的元素需另行处理
+     * @details 内存块列表把较短的并入较长的；未用完的内存块保留剩余较多的那个
+     */
+    void take_storage(PairingHeap& other) {
+        if (blocks.size() < other.blocks.size()) {
+            blocks.swap(other.blocks);
+        }
+        blocks.insert(blocks.end(), other.blocks.begin(), other.blocks.end());
+        other.blocks.clear();
+
+        if (other.free_list != nullptr) {
+            other.free_tail->sibling = free_list;
+            if (free_list == nullptr) {
+                free_tail = other.free_tail;
+            }
+            free_list = other.free_list;
+        }
+        if (other.block_left > block_left) {
+            block_next = other.block_next;
+            block_left = other.block_left;
+            block_size = other.block_size;
+        }
+        Node* other_root = other.root;
+        size_t other_count = other.count;
+        other.reset();
+        other.root = other_root;
+        other.count = other_count;
+    }
+
+public:
+    /**
+     * @brief 默认构造函数
+     * @param compare 比较函数对象，默认使用std::less<T>
+     */
+    explicit PairingHeap(const Compare& compare = Compare()) : comp(compare) {
+        reset();
+    }
+
+    // 节点由堆独占，不允许复制
+    PairingHeap(const PairingHeap&) = delete;
+    PairingHeap& operator=(const PairingHeap&) = delete;
+
+    PairingHeap(PairingHeap&& other) : comp(other.comp) {
+        reset();
+        meld(other);
+    }
+
+    PairingHeap& operator=(PairingHeap&& other) {
+        if (this != &other) {
+            destroy();
+            comp = other.comp;
+            meld(other);
+        }
+        return *this;
+    }
+
+    ~PairingHeap() {
+        destroy();
+    }
+
+    /**
+     * @brief 插入元素
+     * @return 元素的句柄
+     * @time O(1)
+     */
+    handle push(const T& value) {
+        return insert(value);
+    }
+
+    /**
+     * @brief 插入元素（移动）
+     * @return 元素的句柄
+     * @time O(1)
+     */
+    handle push(T&& value) {
+        return insert(std::move(value));
+    }
+
+    /**
+     * @brief 用参数原地构造元素并插入
+     * @return 元素的句柄
+     * @time O(1)
+     */
+    template<typename... Args>
+    handle emplace(Args&&... args) {
+        return insert(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief 删除并返回堆顶元素
+     * @throw std::runtime_error 如果堆为空
+     * @time 均摊 O(log n)
+     */
+    T pop() {
+        if (empty()) {
+            throw std::runtime_error("堆为空");
+        }
+        Node* old = root;
+        T result = std::move(old->value);
+        root = merge_pairs(old->child);
+        recycle(old);
+        --count;
+        return result;
+    }
+
+    /**
+     * @brief 获取堆顶元素
+     * @throw std::runtime_error 如果堆为空
+     * @time O(1)
+     */
+    const T& top() const {
+        if (empty()) {
+            throw std::runtime_error("堆为空");
+        }
+        return root->value;
+    }
+
+    /**
+     * @brief 获取句柄对应的元素
+     * @time O(1)
+     */
+    static const T& value(handle h) {
+        return h->value;
+    }
+
+    /**
+     * @brief 把句柄对应元素的值改为更靠前的 value（最小堆中即减小）
+     * @param h 元素句柄，必须属于本堆且尚未弹出
+     * @throw std::invalid_argument 如果 value 比原来的值更靠后
+     * @time 均摊 O(log n)（实际为 O(1) 摘下子树加一次合并，代价记在之后的 pop 上）
+     */
+    void decrease_key(handle h, const T& value) {
+        if (comp(h->value, value)) {
+            throw std::invalid_argument("新的值比原来更靠后");
+        }
+        h->value = value;
+        if (h != root) {
+            cut(h);
+            root = link(root, h);
+        }
+    }
+
+    /**
+     * @brief 把 other 的全部元素合并到本堆，other 变为空堆
+     * @details other 的句柄仍然有效，此后属于本堆；other 的节点所在的内存块也一并转给本堆
+     * @time O(1)，另需把较短的内存块列表并入较长的
+     */
+    void meld(PairingHeap& other) {
+        if (this == &other) {
+            return;
+        }
+        take_storage(other);
+        root = meld_roots(root, other.root);
+        count += other.count;
+        other.root = nullptr;
+        other.count = 0;
+    }
+
+    /**
+     * @brief 检查堆是否为空
+     * @time O(1)
+     */
+    bool empty() const {
+        return root == nullptr;
+    }
+
+    /**
+     * @brief 获取堆中元素个数
+     * @time O(1)
+     */
+    size_t size() const {
+        return count;
+    }
+
+    /**
+     * @brief 清空堆，元素全部析构，节点留作之后插入时复用
+     * @time O(n)
+     */
+    void clear() {
+        PairingHeap* self = this;
+        release_tree(root, [self](Node* node) {
+            self->recycle(node);
+        });
+        root = nullptr;
+        count = 0;
+    }
+};
+
+#endif // PAIRING_HEAP_HPP
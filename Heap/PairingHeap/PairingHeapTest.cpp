@@ -0,0 +1,264 @@
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include "PairingHeap.hpp"
+
+void testEmptyHeap() {
+    std::cout << "测试空堆..." << std::endl;
+    PairingHeap<int> heap;
+    assert(heap.empty() && heap.size() == 0);
+
+    bool thrown = false;
+    try { heap.pop(); } catch (const std::runtime_error&) { thrown = true; }
+    assert(thrown && "空堆 pop 应抛出异常");
+
+    thrown = false;
+    try { heap.top(); } catch (const std::runtime_error&) { thrown = true; }
+    assert(thrown && "空堆 top 应抛出异常");
+
+    std::cout << "空堆测试通过！" << std::endl;
+}
+
+void testPushAndPop() {
+    std::cout << "测试插入和删除操作..." << std::endl;
+    PairingHeap<int> min_heap;
+    min_heap.push(5);
+    min_heap.push(3);
+    min_heap.push(7);
+    min_heap.push(1);
+    assert(min_heap.top() == 1 && min_heap.size() == 4);
+    assert(min_heap.pop() == 1);
+    assert(min_heap.pop() == 3);
+    assert(min_heap.pop() == 5);
+    assert(min_heap.pop() == 7);
+    assert(min_heap.empty());
+
+    PairingHeap<std::string, std::greater<std::string>> max_heap;
+    max_heap.push("banana");
+    max_heap.emplace(3, 'z');
+    max_heap.push(std::string("apple"));
+    assert(max_heap.pop() == "zzz");
+    assert(max_heap.pop() == "banana");
+    assert(max_heap.pop() == "apple");
+
+    std::cout << "插入和删除测试通过！" << std::endl;
+}
+
+void testRandomOrder() {
+    std::cout << "测试随机数据..." << std::endl;
+    std::srand(1);
+    PairingHeap<int> heap;
+    std::vector<int> values;
+    for (int round = 0; round < 3; ++round) {
+        // 每轮插入一批、弹出一部分，检查弹出的顺序
+        for (int i = 0; i < 5000; ++i) {
+            int v = std::rand() % 10000;
+            heap.push(v);
+            values.push_back(v);
+        }
+        std::sort(values.begin(), values.end(), std::greater<int>());
+        for (int i = 0; i < 2000; ++i) {
+            assert(heap.pop() == values.back());
+            values.pop_back();
+        }
+        assert(heap.size() == values.size());
+    }
+    while (!heap.empty()) {
+        assert(heap.pop() == values.back());
+        values.pop_back();
+    }
+    assert(values.empty());
+    std::cout << "随机数据测试通过！" << std::endl;
+}
+
+void testDecreaseKey() {
+    std::cout << "测试 decrease_key..." << std::endl;
+    PairingHeap<int> heap;
+    std::vector<PairingHeap<int>::handle> handles;
+    for (int i = 0; i < 10; ++i) {
+        handles.push_back(heap.push(100 + i));
+    }
+    heap.pop();                       // 100，之后的子树不再是一条链
+    heap.decrease_key(handles[7], 50);
+    assert(heap.top() == 50 && PairingHeap<int>::value(handles[7]) == 50);
+    heap.decrease_key(handles[7], 50);  // 相等也可以
+    heap.decrease_key(handles[9], 1);
+    assert(heap.top() == 1);
+
+    bool thrown = false;
+    try { heap.decrease_key(handles[3], 200); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown && "decrease_key 不能增大优先级");
+
+    int order[] = {1, 50, 101, 102, 103, 104, 105, 106, 108};
+    for (int i = 0; i < 9; ++i) {
+        assert(heap.pop() == order[i]);
+    }
+    assert(heap.empty());
+
+    // 随机 decrease_key，与朴素实现对照
+    std::srand(2);
+    const int n = 3000;
+    PairingHeap<int> random_heap;
+    std::vector<PairingHeap<int>::handle> h(n);
+    std::vector<int> keys(n);
+    std::vector<bool> present(n, true);
+    for (int i = 0; i < n; ++i) {
+        keys[i] = 1000000 + std::rand() % 1000000;
+        h[i] = random_heap.push(keys[i]);
+    }
+    for (int step = 0; step < 20000; ++step) {
+        int id = std::rand() % n;
+        if (step % 10 == 9) {
+            int top = random_heap.pop();
+            int best = -1;
+            for (int i = 0; i < n; ++i) {
+                if (present[i] && (best == -1 || keys[i] < keys[best])) {
+                    best = i;
+                }
+            }
+            assert(keys[best] == top);
+            present[best] = false;
+        } else if (present[id]) {
+            keys[id] -= std::rand() % 1000;
+            random_heap.decrease_key(h[id], keys[id]);
+        }
+    }
+    std::cout << "decrease_key 测试通过！" << std::endl;
+}
+
+void testMeld() {
+    std::cout << "测试合并..." << std::endl;
+    PairingHeap<int> a;
+    PairingHeap<int> b;
+    PairingHeap<int>::handle h = b.push(40);
+    for (int i = 0; i < 100; i += 2) a.push(i);
+    for (int i = 1; i < 100; i += 2) b.push(i);
+
+    a.meld(b);
+    assert(b.empty() && b.size() == 0);
+    assert(a.size() == 101);
+    a.meld(a);
+    assert(a.size() == 101);
+
+    // 合并后原来 b 的句柄属于 a
+    a.decrease_key(h, -1);
+    assert(a.pop() == -1);
+    for (int i = 0; i < 100; ++i) {
+        assert(a.pop() == i);
+    }
+
+    // 合并到空堆、合并空堆
+    PairingHeap<int> empty;
+    b.push(7);
+    empty.meld(b);
+    assert(empty.top() == 7);
+    empty.meld(b);
+    assert(empty.size() == 1);
+
+    std::cout << "合并测试通过！" << std::endl;
+}
+
+void testClearAndMove() {
+    std::cout << "测试清空和移动..." << std::endl;
+    PairingHeap<int> heap;
+    for (int i = 0; i < 1000; ++i) heap.push(1000 - i);
+    heap.pop();
+    heap.clear();
+    assert(heap.empty() && heap.size() == 0);
+    for (int i = 0; i < 10; ++i) heap.push(i);   // 复用清空留下的节点
+    assert(heap.top() == 0 && heap.size() == 10);
+
+    PairingHeap<int> moved(std::move(heap));
+    assert(heap.empty() && moved.size() == 10);
+    heap.push(3);
+    heap = std::move(moved);
+    assert(heap.size() == 10 && heap.pop() == 0);
+
+    // 只能移动的元素类型
+    struct ByValue {
+        bool operator()(const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) const {
+            return *a < *b;
+        }
+    };
+    PairingHeap<std::unique_ptr<int>, ByValue> ptr_heap;
+    ptr_heap.push(std::unique_ptr<int>(new int(2)));
+    ptr_heap.emplace(new int(1));
+    std::unique_ptr<int> p = ptr_heap.pop();
+    assert(*p == 1);
+    ptr_heap.emplace(new int(0));    // 复用节点
+    assert(*ptr_heap.pop() == 0 && *ptr_heap.pop() == 2);
+
+    // 弹出和清空时立即析构元素，不等到堆析构
+    std::shared_ptr<int> shared(new int(7));
+    {
+        PairingHeap<std::shared_ptr<int>> shared_heap;
+        for (int i = 0; i < 5; ++i) shared_heap.push(shared);
+        shared_heap.pop();
+        assert(shared.use_count() == 5);
+        shared_heap.clear();
+        assert(shared.use_count() == 1);
+        shared_heap.push(shared);    // 复用节点
+        assert(shared.use_count() == 2);
+    }
+    assert(shared.use_count() == 1);
+
+    // 复用节点时原地构造，不要求元素可赋值
+    struct Fixed {
+        const int key;
+        explicit Fixed(int k) : key(k) {}
+        bool operator<(const Fixed& other) const { return key < other.key; }
+    };
+    PairingHeap<Fixed> fixed_heap;
+    fixed_heap.emplace(2);
+    fixed_heap.emplace(1);
+    assert(fixed_heap.pop().key == 1);
+    fixed_heap.emplace(0);
+    assert(fixed_heap.pop().key == 0 && fixed_heap.pop().key == 2);
+
+    // 复用节点时构造抛出异常，节点留在空闲链表中，元素不会被重复析构
+    struct Throwing {
+        int key;
+        explicit Throwing(int k) : key(k) {
+            if (k < 0) throw std::runtime_error("构造失败");
+        }
+        bool operator<(const Throwing& other) const { return key < other.key; }
+    };
+    PairingHeap<Throwing> throwing_heap;
+    throwing_heap.emplace(1);
+    throwing_heap.pop();
+    bool thrown = false;
+    try {
+        throwing_heap.emplace(-1);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown && throwing_heap.empty());
+    throwing_heap.emplace(3);
+    assert(throwing_heap.size() == 1 && throwing_heap.pop().key == 3);
+
+    // 很长的兄弟链表和很深的树，析构不能递归
+    PairingHeap<int> deep;
+    for (int i = 0; i < 1000000; ++i) deep.push(i);
+    deep.pop();
+    std::cout << "清空和移动测试通过！" << std::endl;
+}
+
+int main() {
+    std::cout << "开始配对堆测试..." << std::endl;
+
+    testEmptyHeap();
+    testPushAndPop();
+    testRandomOrder();
+    testDecreaseKey();
+    testMeld();
+    testClearAndMove();
+
+    std::cout << "所有测试通过！" << std::endl;
+    return 0;
+}
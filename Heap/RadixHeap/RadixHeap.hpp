@@ -0,0 +1,212 @@
+#ifndef RADIX_HEAP_HPP
+#define RADIX_HEAP_HPP
+
+#include <vector>
+#include <stdexcept>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief 默认的取键函数：元素本身就是键
+ */
+template<typename T>
+struct RadixIdentity {
+    const T& operator()(const T& value) const {
+        return value;
+    }
+};
+
+/**
+ * @brief 基数堆（单调整数优先队列，最小堆）
+ * @tparam T 元素类型
+ * @tparam KeyOf 取键函数对象，KeyOf()(value) 返回无符号整数键，默认元素本身就是键
+ * @details 要求插入的键不小于最近一次弹出的键（单调），Dijkstra 等算法满足这一条件。
+ * 设最近一次弹出的键为 last，键为 k 的元素放在第 bit_width(k ^ last) 号桶，
+ * 即按 k 与 last 最高的不同二进制位分桶。0 号桶中的键都等于 last；
+ * 0 号桶为空时，取出第一个非空桶中的最小键作为新的 last，把该桶的元素重新分到更低的桶。
+ * 每个元素只会往更低的桶移动，每次移动 O(1)，因此 push 为 O(1)，pop 均摊 O(log C)，
+ * C 为键的取值范围
+ */
+template<typename T, typename KeyOf = RadixIdentity<T>>
+class RadixHeap {
+public:
+    typedef typename std::decay<decltype(std::declval<KeyOf>()(std::declval<const T&>()))>::type key_type;
+
+private:
+    static_assert(std::is_integral<key_type>::value && std::is_unsigned<key_type>::value,
+                  "RadixHeap requires an unsigned integer key");
+
+    static const int BITS = std::numeric_limits<key_type>::digits;
+
+    std::vector<T> buckets[BITS + 1];   // buckets[i] 中的键与 last 最高的不同位为第 i-1 位
+    key_type last;                       // 最近一次弹出的键（或重新分桶时的最小键）
+    size_t count;                        // 元素个数
+    KeyOf key_of;                        // 取键函数对象
+
+    /**
+     * @brief 表示 x 所需的二进制位数，x 为 0 时返回 0
+     */
+    static int bit_width(std::uint64_t x) {
+#if defined(__GNUC__)
+        return x == 0 ? 0 : 64 - __builtin_clzll(x);
+#else
+        int width = 0;
+        while (x != 0) {
+            ++width;
+            x >>= 1;
+        }
+        return width;
+#endif
+    }
+
+    int bucket_of(key_type key) const {
+        return bit_width(static_cast<std::uint64_t>(key ^ last));
+    }
+
+    /**
+     * @brief 返回第一个非空桶中键最小的元素的位置
+     * @param bucket 输出第一个非空桶的编号
+     */
+    size_t min_in_first_bucket(int& bucket) const {
+        bucket = 1;
+        while (buckets[bucket].empty()) {
+            ++bucket;
+        }
+        const std::vector<T>& b = buckets[bucket];
+        size_t best = 0;
+        for (size_t i = 1; i < b.size(); ++i) {
+            if (key_of(b[i]) < key_of(b[best])) {
+                best = i;
+            }
+        }
+        return best;
+    }
+
+    /**
+     * @brief 0 号桶为空时，把第一个非空桶重新分到更低的桶，使 0 号桶非空
+     * @time 均摊 O(1)：重新分桶的元素都移到了编号更小的桶
+     */
+    void refill() {
+        if (!buckets[0].empty()) {
+            return;
+        }
+        int bucket;
+        size_t best = min_in_first_bucket(bucket);
+        std::vector<T>& b = buckets[bucket];
+        last = key_of(b[best]);
+        for (size_t i = 0; i < b.size(); ++i) {
+            buckets[bucket_of(key_of(b[i]))].push_back(std::move(b[i]));
+        }
+        b.clear();
+    }
+
+public:
+    /**
+     * @brief 默认构造函数
+     * @param extract 取键函数对象
+     */
+    explicit RadixHeap(const KeyOf& extract = KeyOf()) : last(0), count(0), key_of(extract) {}
+
+    /**
+     * @brief 插入元素
+     * @throw std::invalid_argument 如果键小于最近一次弹出的键
+     * @time O(1)
+     */
+    void push(const T& value) {
+        key_type key = key_of(value);
+        if (key < last) {
+            throw std::invalid_argument("键小于最近一次弹出的键");
+        }
+        buckets[bucket_of(key)].push_back(value);
+        ++count;
+    }
+
+    /**
+     * @brief 插入元素（移动）
+     * @throw std::invalid_argument 如果键小于最近一次弹出的键
+     * @time O(1)
+     */
+    void push(T&& value) {
+        key_type key = key_of(value);
+        if (key < last) {
+            throw std::invalid_argument("键小于最近一次弹出的键");
+        }
+        buckets[bucket_of(key)].push_back(std::move(value));
+        ++count;
+    }
+
+    /**
+     * @brief 删除并返回键最小的元素，键相同的元素之间顺序不定
+     * @throw std::runtime_error 如果堆为空
+     * @time 均摊 O(log C)
+     */
+    T pop() {
+        if (empty()) {
+            throw std::runtime_error("堆为空");
+        }
+        refill();
+        T result = std::move(buckets[0].back());
+        buckets[0].pop_back();
+        --count;
+        return result;
+    }
+
+    /**
+     * @brief 获取键最小的元素，即下一次 pop 返回的元素
+     * @throw std::runtime_error 如果堆为空
+     * @time 0 号桶非空时 O(1)，否则需要扫描第一个非空桶
+     * @note 不改变分桶，因此不影响之后允许插入的键
+     */
+    const T& top() const {
+        if (empty()) {
+            throw std::runtime_error("堆为空");
+        }
+        if (!buckets[0].empty()) {
+            return buckets[0].back();
+        }
+        int bucket;
+        size_t best = min_in_first_bucket(bucket);
+        return buckets[bucket][best];
+    }
+
+    /**
+     * @brief 最近一次弹出的键，之后插入的键不能小于它
+     * @time O(1)
+     */
+    key_type last_key() const {
+        return last;
+    }
+
+    /**
+     * @brief 检查堆是否为空
+     * @time O(1)
+     */
+    bool empty() const {
+        return count == 0;
+    }
+
+    /**
+     * @brief 获取堆中元素个数
+     * @time O(1)
+     */
+    size_t size() const {
+        return count;
+    }
+
+    /**
+     * @brief 清空堆，键的下限重置为 0
+     * @time O(n)
+     */
+    void clear() {
+        for (int i = 0; i <= BITS; ++i) {
+            buckets[i].clear();
+        }
+        last = 0;
+        count = 0;
+    }
+};
+
+#endif // RADIX_HEAP_HPP
@@ -0,0 +1,149 @@
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include "RadixHeap.hpp"
+
+// 按 first 取键
+struct FirstKey {
+    std::uint32_t operator()(const std::pair<std::uint32_t, int>& p) const {
+        return p.first;
+    }
+};
+
+void testEmptyHeap() {
+    std::cout << "测试空堆..." << std::endl;
+    RadixHeap<std::uint32_t> heap;
+    assert(heap.empty() && heap.size() == 0);
+
+    bool thrown = false;
+    try { heap.pop(); } catch (const std::runtime_error&) { thrown = true; }
+    assert(thrown && "空堆 pop 应抛出异常");
+
+    thrown = false;
+    try { heap.top(); } catch (const std::runtime_error&) { thrown = true; }
+    assert(thrown && "空堆 top 应抛出异常");
+
+    std::cout << "空堆测试通过！" << std::endl;
+}
+
+void testPushAndPop() {
+    std::cout << "测试插入和删除操作..." << std::endl;
+    RadixHeap<std::uint32_t> heap;
+    heap.push(5);
+    heap.push(3);
+    heap.push(7);
+    heap.push(3);
+    heap.push(0xFFFFFFFFu);
+    assert(heap.size() == 5 && heap.top() == 3);
+    assert(heap.pop() == 3);
+    assert(heap.top() == 3 && heap.pop() == 3);
+    assert(heap.last_key() == 3);
+    heap.push(4);                      // 不小于最近弹出的键即可
+    assert(heap.pop() == 4);
+    assert(heap.pop() == 5);
+    assert(heap.pop() == 7);
+    assert(heap.pop() == 0xFFFFFFFFu);
+    assert(heap.empty());
+
+    bool thrown = false;
+    try { heap.push(6); } catch (const std::invalid_argument&) { thrown = true; }
+    assert(thrown && "键小于最近弹出的键应抛出异常");
+
+    heap.clear();
+    heap.push(0);
+    assert(heap.pop() == 0);
+
+    std::cout << "插入和删除测试通过！" << std::endl;
+}
+
+void testTopDoesNotRaiseBound() {
+    std::cout << "测试 top 不改变键的下限..." << std::endl;
+    RadixHeap<std::uint32_t> heap;
+    heap.push(10);
+    assert(heap.pop() == 10);
+    heap.push(100);
+    heap.push(90);
+    assert(heap.top() == 90);
+    heap.push(20);                     // 20 仍然不小于最近弹出的 10
+    assert(heap.top() == 20);
+    assert(heap.pop() == 20 && heap.pop() == 90 && heap.pop() == 100);
+    std::cout << "top 测试通过！" << std::endl;
+}
+
+template<typename Key>
+void checkMonotone(unsigned seed, Key range) {
+    // 模拟 Dijkstra：每次弹出最小键，再插入若干个不小于它的键
+    std::srand(seed);
+    RadixHeap<Key> heap;
+    std::vector<Key> reference;
+    for (int i = 0; i < 100; ++i) {
+        Key k = static_cast<Key>(std::rand() % range);
+        heap.push(k);
+        reference.push_back(k);
+    }
+    std::make_heap(reference.begin(), reference.end(), std::greater<Key>());
+    Key previous = 0;
+    for (int step = 0; step < 20000 && !heap.empty(); ++step) {
+        Key k = heap.pop();
+        std::pop_heap(reference.begin(), reference.end(), std::greater<Key>());
+        assert(k == reference.back() && k >= previous);
+        reference.pop_back();
+        previous = k;
+        int pushes = std::rand() % 3;
+        for (int j = 0; j < pushes; ++j) {
+            Key delta = static_cast<Key>(std::rand() % (range / 8 + 1));
+            Key next = static_cast<Key>(k + delta) < k ? k : static_cast<Key>(k + delta);
+            heap.push(next);
+            reference.push_back(next);
+            std::push_heap(reference.begin(), reference.end(), std::greater<Key>());
+        }
+        assert(heap.size() == reference.size());
+    }
+}
+
+void testMonotoneOperations() {
+    std::cout << "测试单调操作序列..." << std::endl;
+    checkMonotone<std::uint8_t>(1, 200);
+    checkMonotone<std::uint16_t>(2, 60000);
+    checkMonotone<std::uint32_t>(3, 1000000);
+    checkMonotone<std::uint64_t>(4, 1u << 30);
+    std::cout << "单调操作测试通过！" << std::endl;
+}
+
+void testKeyOf() {
+    std::cout << "测试自定义取键..." << std::endl;
+    RadixHeap<std::pair<std::uint32_t, int>, FirstKey> heap;
+    heap.push(std::make_pair(30u, 3));
+    heap.push(std::make_pair(10u, 1));
+    heap.push(std::make_pair(20u, 2));
+    assert(heap.top().second == 1);
+    assert(heap.pop().second == 1);
+    assert(heap.pop().second == 2);
+    assert(heap.pop().second == 3);
+
+    // 64 位键的最高位
+    RadixHeap<std::uint64_t> big;
+    big.push(~0ULL);
+    big.push(1ULL << 63);
+    big.push(0);
+    assert(big.pop() == 0 && big.pop() == (1ULL << 63) && big.pop() == ~0ULL);
+    std::cout << "自定义取键测试通过！" << std::endl;
+}
+
+int main() {
+    std::cout << "开始基数堆测试..." << std::endl;
+
+    testEmptyHeap();
+    testPushAndPop();
+    testTopDoesNotRaiseBound();
+    testMonotoneOperations();
+    testKeyOf();
+
+    std::cout << "所有测试通过！" << std::endl;
+    return 0;
+}
@@ -0,0 +1,339 @@
+#ifndef CONCURRENT_SKIP_LIST_HPP
+#define CONCURRENT_SKIP_LIST_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <utility>
+#include <vector>
+#include "EpochReclaim.hpp"
+
+// 无锁并发跳表（有序集合）
+// 节点沿用单链表 Node<T> 的结构：数据加 next 指针，只是 next 变成一组原子指针（每层一个），
+// 第 0 层就是一条按键有序的带头结点单链表，上面各层是跳跃用的索引。
+// 删除分两步：先在 next 指针的最低位打上删除标记（逻辑删除），之后任何线程遍历时遇到
+// 带标记的节点都会用 CAS 把它从所在层摘下（物理删除）。摘下的节点交给纪元回收延迟释放。
+// 所有操作都可以由任意多个线程同时调用。
+template<typename T, typename Compare = std::less<T>>
+class ConcurrentSkipList {
+private:
+    static const int MAX_LEVEL = 24;   // 每层概率 1/2，可覆盖约 2^24 个元素
+
+    // next 指针保存为整数，最低位为删除标记
+    typedef std::uintptr_t Link;
+
+    struct alignas(std::atomic<Link>) Node {
+        T data;
+        int height;
+        // 插入线程链接完各层、删除线程完成标记，两者都做完的一方负责摘除并回收节点
+        std::atomic<int> handoff;
+
+        std::atomic<Link>* next() {
+            return reinterpret_cast<std::atomic<Link>*>(this + 1);
+        }
+    };
+
+    Node* head;                  // 头结点，不保存数据，高度为 MAX_LEVEL
+    std::atomic<long> count;     // 元素个数，并发修改时为近似值
+    Compare comp;
+
+    static Node* pointer(Link link) {
+        return reinterpret_cast<Node*>(link & ~static_cast<Link>(1));
+    }
+
+    static bool marked(Link link) {
+        return (link & 1) != 0;
+    }
+
+    static Link linkOf(Node* node) {
+        return reinterpret_cast<Link>(node);
+    }
+
+    static Node* allocateNode(int height) {
+        void* memory = ::operator new(sizeof(Node) + sizeof(std::atomic<Link>) * height);
+        Node* node = static_cast<Node*>(memory);
+        node->height = height;
+        new (&node->handoff) std::atomic<int>(2);
+        for (int l = 0; l < height; ++l) {
+            new (node->next() + l) std::atomic<Link>(0);
+        }
+        return node;
+    }
+
+    static Node* createNode(const T& data, int height) {
+        Node* node = allocateNode(height);
+        try {
+            new (&node->data) T(data);
+        } catch (...) {
+            ::operator delete(node);
+            throw;
+        }
+        return node;
+    }
+
+    static void destroyNode(void* p) {
+        Node* node = static_cast<Node*>(p);
+        node->data.~T();
+        ::operator delete(node);
+    }
+
+    // 节点高度：每升一层的概率为 1/2
+    static int randomHeight() {
+        static thread_local std::uint64_t seed = 0x9E3779B97F4A7C15ULL ^
+            reinterpret_cast<std::uintptr_t>(&seed);
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        std::uint64_t bits = seed;
+        int height = 1;
+        while (height < MAX_LEVEL && (bits & 1) != 0) {
+            ++height;
+            bits >>= 1;
+        }
+        return height;
+    }
+
+    bool less(const T& a, const T& b) const {
+        return comp(a, b);
+    }
+
+    // 在每一层找到最后一个键小于 key 的节点 preds[l] 和它的后继 succs[l]，
+    // 途中把带删除标记的节点从所在层摘下。返回第 0 层的后继是否等于 key。
+    // 调用方必须处于纪元临界区内
+    bool find(const T& key, Node** preds, Node** succs) {
+    retry:
+        Node* pred = head;
+        Node* curr = nullptr;
+        for (int l = MAX_LEVEL - 1; l >= 0; --l) {
+            curr = pointer(pred->next()[l].load(std::memory_order_acquire));
+            while (curr != nullptr) {
+                Link succ = curr->next()[l].load(std::memory_order_acquire);
+                if (marked(succ)) {
+                    // curr 已被逻辑删除，帮忙摘下；pred 的 next 已变化时从头重来
+                    Link expected = linkOf(curr);
+                    if (!pred->next()[l].compare_exchange_strong(expected, linkOf(pointer(succ)),
+                                                                 std::memory_order_acq_rel)) {
+                        goto retry;
+                    }
+                    curr = pointer(succ);
+                    continue;
+                }
+                if (!less(curr->data, key)) {
+                    break;
+                }
+                pred = curr;
+                curr = pointer(succ);
+            }
+            preds[l] = pred;
+            succs[l] = curr;
+        }
+        return curr != nullptr && !less(key, curr->data);
+    }
+
+    // 从各层摘下已逻辑删除的节点并交给纪元回收。之后它不可能再被链入任何一层
+    void unlinkAndRetire(Node* node) {
+        Node* preds[MAX_LEVEL];
+        Node* succs[MAX_LEVEL];
+        find(node->data, preds, succs);
+        epoch::threadState().retire(node, &ConcurrentSkipList::destroyNode);
+    }
+
+    void finishHandoff(Node* node) {
+        if (node->handoff.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            unlinkAndRetire(node);
+        }
+    }
+
+    // 只读查找第一个键不小于 key 的节点，不摘除节点，调用方必须处于纪元临界区内
+    Node* lowerBound(const T& key) const {
+        Node* pred = head;
+        Node* curr = nullptr;
+        for (int l = MAX_LEVEL - 1; l >= 0; --l) {
+            curr = pointer(pred->next()[l].load(std::memory_order_acquire));
+            while (curr != nullptr) {
+                Link succ = curr->next()[l].load(std::memory_order_acquire);
+                if (marked(succ)) {
+                    curr = pointer(succ);
+                } else if (less(curr->data, key)) {
+                    pred = curr;
+                    curr = pointer(succ);
+                } else {
+                    break;
+                }
+            }
+        }
+        return curr;
+    }
+
+public:
+    typedef T value_type;
+
+    ConcurrentSkipList() : head(allocateNode(MAX_LEVEL)), count(0), comp() {}
+
+    // 析构函数，调用时不能有其他线程访问跳表
+    ~ConcurrentSkipList() {
+        // 第 0 层上的节点都未被回收，已摘下的节点由纪元回收负责释放
+        Node* p = pointer(head->next()[0].load());
+        while (p != nullptr) {
+            Node* next = pointer(p->next()[0].load());
+            destroyNode(p);
+            p = next;
+        }
+        ::operator delete(head);
+    }
+
+    ConcurrentSkipList(const ConcurrentSkipList&) = delete;
+    ConcurrentSkipList& operator=(const ConcurrentSkipList&) = delete;
+
+    // 插入元素，已存在时返回 false
+    bool insert(const T& data) {
+        epoch::Guard guard;
+        Node* preds[MAX_LEVEL];
+        Node* succs[MAX_LEVEL];
+        Node* node = nullptr;
+        int height = randomHeight();
+        for (;;) {
+            if (find(data, preds, succs)) {
+                if (node != nullptr) {
+                    destroyNode(node);   // 从未发布过，可以直接释放
+                }
+                return false;
+            }
+            if (node == nullptr) {
+                node = createNode(data, height);
+            }
+            for (int l = 0; l < height; ++l) {
+                node->next()[l].store(linkOf(succs[l]), std::memory_order_relaxed);
+            }
+            // 链入第 0 层即完成插入（线性化点）
+            Link expected = linkOf(succs[0]);
+            if (preds[0]->next()[0].compare_exchange_strong(expected, linkOf(node),
+                                                            std::memory_order_release)) {
+                break;
+            }
+        }
+        count.fetch_add(1, std::memory_order_relaxed);
+
+        // 逐层链入索引。节点在此期间被删除（next 上出现标记）时停止
+        for (int l = 1; l < height; ++l) {
+            for (;;) {
+                Link current = node->next()[l].load(std::memory_order_acquire);
+                if (marked(current)) {
+                    finishHandoff(node);
+                    return true;
+                }
+                if (pointer(current) != succs[l] &&
+                    !node->next()[l].compare_exchange_strong(current, linkOf(succs[l]),
+                                                            std::memory_order_acq_rel)) {
+                    continue;   // 删除线程刚打上标记，下一轮退出
+                }
+                Link expected = linkOf(succs[l]);
+                if (preds[l]->next()[l].compare_exchange_strong(expected, linkOf(node),
+                                                                std::memory_order_release)) {
+                    break;
+                }
+                // 前驱已变化，重新定位；节点已从第 0 层消失说明被删除
+                find(data, preds, succs);
+                if (succs[0] != node) {
+                    finishHandoff(node);
+                    return true;
+                }
+            }
+        }
+        finishHandoff(node);
+        return true;
+    }
+
+    // 删除元素，不存在（或被其他线程抢先删除）时返回 false
+    bool remove(const T& data) {
+        epoch::Guard guard;
+        Node* preds[MAX_LEVEL];
+        Node* succs[MAX_LEVEL];
+        if (!find(data, preds, succs)) {
+            return false;
+        }
+        Node* node = succs[0];
+        // 从上往下给各层的 next 打标记，阻止新的链接
+        for (int l = node->height - 1; l >= 1; --l) {
+            Link link = node->next()[l].load(std::memory_order_acquire);
+            while (!marked(link) &&
+                   !node->next()[l].compare_exchange_weak(link, link | 1, std::memory_order_acq_rel)) {
+            }
+        }
+        // 第 0 层打上标记的线程完成删除（线性化点）
+        Link link = node->next()[0].load(std::memory_order_acquire);
+        for (;;) {
+            if (marked(link)) {
+                return false;
+            }
+            if (node->next()[0].compare_exchange_weak(link, link | 1, std::memory_order_acq_rel)) {
+                break;
+            }
+        }
+        count.fetch_sub(1, std::memory_order_relaxed);
+        finishHandoff(node);
+        return true;
+    }
+
+    // 判断元素是否存在，不修改任何指针
+    bool contains(const T& data) const {
+        epoch::Guard guard;
+        Node* node = lowerBound(data);
+        return node != nullptr && !less(data, node->data) &&
+               !marked(node->next()[0].load(std::memory_order_acquire));
+    }
+
+    // 按升序对 [low, high) 中的每个元素调用 visit(const T&)。
+    // 遍历与并发修改交错时为弱一致：遍历期间一直存在的元素一定会被访问，
+    // 期间插入或删除的元素可能访问也可能不访问，不会重复访问
+    template<typename Visitor>
+    void forEachInRange(const T& low, const T& high, Visitor visit) const {
+        epoch::Guard guard;
+        for (Node* p = lowerBound(low); p != nullptr; ) {
+            if (!less(p->data, high)) {
+                break;
+            }
+            Link next = p->next()[0].load(std::memory_order_acquire);
+            if (!marked(next)) {
+                visit(p->data);
+            }
+            p = pointer(next);
+        }
+    }
+
+    // 返回 [low, high) 中的元素
+    std::vector<T> range(const T& low, const T& high) const {
+        std::vector<T> result;
+        forEachInRange(low, high, [&result](const T& e) { result.push_back(e); });
+        return result;
+    }
+
+    // 元素个数，有并发修改时为近似值
+    size_t size() const {
+        long n = count.load(std::memory_order_relaxed);
+        return n > 0 ? static_cast<size_t>(n) : 0;
+    }
+
+    // 第 0 层上是否没有未删除的节点
+    bool empty() const {
+        epoch::Guard guard;
+        Node* p = pointer(head->next()[0].load(std::memory_order_acquire));
+        while (p != nullptr) {
+            Link next = p->next()[0].load(std::memory_order_acquire);
+            if (!marked(next)) {
+                return false;
+            }
+            p = pointer(next);
+        }
+        return true;
+    }
+
+    // 尝试推进纪元并释放本线程可以回收的节点
+    static void collect() {
+        epoch::threadState().collect();
+    }
+};
+
+#endif // CONCURRENT_SKIP_LIST_HPP
@@ -0,0 +1,132 @@
+#include <iostream>
+#include <iomanip>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "ConcurrentSkipList.hpp"
+#include "../../BinTree/BST/BST.hpp"
+
+// 扩展性测试：t 个线程（t = 1, 2, 4, ... N）在 [0, keyRange) 的随机键上混合执行
+//   read-heavy  ：90% contains，5% insert，5% remove
+//   write-heavy ：50% contains，25% insert，25% remove
+// 对比 ConcurrentSkipList 与 "BST + 全局 std::mutex" 的总吞吐量（百万次操作/秒）。
+// 集合预先随机填入一半的键，插入与删除各占一半，规模保持稳定。
+// 用法：./ConcurrentSkipListBenchmark [最大线程数 N] [每线程操作数] [keyRange]
+
+typedef std::chrono::steady_clock Clock;
+
+static volatile long sink;
+
+// BST 插入重复值时什么也不做、删除不存在的值时抛出异常，包装成与跳表相同的接口
+template<typename T>
+class LockedBST {
+private:
+    BST<T> tree;
+    mutable std::mutex mtx;
+
+public:
+    bool insert(const T& e) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (tree.contains(e)) {
+            return false;
+        }
+        tree.insert(e);
+        return true;
+    }
+
+    bool remove(const T& e) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (!tree.contains(e)) {
+            return false;
+        }
+        tree.remove(e);
+        return true;
+    }
+
+    bool contains(const T& e) const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return tree.contains(e);
+    }
+};
+
+static std::uint32_t nextRandom(std::uint32_t& seed) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+template<typename Set>
+double run(int threads, long opsPerThread, int keyRange, int readPercent) {
+    Set set;
+    std::uint32_t seed = 2463534242u;
+    for (int i = 0; i < keyRange / 2; ++i) {
+        set.insert(static_cast<int>(nextRandom(seed) % keyRange));
+    }
+    int insertBound = readPercent + (100 - readPercent) / 2;
+    std::atomic<bool> go(false);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.push_back(std::thread([&set, &go, t, opsPerThread, keyRange, readPercent, insertBound]() {
+            std::uint32_t local = 88675123u + 7919u * t;
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            long hits = 0;
+            for (long i = 0; i < opsPerThread; ++i) {
+                std::uint32_t r = nextRandom(local);
+                int key = static_cast<int>((r >> 7) % keyRange);
+                int op = static_cast<int>(r % 100);
+                if (op < readPercent) {
+                    hits += set.contains(key);
+                } else if (op < insertBound) {
+                    hits += set.insert(key);
+                } else {
+                    hits += set.remove(key);
+                }
+            }
+            sink = sink + hits;
+        }));
+    }
+    Clock::time_point start = Clock::now();
+    go.store(true);
+    for (size_t i = 0; i < workers.size(); ++i) {
+        workers[i].join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return threads * opsPerThread / seconds / 1e6;
+}
+
+int main(int argc, char* argv[]) {
+    int maxThreads = argc > 1 ? std::atoi(argv[1]) : static_cast<int>(std::thread::hardware_concurrency());
+    long opsPerThread = argc > 2 ? std::atol(argv[2]) : 1000000;
+    int keyRange = argc > 3 ? std::atoi(argv[3]) : 1 << 16;
+    if (maxThreads < 1) {
+        maxThreads = 1;
+    }
+
+    const char* names[] = {"read-heavy", "write-heavy"};
+    const int readPercents[] = {90, 50};
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency()
+              << ", keys: " << keyRange << ", Mops/s" << std::endl;
+    for (int mix = 0; mix < 2; ++mix) {
+        std::cout << "\n" << names[mix] << " (" << readPercents[mix] << "% contains)" << std::endl;
+        std::cout << std::setw(8) << "threads" << std::setw(14) << "SkipList" << std::setw(14) << "BST+mutex"
+                  << std::setw(10) << "ratio" << std::endl;
+        for (int t = 1; t <= maxThreads; t *= 2) {
+            double lockFree = run<ConcurrentSkipList<int>>(t, opsPerThread, keyRange, readPercents[mix]);
+            double locked = run<LockedBST<int>>(t, opsPerThread, keyRange, readPercents[mix]);
+            std::cout << std::setw(8) << t << std::fixed << std::setprecision(2)
+                      << std::setw(14) << lockFree << std::setw(14) << locked
+                      << std::setw(10) << lockFree / locked << std::endl;
+            if (t < maxThreads && t * 2 > maxThreads) {
+                t = maxThreads / 2;   // 最后一轮使用 maxThreads
+            }
+        }
+    }
+    return 0;
+}
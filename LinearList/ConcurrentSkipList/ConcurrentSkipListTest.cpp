@@ -0,0 +1,229 @@
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include "ConcurrentSkipList.hpp"
+
+// 统计存活对象个数，用于检查节点是否全部被回收
+struct Counted {
+    static std::atomic<int> alive;
+    int value;
+
+    Counted() : value(0) { alive.fetch_add(1); }
+    Counted(int v) : value(v) { alive.fetch_add(1); }
+    Counted(const Counted& other) : value(other.value) { alive.fetch_add(1); }
+    Counted& operator=(const Counted& other) { value = other.value; return *this; }
+    ~Counted() { alive.fetch_sub(1); }
+    bool operator<(const Counted& other) const { return value < other.value; }
+};
+std::atomic<int> Counted::alive(0);
+
+void testBasicOperations() {
+    std::cout << "Testing basic operations..." << std::endl;
+
+    ConcurrentSkipList<int> list;
+    assert(list.empty() && list.size() == 0 && "New list should be empty");
+
+    int values[] = {5, 1, 9, 3, 7};
+    for (int i = 0; i < 5; ++i) {
+        assert(list.insert(values[i]) && "Insert of a new value should succeed");
+    }
+    assert(!list.insert(3) && "Duplicate insert should fail");
+    assert(list.size() == 5 && !list.empty() && "Size should be 5");
+
+    assert(list.contains(1) && list.contains(9) && "Inserted values should be found");
+    assert(!list.contains(4) && !list.contains(10) && "Missing values should not be found");
+
+    std::vector<int> all = list.range(0, 100);
+    int expected[] = {1, 3, 5, 7, 9};
+    assert(all.size() == 5 && "Range should cover all elements");
+    for (int i = 0; i < 5; ++i) {
+        assert(all[i] == expected[i] && "Range should be in ascending order");
+    }
+    std::vector<int> part = list.range(3, 9);
+    assert(part.size() == 3 && part[0] == 3 && part[2] == 7 && "Range should be half-open [low, high)");
+
+    assert(list.remove(5) && "Remove of an existing value should succeed");
+    assert(!list.remove(5) && "Second remove should fail");
+    assert(!list.contains(5) && list.size() == 4 && "Removed value should be gone");
+    assert(list.insert(5) && list.contains(5) && "Removed value can be inserted again");
+
+    ConcurrentSkipList<std::string, std::greater<std::string>> strList;
+    strList.insert("apple");
+    strList.insert("cherry");
+    strList.insert("banana");
+    std::vector<std::string> strs = strList.range("z", "a");
+    assert(strs.size() == 3 && strs[0] == "cherry" && strs[2] == "apple" && "Custom comparator should order elements");
+
+    std::cout << "Basic operations tests passed!" << std::endl;
+}
+
+// 单线程随机操作，与 std::set 对照
+void testAgainstSet() {
+    std::cout << "Testing random operations against std::set..." << std::endl;
+
+    ConcurrentSkipList<int> list;
+    std::set<int> reference;
+    std::srand(12345);
+    for (int i = 0; i < 50000; ++i) {
+        int key = std::rand() % 2000;
+        int op = std::rand() % 3;
+        if (op == 0) {
+            assert(list.insert(key) == reference.insert(key).second && "Insert result should match std::set");
+        } else if (op == 1) {
+            assert(list.remove(key) == (reference.erase(key) == 1) && "Remove result should match std::set");
+        } else {
+            assert(list.contains(key) == (reference.count(key) == 1) && "Contains result should match std::set");
+        }
+    }
+    assert(list.size() == reference.size() && "Size should match std::set");
+    std::vector<int> all = list.range(-1, 2000);
+    assert(std::vector<int>(reference.begin(), reference.end()) == all && "Contents should match std::set");
+
+    std::cout << "Random operations tests passed!" << std::endl;
+}
+
+// 多线程插入不相交的键，再并发删除其中的偶数键，最后内容确定
+void testConcurrentInsertRemove(int threadCount) {
+    std::cout << "Testing " << threadCount << " threads insert/remove..." << std::endl;
+
+    const int perThread = 20000;
+    ConcurrentSkipList<int> list;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.push_back(std::thread([&list, t, threadCount]() {
+            // 交错的键让各线程在同一区域竞争
+            for (int i = 0; i < perThread; ++i) {
+                assert(list.insert(i * threadCount + t) && "Disjoint insert should succeed");
+            }
+        }));
+    }
+    for (size_t i = 0; i < threads.size(); ++i) {
+        threads[i].join();
+    }
+    threads.clear();
+    const int total = perThread * threadCount;
+    assert(list.size() == static_cast<size_t>(total) && "All keys should be present");
+
+    // 每个偶数键由所有线程同时尝试删除，恰好一个线程成功
+    std::atomic<int> removed(0);
+    for (int t = 0; t < threadCount; ++t) {
+        threads.push_back(std::thread([&list, &removed, total]() {
+            int mine = 0;
+            for (int k = 0; k < total; k += 2) {
+                if (list.remove(k)) {
+                    ++mine;
+                }
+            }
+            removed.fetch_add(mine);
+        }));
+    }
+    for (size_t i = 0; i < threads.size(); ++i) {
+        threads[i].join();
+    }
+    assert(removed.load() == total / 2 && "Each even key should be removed exactly once");
+
+    std::vector<int> rest = list.range(0, total);
+    assert(rest.size() == static_cast<size_t>(total - total / 2) && "Only odd keys should remain");
+    for (size_t i = 0; i < rest.size(); ++i) {
+        assert(rest[i] == static_cast<int>(2 * i + 1) && "Remaining keys should be the odd ones in order");
+    }
+
+    std::cout << "Concurrent insert/remove tests passed!" << std::endl;
+}
+
+// 写线程反复插入、删除自己的键，读线程同时做范围遍历：
+// 从不删除的键每次都要被遍历到，且遍历结果严格递增
+void testConcurrentRange() {
+    std::cout << "Testing range iteration under concurrent updates..." << std::endl;
+
+    const int keys = 4000;
+    ConcurrentSkipList<int> list;
+    for (int k = 0; k < keys; k += 4) {
+        list.insert(k);   // 4 的倍数始终存在
+    }
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> writers;
+    for (int t = 1; t <= 3; ++t) {
+        writers.push_back(std::thread([&list, &stop, t]() {
+            std::uint32_t seed = 17 * t;
+            while (!stop.load()) {
+                seed = seed * 1103515245u + 12345u;
+                int k = static_cast<int>((seed >> 8) % (keys / 4)) * 4 + t;
+                if (!list.insert(k)) {
+                    list.remove(k);
+                }
+            }
+        }));
+    }
+    for (int round = 0; round < 200; ++round) {
+        int last = -1;
+        int stable = 0;
+        list.forEachInRange(0, keys, [&last, &stable](const int& k) {
+            assert(k > last && "Range iteration should be strictly increasing");
+            last = k;
+            if (k % 4 == 0) {
+                ++stable;
+            }
+        });
+        assert(stable == keys / 4 && "Keys that are never removed should always be visited");
+    }
+    stop.store(true);
+    for (size_t i = 0; i < writers.size(); ++i) {
+        writers[i].join();
+    }
+
+    std::cout << "Concurrent range tests passed!" << std::endl;
+}
+
+// 删除的节点最终都会被回收
+void testReclamation() {
+    std::cout << "Testing memory reclamation..." << std::endl;
+
+    {
+        ConcurrentSkipList<Counted> list;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.push_back(std::thread([&list, t]() {
+                for (int i = 0; i < 5000; ++i) {
+                    int k = (i * 7 + t) % 512;
+                    if (!list.insert(Counted(k))) {
+                        list.remove(Counted(k));
+                    }
+                }
+            }));
+        }
+        for (size_t i = 0; i < threads.size(); ++i) {
+            threads[i].join();
+        }
+        assert(Counted::alive.load() >= static_cast<int>(list.size()) && "Live elements must not be freed");
+    }
+    // 全局纪元推进两次后，已退出线程遗留的节点也可以释放
+    for (int i = 0; i < 3; ++i) {
+        ConcurrentSkipList<Counted>::collect();
+    }
+    assert(Counted::alive.load() == 0 && "All retired nodes should be reclaimed");
+
+    std::cout << "Memory reclamation tests passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testBasicOperations();
+        testAgainstSet();
+        testConcurrentInsertRemove(1);
+        testConcurrentInsertRemove(4);
+        testConcurrentRange();
+        testReclamation();
+
+        std::cout << "\nAll tests passed successfully!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,225 @@
+#ifndef EPOCH_RECLAIM_HPP
+#define EPOCH_RECLAIM_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// 基于纪元（Epoch-Based Reclamation）的内存回收
+// 全局维护一个单调递增的纪元号。线程访问共享节点前进入临界区（pin），记下当时的全局纪元；
+// 被摘除的节点放入本线程的待回收列表，并标上摘除时的全局纪元 e。
+// 只有当所有处于临界区的线程都已看到当前纪元时，全局纪元才能加一；
+// 全局纪元达到 e + 2 时，摘除节点之前进入临界区的线程都已离开，节点可以安全释放。
+// 与危险指针相比，读操作只需在进出临界区时各写一次本线程的记录，不必为每个节点发布指针，
+// 代价是一个长时间停留在临界区的线程会阻止所有回收。
+namespace epoch {
+
+// 每个线程占用一条记录，记录在线程退出后被标记为空闲供其他线程复用
+struct Record {
+    // 低位为 1 表示处于临界区，其余位为进入临界区时看到的全局纪元
+    std::atomic<std::uint64_t> state;
+    std::atomic<bool> active;
+    Record* next;
+
+    Record() : state(0), active(true), next(nullptr) {}
+};
+
+// 待回收节点、释放函数及摘除时的全局纪元
+struct Retired {
+    void* ptr;
+    void (*deleter)(void*);
+    std::uint64_t epoch;
+};
+
+class Domain {
+private:
+    std::atomic<std::uint64_t> global;
+    std::atomic<Record*> head;
+    std::mutex orphanMutex;
+    std::vector<Retired> orphans;   // 已退出线程遗留、暂时无法释放的节点
+
+public:
+    Domain() : global(0), head(nullptr) {}
+
+    ~Domain() {
+        // 程序退出时不再有线程访问节点，全部释放
+        for (size_t i = 0; i < orphans.size(); ++i) {
+            orphans[i].deleter(orphans[i].ptr);
+        }
+        Record* r = head.load();
+        while (r != nullptr) {
+            Record* next = r->next;
+            delete r;
+            r = next;
+        }
+    }
+
+    Domain(const Domain&) = delete;
+    Domain& operator=(const Domain&) = delete;
+
+    // 获取一条空闲记录，没有则新建并挂到链表头部
+    Record* acquire() {
+        for (Record* r = head.load(std::memory_order_acquire); r != nullptr; r = r->next) {
+            bool expected = false;
+            if (!r->active.load(std::memory_order_relaxed) &&
+                r->active.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                return r;
+            }
+        }
+        Record* r = new Record;
+        Record* old = head.load(std::memory_order_relaxed);
+        do {
+            r->next = old;
+        } while (!head.compare_exchange_weak(old, r, std::memory_order_release,
+                                             std::memory_order_relaxed));
+        return r;
+    }
+
+    void release(Record* r) {
+        r->state.store(0, std::memory_order_release);
+        r->active.store(false, std::memory_order_release);
+    }
+
+    std::uint64_t current() const {
+        return global.load(std::memory_order_seq_cst);
+    }
+
+    // 所有处于临界区的线程都已看到当前纪元时，把全局纪元加一
+    bool tryAdvance() {
+        std::uint64_t e = global.load(std::memory_order_seq_cst);
+        for (Record* r = head.load(std::memory_order_acquire); r != nullptr; r = r->next) {
+            std::uint64_t s = r->state.load(std::memory_order_seq_cst);
+            if ((s & 1) != 0 && (s >> 1) != e) {
+                return false;
+            }
+        }
+        return global.compare_exchange_strong(e, e + 1, std::memory_order_seq_cst);
+    }
+
+    // 释放 list 中摘除时间足够早（纪元不晚于全局纪元 - 2）的节点，其余保留在 list 中
+    void reclaim(std::vector<Retired>& list) {
+        std::uint64_t e = global.load(std::memory_order_seq_cst);
+        size_t kept = 0;
+        for (size_t i = 0; i < list.size(); ++i) {
+            if (list[i].epoch + 2 <= e) {
+                list[i].deleter(list[i].ptr);
+            } else {
+                list[kept++] = list[i];
+            }
+        }
+        list.resize(kept);
+    }
+
+    // 顺带回收已退出线程遗留的节点，其他线程正在处理时直接跳过
+    void reclaimOrphans() {
+        std::unique_lock<std::mutex> lock(orphanMutex, std::try_to_lock);
+        if (lock.owns_lock() && !orphans.empty()) {
+            reclaim(orphans);
+        }
+    }
+
+    // 线程退出时移交无法立即释放的节点
+    void adopt(std::vector<Retired>& list) {
+        std::lock_guard<std::mutex> lock(orphanMutex);
+        orphans.insert(orphans.end(), list.begin(), list.end());
+        list.clear();
+    }
+};
+
+inline Domain& defaultDomain() {
+    static Domain domain;
+    return domain;
+}
+
+// 线程本地状态：本线程的纪元记录、临界区嵌套深度和待回收列表
+class ThreadState {
+private:
+    static const size_t COLLECT_THRESHOLD = 64;   // 待回收列表达到该长度时尝试推进纪元并回收
+
+    Domain& domain;
+    Record* record;
+    int depth;
+    std::vector<Retired> retired;
+
+public:
+    ThreadState() : domain(defaultDomain()), record(domain.acquire()), depth(0) {}
+
+    ~ThreadState() {
+        domain.release(record);
+        collect();
+        if (!retired.empty()) {
+            domain.adopt(retired);
+        }
+    }
+
+    ThreadState(const ThreadState&) = delete;
+    ThreadState& operator=(const ThreadState&) = delete;
+
+    // 进入临界区，可以嵌套。发布纪元后的全序栅栏保证：
+    // 之后读到的节点要么尚未被摘除，要么摘除时的纪元不早于此处发布的纪元
+    void pin() {
+        if (depth++ == 0) {
+            std::uint64_t e = domain.current();
+            record->state.store((e << 1) | 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+    }
+
+    void unpin() {
+        if (--depth == 0) {
+            record->state.store(0, std::memory_order_release);
+        }
+    }
+
+    // 节点已从共享结构中摘除，延迟到所有可能持有它的线程离开临界区后释放
+    void retire(void* p, void (*deleter)(void*)) {
+        Retired r;
+        r.ptr = p;
+        r.deleter = deleter;
+        r.epoch = domain.current();
+        retired.push_back(r);
+        if (retired.size() >= COLLECT_THRESHOLD) {
+            collect();
+        }
+    }
+
+    // 尝试推进全局纪元，并释放本线程和已退出线程遗留的可回收节点
+    void collect() {
+        domain.tryAdvance();
+        domain.reclaim(retired);
+        domain.reclaimOrphans();
+    }
+
+    size_t pendingCount() const {
+        return retired.size();
+    }
+};
+
+inline ThreadState& threadState() {
+    static thread_local ThreadState state;
+    return state;
+}
+
+// 作用域内处于临界区
+class Guard {
+private:
+    ThreadState& state;
+
+public:
+    Guard() : state(threadState()) {
+        state.pin();
+    }
+
+    ~Guard() {
+        state.unpin();
+    }
+
+    Guard(const Guard&) = delete;
+    Guard& operator=(const Guard&) = delete;
+};
+
+} // namespace epoch
+
+#endif // EPOCH_RECLAIM_HPP
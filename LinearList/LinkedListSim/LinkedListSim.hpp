@@ -4,58 +4,233 @@
 #include <iostream>
 #include <stdexcept>
 #include <vector>
+#include <algorithm>
+#include <utility>
+#include <limits>
+#include <type_traits>
 
-template<typename T, size_t N = 100000>
+// 槽位存储布局。每种布局提供 Storage<T, Index>：value(i) 访问数据，link(i)/setLink(i, v)
+// 访问下一个节点的位置（-1 表示空），resize/resetLinks 管理槽位
+
+// 数据和 next 分别存放在两个数组中（SoA）。只沿链接走的操作只读 next 数组，
+// 元素较大时更省带宽；同时访问数据和链接时每一步要读两个缓存行
+struct SoALayout {
+    template<typename T, typename Index>
+    class Storage {
+    private:
+        std::vector<T> values;
+        std::vector<Index> links;
+
+    public:
+        explicit Storage(size_t n) : values(n), links(n, static_cast<Index>(-1)) {}
+
+        size_t size() const { return links.size(); }
+
+        void resize(size_t n) {
+            values.resize(n);
+            links.resize(n, static_cast<Index>(-1));
+        }
+
+        T& value(int i) { return values[i]; }
+        const T& value(int i) const { return values[i]; }
+        int link(int i) const { return links[i]; }
+        void setLink(int i, int v) { links[i] = static_cast<Index>(v); }
+
+        void resetLinks() {
+            std::fill(links.begin(), links.end(), static_cast<Index>(-1));
+        }
+
+        static size_t bytesPerSlot() { return sizeof(T) + sizeof(Index); }
+    };
+};
+
+// 数据和 next 交错存放在同一个数组中（AoS）。每一步只读一个缓存行，元素较小时更快
+struct AoSLayout {
+    template<typename T, typename Index>
+    class Storage {
+    private:
+        struct Slot {
+            T value;
+            Index next;
+
+            Slot() : value(), next(-1) {}
+        };
+
+        std::vector<Slot> slots;
+
+    public:
+        explicit Storage(size_t n) : slots(n) {}
+
+        size_t size() const { return slots.size(); }
+
+        void resize(size_t n) { slots.resize(n); }
+
+        T& value(int i) { return slots[i].value; }
+        const T& value(int i) const { return slots[i].value; }
+        int link(int i) const { return slots[i].next; }
+        void setLink(int i, int v) { slots[i].next = static_cast<Index>(v); }
+
+        void resetLinks() {
+            for (size_t i = 0; i < slots.size(); ++i) {
+                slots[i].next = -1;
+            }
+        }
+
+        static size_t bytesPerSlot() { return sizeof(Slot); }
+    };
+};
+
+// N 为默认容量（槽位数）。可以在构造时指定其他容量，并选择槽位用完时是否自动扩容。
+// Layout 为槽位布局（SoALayout 或 AoSLayout），Index 为保存在槽位中的位置类型
+// （int、int32_t 或 int16_t），容量不能超过 Index 能表示的最大位置 + 1
+template<typename T, size_t N = 100000, typename Layout = SoALayout, typename Index = int>
 class LinkedListSim {
 private:
-    std::vector<T> data;      // 存储节点数据
-    std::vector<int> next;    // 存储下一个节点的位置
+    static_assert(std::is_integral<Index>::value && std::is_signed<Index>::value &&
+                  sizeof(Index) <= sizeof(int), "Index must be a signed integer no wider than int");
+
+    typedef typename Layout::template Storage<T, Index> Storage;
+
+    Storage store;            // 槽位：节点数据和下一个节点的位置；空闲槽位的链接串成空闲链表
     int head;                 // 头节点位置
-    int firstFree;           // 第一个可用位置
+    int tail;                 // 尾节点位置，空表时为 -1
+    int freeHead;             // 空闲链表（已删除节点的槽位）的第一个槽位，没有时为 -1
+    int firstFree;           // 从未使用过的第一个槽位
     size_t length;           // 链表长度
+    bool growable;           // 槽位用完时是否自动扩容
+    double compactThreshold; // 自动紧缩的碎片率阈值，0 表示关闭
+    size_t modifications;    // 上次检查碎片率之后的结构修改次数
+
+    size_t slots() const {
+        return store.size();
+    }
+
+    static void checkCapacity(size_t capacity) {
+        if (capacity == 0) {
+            throw std::invalid_argument("Capacity must be positive");
+        }
+        if (capacity > maxCapacity()) {
+            throw std::invalid_argument("Capacity exceeds the range of the index type");
+        }
+    }
+
+    // 是否还能取得新节点（不扩容）
+    bool hasFreeSlot() const {
+        return freeHead != -1 || static_cast<size_t>(firstFree) < slots();
+    }
 
-    // 获取新节点的位置
+    // 容量倍增（不超过 maxCapacity()），已有槽位的下标不变
+    void grow() {
+        size_t newSlots = std::min(slots() * 2, maxCapacity());
+        store.resize(newSlots);
+    }
+
+    // 获取新节点的位置：优先复用已删除节点的槽位，其次使用从未用过的槽位
     int getNewNode() {
-        if (firstFree >= N) {
-            throw std::runtime_error("No space available");
+        if (freeHead != -1) {
+            int pos = freeHead;
+            freeHead = store.link(pos);
+            return pos;
+        }
+        if (static_cast<size_t>(firstFree) >= slots()) {
+            if (!growable || slots() >= maxCapacity()) {
+                throw std::runtime_error("No space available");
+            }
+            grow();
         }
         int pos = firstFree;
         firstFree++;
         return pos;
     }
 
+    // 槽位放回空闲链表
+    void releaseNode(int pos) {
+        store.setLink(pos, freeHead);
+        freeHead = pos;
+    }
+
+    // 第 index 个元素的前驱位置，index 为 1 时返回 -1，index 为 length + 1 时直接返回尾节点
+    int prevOf(int index) const {
+        if (index == 1) {
+            return -1;
+        }
+        if (static_cast<size_t>(index) == length + 1) {
+            return tail;
+        }
+        int p = head;
+        for (int i = 1; i < index - 1; ++i) {
+            p = store.link(p);
+        }
+        return p;
+    }
+
+    // 在前驱 prev 之后链接新节点 pos，prev 为 -1 时作为头节点
+    void linkAfter(int prev, int pos) {
+        if (prev == -1) {
+            store.setLink(pos, head);
+            head = pos;
+        } else {
+            store.setLink(pos, store.link(prev));
+            store.setLink(prev, pos);
+        }
+        if (store.link(pos) == -1) {
+            tail = pos;
+        }
+        ++length;
+        noteModification();
+    }
+
+    // 开启自动紧缩时，每累计一定次数的结构修改检查一次碎片率（O(n)），超过阈值则紧缩
+    void noteModification() {
+        if (compactThreshold <= 0) {
+            return;
+        }
+        size_t interval = length / 2 > 64 ? length / 2 : 64;
+        if (++modifications < interval) {
+            return;
+        }
+        modifications = 0;
+        if (fragmentation() > compactThreshold) {
+            compact();
+        }
+    }
+
 public:
-    // 构造函数
-    LinkedListSim() : data(N), next(N, -1), head(-1), firstFree(1), length(0) {}
+    typedef T value_type;
+
+    // 构造函数，容量为 N，不自动扩容
+    LinkedListSim()
+        : store(N), head(-1), tail(-1), freeHead(-1), firstFree(0), length(0),
+          growable(false), compactThreshold(0), modifications(0) {
+        static_assert(N > 0 && N - 1 <= static_cast<size_t>(std::numeric_limits<Index>::max()),
+                      "N must fit in the index type");
+    }
+
+    // 指定初始容量，grow 为 true 时槽位用完后容量倍增
+    explicit LinkedListSim(size_t capacity, bool grow = false)
+        : store((checkCapacity(capacity), capacity)), head(-1), tail(-1), freeHead(-1), firstFree(0), length(0),
+          growable(grow), compactThreshold(0), modifications(0) {}
 
     // 头插法
     void insertHead(const T& element) {
         int pos = getNewNode();
-        data[pos] = element;
-        next[pos] = head;
-        head = pos;
-        ++length;
+        store.value(pos) = element;
+        linkAfter(-1, pos);
     }
 
-    // 尾插法
+    // 尾插法，利用尾节点位置为 O(1)。与其他插入操作一样，没有可用槽位时抛出异常
     bool append(const T& element) {
-        if (firstFree >= N) {
-            return false;
-        }
         int pos = getNewNode();
-        data[pos] = element;
-        next[pos] = -1;
-
-        if (head == -1) {
+        store.value(pos) = element;
+        store.setLink(pos, -1);
+        if (tail == -1) {
             head = pos;
         } else {
-            int p = head;
-            while (next[p] != -1) {
-                p = next[p];
-            }
-            next[p] = pos;
+            store.setLink(tail, pos);
         }
+        tail = pos;
         ++length;
+        noteModification();
         return true;
     }
 
@@ -65,47 +240,34 @@ public:
             return false;
         }
 
-        if (index == 1) {
-            insertHead(element);
-            return true;
-        }
-
+        int prev = prevOf(index);
         int pos = getNewNode();
-        data[pos] = element;
-
-        int p = head;
-        for (int i = 1; i < index - 1; ++i) {
-            p = next[p];
-        }
-
-        next[pos] = next[p];
-        next[p] = pos;
-        ++length;
+        store.value(pos) = element;
+        linkAfter(prev, pos);
         return true;
     }
 
-    // 删除指定位置的元素
+    // 删除指定位置的元素，槽位进入空闲链表供之后的插入复用
     bool remove(int index, T& element) {
         if (index < 1 || index > length) {
             return false;
         }
 
-        int toDelete;
-        if (index == 1) {
-            toDelete = head;
-            head = next[head];
+        int prev = prevOf(index);
+        int toDelete = prev == -1 ? head : store.link(prev);
+        if (prev == -1) {
+            head = store.link(toDelete);
         } else {
-            int p = head;
-            for (int i = 1; i < index - 1; ++i) {
-                p = next[p];
-            }
-            toDelete = next[p];
-            next[p] = next[toDelete];
+            store.setLink(prev, store.link(toDelete));
+        }
+        if (toDelete == tail) {
+            tail = prev;
         }
 
-        element = data[toDelete];
-        next[toDelete] = -1;  // 标记为已删除
+        element = std::move(store.value(toDelete));
+        releaseNode(toDelete);
         --length;
+        noteModification();
         return true;
     }
 
@@ -117,9 +279,9 @@ public:
 
         int p = head;
         for (int i = 1; i < index; ++i) {
-            p = next[p];
+            p = store.link(p);
         }
-        element = data[p];
+        element = store.value(p);
         return true;
     }
 
@@ -131,9 +293,9 @@ public:
 
         int p = head;
         for (int i = 1; i < index; ++i) {
-            p = next[p];
+            p = store.link(p);
         }
-        data[p] = element;
+        store.value(p) = element;
         return true;
     }
 
@@ -142,47 +304,124 @@ public:
         int p = head;
         int index = 1;
         while (p != -1) {
-            if (data[p] == element) {
+            if (store.value(p) == element) {
                 return index;
             }
-            p = next[p];
+            p = store.link(p);
             ++index;
         }
         return 0;
     }
 
+    // 紧缩：按链表顺序把元素重新写入从 0 号开始的连续槽位，next 改为指向下一个槽位。
+    // 之后遍历为顺序访问，空闲链表中的槽位也并入表尾之后的连续空闲区。O(n)
+    void compact() {
+        modifications = 0;
+        std::vector<T> values;
+        values.reserve(length);
+        for (int p = head; p != -1; p = store.link(p)) {
+            values.push_back(std::move(store.value(p)));
+        }
+        int n = static_cast<int>(values.size());
+        for (int i = 0; i < n; ++i) {
+            store.value(i) = std::move(values[i]);
+            store.setLink(i, i + 1 < n ? i + 1 : -1);
+        }
+        for (int i = n; i < firstFree; ++i) {
+            store.setLink(i, -1);
+        }
+        head = n > 0 ? 0 : -1;
+        tail = n - 1;
+        freeHead = -1;
+        firstFree = n;
+    }
+
+    // 碎片率：相邻两个元素之间的链接中，下一个元素不在紧随其后的槽位里的比例，范围 [0, 1]
+    double fragmentation() const {
+        if (length < 2) {
+            return 0;
+        }
+        size_t far = 0;
+        for (int p = head; store.link(p) != -1; p = store.link(p)) {
+            if (store.link(p) != p + 1) {
+                ++far;
+            }
+        }
+        return static_cast<double>(far) / (length - 1);
+    }
+
+    // 开启自动紧缩：碎片率超过 threshold（0~1）时自动调用 compact()，传 0 关闭
+    void setAutoCompact(double threshold) {
+        compactThreshold = threshold;
+        modifications = 0;
+    }
+
     // 获取长度
     size_t size() const {
         return length;
     }
 
+    // 当前容量（槽位数）
+    size_t capacity() const {
+        return slots();
+    }
+
+    // Index 能表示的最大容量
+    static size_t maxCapacity() {
+        return static_cast<size_t>(std::numeric_limits<Index>::max()) + 1;
+    }
+
+    // 每个槽位占用的字节数（含对齐填充）
+    static size_t bytesPerSlot() {
+        return Storage::bytesPerSlot();
+    }
+
+    // 预留至少 n 个槽位，n 超过 maxCapacity() 时抛出 std::invalid_argument
+    void reserve(size_t n) {
+        if (n > slots()) {
+            checkCapacity(n);
+            store.resize(n);
+        }
+    }
+
+    bool isGrowable() const {
+        return growable;
+    }
+
+    void setGrowable(bool value) {
+        growable = value;
+    }
+
     // 判断是否为空
     bool empty() const {
         return length == 0;
     }
 
-    // 判断是否已满
+    // 判断是否已满：没有可复用或未使用的槽位，且不能扩容
     bool full() const {
-        return firstFree >= N;
+        return !hasFreeSlot() && (!growable || slots() >= maxCapacity());
     }
 
-    // 清空链表
+    // 清空链表，容量保持不变
     void clear() {
         head = -1;
-        firstFree = 1;
+        tail = -1;
+        freeHead = -1;
+        firstFree = 0;
         length = 0;
-        std::fill(next.begin(), next.end(), -1);
+        modifications = 0;
+        store.resetLinks();
     }
 
     // 打印链表
     void print() const {
         int p = head;
         while (p != -1) {
-            std::cout << data[p];
-            if (next[p] != -1) {
+            std::cout << store.value(p);
+            if (store.link(p) != -1) {
                 std::cout << " -> ";
             }
-            p = next[p];
+            p = store.link(p);
         }
         std::cout << std::endl;
     }
@@ -0,0 +1,77 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+#include "LinkedListSim.hpp"
+
+// 紧缩前后的遍历性能测试：把 n 个元素逐个插入到随机位置（构造本身为 O(n^2)），
+// 链表顺序与槽位顺序随机对应；分别测量 compact() 前后遍历一遍（locate 一个不存在的值）
+// 的耗时和碎片率。元素类型为 int 和 256 字节的记录。
+// 用法：./LinkedListSimBenchmark [n]
+//   默认 n = 20000，不能超过 kSlots
+
+typedef std::chrono::steady_clock Clock;
+
+static const size_t kSlots = 1 << 17;
+
+static volatile long sink;
+
+struct Record {
+    int key;
+    char payload[252];
+
+    Record() : key(0) {}
+    Record(int k) : key(k) {}
+    bool operator==(const Record& other) const { return key == other.key; }
+};
+
+static double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+template<typename List>
+double traverseMs(const List& list) {
+    double best = 0;
+    for (int round = 0; round < 5; ++round) {
+        Clock::time_point start = Clock::now();
+        sink = sink + list.locate(-1);
+        double ms = elapsedMs(start);
+        if (round == 0 || ms < best) {
+            best = ms;
+        }
+    }
+    return best;
+}
+
+template<typename T>
+void run(const char* name, int n) {
+    // 容量很大，放在堆上
+    LinkedListSim<T, kSlots>* list = new LinkedListSim<T, kSlots>();
+    for (int i = 0; i < n; ++i) {
+        list->insert(std::rand() % (i + 1) + 1, T(i));
+    }
+
+    std::cout << std::setw(8) << name << std::fixed << std::setprecision(3)
+              << std::setw(14) << list->fragmentation() << std::setw(14) << traverseMs(*list);
+    Clock::time_point start = Clock::now();
+    list->compact();
+    double compactMs = elapsedMs(start);
+    std::cout << std::setw(14) << list->fragmentation() << std::setw(14) << traverseMs(*list)
+              << std::setw(14) << compactMs << std::endl;
+    delete list;
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc > 1 ? std::atoi(argv[1]) : 20000;
+    if (n < 2 || static_cast<size_t>(n) >= kSlots) {
+        std::cerr << "n must be in [2, " << kSlots << ")" << std::endl;
+        return 1;
+    }
+
+    std::cout << n << " elements inserted at random positions, traverse in ms" << std::endl;
+    std::cout << std::setw(8) << "type" << std::setw(14) << "frag before" << std::setw(14) << "traverse"
+              << std::setw(14) << "frag after" << std::setw(14) << "traverse" << std::setw(14) << "compact ms" << std::endl;
+    run<int>("int", n);
+    run<Record>("record", n);
+    return 0;
+}
@@ -0,0 +1,160 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include "LinkedListSim.hpp"
+
+// 槽位布局的性能测试矩阵：元素大小 × 表长 × 链表顺序 × 操作，对比
+//   soa32 / aos32 ：SoALayout / AoSLayout，32 位位置
+//   soa16 / aos16 ：同上，16 位位置（只在表长不超过 32768 时运行）
+// 操作（每个元素的平均耗时，ns）：
+//   walk ：get(size())，只沿链接走到表尾
+//   scan ：locate 一个不存在的值，每一步都读取元素
+// 链表顺序：
+//   seq  ：尾插法构造，链表顺序与槽位顺序一致
+//   rand ：再做若干轮"逐个删除表头，再随机头插或尾插"，删除的槽位按后进先出复用，
+//          每轮相当于一次逆向洗牌，之后相邻元素落在随机的槽位上
+// 用法：./LinkedListSimLayoutBenchmark [maxN] [maxBytes]
+//   表长从 1000、30000 起每次乘 ~33 直到 maxN（默认 10^6），
+//   跳过元素总字节数超过 maxBytes（默认 256 MiB）的组合
+
+typedef std::chrono::steady_clock Clock;
+
+static volatile long sink;
+
+// 大小为 Bytes 的元素，key 参与比较
+template<size_t Bytes>
+struct Payload {
+    int key;
+    char pad[Bytes - sizeof(int)];
+
+    Payload() : key(0) {}
+    Payload(int k) : key(k) {}
+    bool operator==(const Payload& other) const { return key == other.key; }
+};
+
+template<>
+struct Payload<sizeof(int)> {
+    int key;
+
+    Payload() : key(0) {}
+    Payload(int k) : key(k) {}
+    bool operator==(const Payload& other) const { return key == other.key; }
+};
+
+static const int kShufflePasses = 12;
+
+template<typename List>
+void shuffle(List& list, int n) {
+    std::vector<typename List::value_type> popped(n);
+    for (int pass = 0; pass < kShufflePasses; ++pass) {
+        for (int i = 0; i < n; ++i) {
+            list.remove(1, popped[i]);
+        }
+        for (int i = n - 1; i >= 0; --i) {
+            if (std::rand() & 1) {
+                list.insertHead(popped[i]);
+            } else {
+                list.append(popped[i]);
+            }
+        }
+    }
+}
+
+// 重复执行 op 直到走过的元素足够多，取 3 轮中最快的一轮，返回每个元素的耗时
+template<typename Op>
+double measure(int n, Op op) {
+    long repeats = 32L * 1024 * 1024 / n;
+    if (repeats < 2) {
+        repeats = 2;
+    }
+    double best = 0;
+    for (int round = 0; round < 3; ++round) {
+        Clock::time_point start = Clock::now();
+        for (long r = 0; r < repeats; ++r) {
+            sink = sink + op();
+        }
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / repeats / n;
+        if (round == 0 || ns < best) {
+            best = ns;
+        }
+    }
+    return best;
+}
+
+template<typename List>
+struct WalkOp {
+    const List* list;
+    long operator()() const {
+        typename List::value_type value;
+        list->get(static_cast<int>(list->size()), value);
+        return value.key;
+    }
+};
+
+template<typename List>
+struct ScanOp {
+    const List* list;
+    long operator()() const { return list->locate(-1); }
+};
+
+template<typename List>
+void runLayout(int n, bool shuffled) {
+    List* list = new List(static_cast<size_t>(n));
+    for (int i = 0; i < n; ++i) {
+        list->append(i);
+    }
+    if (shuffled) {
+        shuffle(*list, n);
+    }
+    WalkOp<List> walk = {list};
+    ScanOp<List> scan = {list};
+    std::cout << std::fixed << std::setprecision(2)
+              << std::setw(8) << measure(n, walk) << std::setw(8) << measure(n, scan);
+    delete list;
+}
+
+template<size_t Bytes>
+void run(int maxN, long maxBytes) {
+    typedef Payload<Bytes> T;
+    std::cout << "\nelement " << Bytes << " bytes, bytes per slot: soa32 "
+              << LinkedListSim<T, 1, SoALayout, std::int32_t>::bytesPerSlot()
+              << ", aos32 " << LinkedListSim<T, 1, AoSLayout, std::int32_t>::bytesPerSlot()
+              << ", soa16 " << LinkedListSim<T, 1, SoALayout, std::int16_t>::bytesPerSlot()
+              << ", aos16 " << LinkedListSim<T, 1, AoSLayout, std::int16_t>::bytesPerSlot() << std::endl;
+    std::cout << std::setw(10) << "n" << std::setw(6) << "order"
+              << std::setw(16) << "soa32 walk/scan" << std::setw(16) << "aos32 walk/scan"
+              << std::setw(16) << "soa16 walk/scan" << std::setw(16) << "aos16 walk/scan" << std::endl;
+
+    const int lengths[] = {1000, 30000, 1000000, 30000000};
+    for (int k = 0; k < 4; ++k) {
+        int n = lengths[k];
+        if (n > maxN || static_cast<long>(n) * static_cast<long>(Bytes) > maxBytes) {
+            continue;
+        }
+        for (int shuffled = 0; shuffled <= 1; ++shuffled) {
+            std::cout << std::setw(10) << n << std::setw(6) << (shuffled ? "rand" : "seq");
+            runLayout<LinkedListSim<T, 1, SoALayout, std::int32_t>>(n, shuffled != 0);
+            runLayout<LinkedListSim<T, 1, AoSLayout, std::int32_t>>(n, shuffled != 0);
+            if (static_cast<size_t>(n) <= LinkedListSim<T, 1, SoALayout, std::int16_t>::maxCapacity()) {
+                runLayout<LinkedListSim<T, 1, SoALayout, std::int16_t>>(n, shuffled != 0);
+                runLayout<LinkedListSim<T, 1, AoSLayout, std::int16_t>>(n, shuffled != 0);
+            }
+            std::cout << std::endl;
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int maxN = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    long maxBytes = argc > 2 ? std::atol(argv[2]) : 256L * 1024 * 1024;
+
+    std::cout << "per element time in ns" << std::endl;
+    run<4>(maxN, maxBytes);
+    run<16>(maxN, maxBytes);
+    run<64>(maxN, maxBytes);
+    run<256>(maxN, maxBytes);
+    return 0;
+}
@@ -1,6 +1,8 @@
 #include "LinkedListSim.hpp"
 #include <cassert>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 void testBasicOperations() {
     std::cout << "Testing basic operations..." << std::endl;
@@ -152,6 +154,201 @@ void testCapacity() {
     std::cout << "Capacity limits tests passed!" << std::endl;
 }
 
+void testCompaction() {
+    std::cout << "Testing compaction..." << std::endl;
+
+    LinkedListSim<int, 20> list;
+    // 头插法使链表顺序与槽位顺序相反
+    for (int i = 1; i <= 10; ++i) {
+        list.insertHead(i);
+    }
+    int value;
+    assert(list.remove(5, value) && value == 6 && "Remove should succeed");
+    assert(list.fragmentation() == 1 && "Head-inserted list should be fully fragmented");
+
+    list.compact();
+    assert(list.fragmentation() == 0 && "Compacted list should be contiguous");
+    assert(list.size() == 9 && "Compaction should keep the size");
+    int expected[] = {10, 9, 8, 7, 5, 4, 3, 2, 1};
+    for (int i = 0; i < 9; ++i) {
+        assert(list.get(i + 1, value) && value == expected[i] && "Compaction should keep the order");
+    }
+
+    // 20 个槽位全部可用，紧缩后还能再放 11 个
+    for (int i = 0; i < 11; ++i) {
+        list.append(100 + i);
+    }
+    assert(list.full() && list.size() == 20 && "Compaction should keep every slot usable");
+    assert(list.get(20, value) && value == 110 && "Append after compaction should work");
+
+    // 清空后紧缩
+    list.clear();
+    list.compact();
+    assert(list.empty() && list.fragmentation() == 0 && "Compacting an empty list should be harmless");
+
+    // 自动紧缩
+    LinkedListSim<int, 4000> autoList;
+    autoList.setAutoCompact(0.5);
+    for (int i = 0; i < 1000; ++i) {
+        autoList.insertHead(i);
+    }
+    assert(autoList.fragmentation() < 0.6 && "Auto compaction should bound fragmentation");
+    assert(autoList.get(1, value) && value == 999 && autoList.get(1000, value) && value == 0 &&
+           "Auto compaction should keep the order");
+
+    std::cout << "Compaction tests passed!" << std::endl;
+}
+
+void testSlotReuse() {
+    std::cout << "Testing slot reuse..." << std::endl;
+
+    // 反复插入删除的次数远超容量，已删除节点的槽位被复用
+    LinkedListSim<int, 4> list;
+    int value;
+    for (int i = 0; i < 1000; ++i) {
+        assert(list.append(i) && "Append should reuse released slots");
+        assert(list.insert(1, -i) && "Insert should reuse released slots");
+        assert(list.remove(2, value) && value == i && "Remove should return the appended element");
+        assert(list.remove(1, value) && value == -i && "Remove should return the inserted element");
+    }
+    assert(list.empty() && !list.full() && "List should be empty after churn");
+
+    // 删除表尾后尾插仍然正确
+    list.append(1);
+    list.append(2);
+    list.append(3);
+    assert(list.remove(3, value) && value == 3 && "Remove tail should succeed");
+    assert(list.append(4) && list.insert(4, 5) && "Append after removing the tail should succeed");
+    assert(list.full() && "List should be full with 4 elements");
+    int expected[] = {1, 2, 4, 5};
+    for (int i = 0; i < 4; ++i) {
+        assert(list.get(i + 1, value) && value == expected[i] && "Tail should be maintained");
+    }
+    assert(list.remove(2, value) && !list.full() && "Remove should free a slot");
+    list.insertHead(0);
+    assert(list.get(1, value) && value == 0 && list.get(4, value) && value == 5 && "Head insert should reuse the slot");
+
+    // 删除到只剩一个元素再尾插
+    while (list.size() > 1) {
+        list.remove(1, value);
+    }
+    list.append(6);
+    assert(list.get(1, value) && value == 5 && list.get(2, value) && value == 6 && "Tail should survive removals");
+
+    std::cout << "Slot reuse tests passed!" << std::endl;
+}
+
+void testGrowablePool() {
+    std::cout << "Testing growable pool..." << std::endl;
+
+    LinkedListSim<std::string> list(2, true);
+    assert(list.capacity() == 2 && list.isGrowable() && "Initial capacity should be 2");
+    for (int i = 0; i < 100; ++i) {
+        assert(list.append(std::to_string(i)) && "Append should grow the pool");
+    }
+    assert(list.size() == 100 && list.capacity() == 128 && !list.full() && "Capacity should double");
+    list.insertHead("head");
+    std::string value;
+    assert(list.get(1, value) && value == "head" && list.get(101, value) && value == "99" && "Order should survive growth");
+
+    // 关闭扩容后恢复固定容量的行为
+    LinkedListSim<int> fixed(3);
+    fixed.append(1);
+    fixed.append(2);
+    fixed.append(3);
+    assert(fixed.full() && "Fixed pool should be full");
+    bool thrown = false;
+    try {
+        fixed.append(4);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown && fixed.size() == 3 && "Fixed pool should refuse appends when full");
+    fixed.setGrowable(true);
+    assert(!fixed.full() && fixed.append(4) && fixed.capacity() == 6 && "Enabling growth should allow appends");
+    fixed.reserve(100);
+    assert(fixed.capacity() == 100 && fixed.size() == 4 && "Reserve should keep the elements");
+
+    thrown = false;
+    try {
+        LinkedListSim<int> invalid(0);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown && "Zero capacity should throw");
+
+    std::cout << "Growable pool tests passed!" << std::endl;
+}
+
+// 在给定布局和位置类型下执行同一组操作，返回最终的元素序列
+template<typename List>
+std::vector<int> exerciseList(List& list) {
+    for (int i = 0; i < 50; ++i) {
+        list.append(i);
+        list.insertHead(-i);
+    }
+    int value;
+    for (int i = 0; i < 30; ++i) {
+        list.remove(i % 7 + 1, value);
+        list.insert(i % 5 + 1, 100 + i);
+    }
+    list.set(3, 1000);
+    list.compact();
+    list.append(2000);
+    std::vector<int> result;
+    for (size_t i = 1; i <= list.size(); ++i) {
+        list.get(static_cast<int>(i), value);
+        result.push_back(value);
+    }
+    return result;
+}
+
+void testLayouts() {
+    std::cout << "Testing layouts and index types..." << std::endl;
+
+    LinkedListSim<int, 128> soa;
+    LinkedListSim<int, 128, AoSLayout> aos;
+    LinkedListSim<int, 128, SoALayout, std::int16_t> soa16;
+    LinkedListSim<int, 128, AoSLayout, std::int16_t> aos16;
+    std::vector<int> expected = exerciseList(soa);
+    assert(expected.size() == 101 && "Reference list should hold 101 elements");
+    assert(exerciseList(aos) == expected && "AoS layout should behave like SoA");
+    assert(exerciseList(soa16) == expected && "16-bit SoA should behave like SoA");
+    assert(exerciseList(aos16) == expected && "16-bit AoS should behave like SoA");
+    assert(aos.locate(1000) == soa.locate(1000) && "Locate should agree across layouts");
+
+    // 槽位大小
+    assert((LinkedListSim<int, 128>::bytesPerSlot() == sizeof(int) + sizeof(int)) && "SoA int slot should be 8 bytes");
+    assert((LinkedListSim<char, 128, SoALayout, std::int16_t>::bytesPerSlot() == 3) && "SoA char slot with 16-bit index");
+    assert((LinkedListSim<char, 128, AoSLayout, std::int16_t>::bytesPerSlot() == 4) && "AoS char slot with 16-bit index");
+
+    // 16 位位置最多 32768 个槽位
+    assert((LinkedListSim<int, 128, SoALayout, std::int16_t>::maxCapacity() == 32768) && "16-bit index should allow 32768 slots");
+    bool thrown = false;
+    try {
+        LinkedListSim<int, 128, SoALayout, std::int16_t> tooLarge(40000);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown && "Capacity beyond the index range should throw");
+
+    // 扩容到上限后停止
+    LinkedListSim<char, 128, AoSLayout, std::int16_t> growing(20000, true);
+    for (int i = 0; i < 32768; ++i) {
+        growing.append('x');
+    }
+    assert(growing.capacity() == 32768 && growing.full() && "Growth should stop at the index range");
+    thrown = false;
+    try {
+        growing.insertHead('y');
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown && growing.size() == 32768 && "Insert beyond the index range should throw");
+
+    std::cout << "Layouts and index types tests passed!" << std::endl;
+}
+
 int main() {
     try {
         testBasicOperations();
@@ -160,6 +357,10 @@ int main() {
         testBoundaryConditions();
         testClear();
         testCapacity();
+        testCompaction();
+        testSlotReuse();
+        testGrowablePool();
+        testLayouts();
         
         std::cout << "\nAll tests passed successfully!" << std::endl;
         return 0;
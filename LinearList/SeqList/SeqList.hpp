@@ -3,6 +3,15 @@
 
 #include <stdexcept>
 #include <algorithm>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "SeqListSimd.hpp"
 
 template<typename T>
 class SeqList {
@@ -10,109 +19,336 @@ private:
     T* data;
     int maxSize;
     int length;
+    bool growable;
+
+    // 分配未构造的原始内存
+    static T* allocate(int n) {
+        return static_cast<T*>(::operator new(sizeof(T) * n));
+    }
+
+    // 析构 [first, first + n) 中的元素
+    static void destroy(T* first, int n) {
+        for (int i = 0; i < n; ++i) {
+            first[i].~T();
+        }
+    }
+
+    // 把 n 个元素从 src 整体搬到 dst（区间可以重叠），搬迁后 src 中的元素视为已析构
+    // 可平凡复制的类型直接 memmove，其余类型逐个移动构造再析构原对象
+    static void relocate(T* dst, T* src, int n) {
+        relocate(dst, src, n, std::integral_constant<bool, std::is_trivially_copyable<T>::value>());
+    }
+
+    static void relocate(T* dst, T* src, int n, std::true_type) {
+        if (n > 0) {
+            std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), sizeof(T) * n);
+        }
+    }
+
+    static void relocate(T* dst, T* src, int n, std::false_type) {
+        if (dst < src) {
+            for (int i = 0; i < n; ++i) {
+                new (dst + i) T(std::move(src[i]));
+                src[i].~T();
+            }
+        } else if (dst > src) {
+            for (int i = n - 1; i >= 0; --i) {
+                new (dst + i) T(std::move(src[i]));
+                src[i].~T();
+            }
+        }
+    }
+
+    // 更换为容量为 newSize 的缓冲区
+    void reallocate(int newSize) {
+        T* newData = allocate(newSize);
+        relocate(newData, data, length);
+        ::operator delete(data);
+        data = newData;
+        maxSize = newSize;
+    }
+
+    // 保证还能再放下 n 个元素，必要时按倍增扩容
+    bool ensureSpace(int n) {
+        if (length + n <= maxSize) {
+            return true;
+        }
+        if (!growable) {
+            return false;
+        }
+        int newSize = maxSize > 0 ? maxSize : 1;
+        while (newSize < length + n) {
+            newSize *= 2;
+        }
+        reallocate(newSize);
+        return true;
+    }
+
+    // 在下标 pos（从 0 开始）处腾出 n 个未构造的空位，调用前需保证容量足够
+    void openGap(int pos, int n) {
+        relocate(data + pos + n, data + pos, length - pos);
+    }
+
+    // 删除下标 [pos, pos + n) 的元素并把后面的元素整体前移
+    void closeGap(int pos, int n) {
+        destroy(data + pos, n);
+        relocate(data + pos, data + pos + n, length - pos - n);
+        length -= n;
+    }
+
+    // [first, last) 中是否有本表内的元素（例如把 begin()/end() 插入自身）
+    // 指向 T 的指针区间是连续的，直接比较两个区间；其他解引用得到 T 左值的迭代器逐个比较地址
+    template<typename It>
+    bool aliases(It first, It last) const {
+        typedef typename std::iterator_traits<It>::reference Ref;
+        typedef typename std::remove_cv<typename std::remove_reference<Ref>::type>::type Value;
+        return aliases(first, last, std::integral_constant<int,
+            !std::is_lvalue_reference<Ref>::value || !std::is_same<Value, T>::value ? 0 :
+            std::is_pointer<It>::value ? 2 : 1>());
+    }
+
+    template<typename It>
+    bool aliases(It, It, std::integral_constant<int, 0>) const {
+        return false;
+    }
+
+    template<typename It>
+    bool aliases(It first, It last, std::integral_constant<int, 1>) const {
+        std::less<const T*> less;
+        for (; first != last; ++first) {
+            const T* p = std::addressof(*first);
+            if (!less(p, data) && less(p, data + length)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template<typename It>
+    bool aliases(It first, It last, std::integral_constant<int, 2>) const {
+        std::less<const T*> less;
+        return less(first, data + length) && less(data, last);
+    }
+
+    template<typename InputIt>
+    bool insertRange(int index, InputIt first, InputIt last, std::input_iterator_tag) {
+        // 单趟迭代器无法预先得知长度，先收集到临时表中
+        SeqList temp(16, true);
+        for (; first != last; ++first) {
+            temp.append(*first);
+        }
+        return insert(index, std::make_move_iterator(temp.begin()), std::make_move_iterator(temp.end()));
+    }
+
+    template<typename ForwardIt>
+    bool insertRange(int index, ForwardIt first, ForwardIt last, std::forward_iterator_tag) {
+        int n = static_cast<int>(std::distance(first, last));
+        if (n == 0) {
+            return true;
+        }
+        if (aliases(first, last)) {
+            // 扩容和腾位都会搬动表内元素，先把区间复制出来
+            SeqList temp(n, true);
+            for (; first != last; ++first) {
+                temp.append(*first);
+            }
+            return insert(index, std::make_move_iterator(temp.begin()), std::make_move_iterator(temp.end()));
+        }
+        if (!ensureSpace(n)) {
+            return false;
+        }
+        int pos = index - 1;
+        openGap(pos, n);
+        int i = 0;
+        try {
+            for (; first != last; ++first, ++i) {
+                new (data + pos + i) T(*first);
+            }
+        } catch (...) {
+            // 撤销已构造的元素并把后面的元素移回原位
+            destroy(data + pos, i);
+            relocate(data + pos, data + pos + n, length - pos);
+            throw;
+        }
+        length += n;
+        return true;
+    }
 
 public:
-    // 构造函数
-    explicit SeqList(int size) : maxSize(size), length(0) {
+    // 构造函数，grow 为 true 时表满后自动扩容
+    explicit SeqList(int size, bool grow = false) : maxSize(size), length(0), growable(grow) {
         if (size <= 0) {
             throw std::invalid_argument("Size must be positive");
         }
-        data = new T[size];
+        data = allocate(size);
     }
 
     // 析构函数
     ~SeqList() {
-        delete[] data;
+        destroy(data, length);
+        ::operator delete(data);
     }
 
     // 拷贝构造函数
-    SeqList(const SeqList& other) : maxSize(other.maxSize), length(other.length) {
-        data = new T[maxSize];
-        for (int i = 0; i < length; ++i) {
-            data[i] = other.data[i];
+    SeqList(const SeqList& other) : maxSize(other.maxSize), length(0), growable(other.growable) {
+        data = allocate(maxSize);
+        try {
+            for (; length < other.length; ++length) {
+                new (data + length) T(other.data[length]);
+            }
+        } catch (...) {
+            destroy(data, length);
+            ::operator delete(data);
+            throw;
         }
     }
 
     // 赋值运算符
     SeqList& operator=(const SeqList& other) {
         if (this != &other) {
-            T* newData = new T[other.maxSize];
-            for (int i = 0; i < other.length; ++i) {
-                newData[i] = other.data[i];
-            }
-            delete[] data;
-            data = newData;
-            maxSize = other.maxSize;
-            length = other.length;
+            SeqList temp(other);
+            swap(temp);
+        }
+        return *this;
+    }
+
+    // 移动构造函数
+    SeqList(SeqList&& other) noexcept
+        : data(other.data), maxSize(other.maxSize), length(other.length), growable(other.growable) {
+        other.data = nullptr;
+        other.maxSize = 0;
+        other.length = 0;
+    }
+
+    // 移动赋值运算符
+    SeqList& operator=(SeqList&& other) noexcept {
+        if (this != &other) {
+            swap(other);
         }
         return *this;
     }
 
+    // 交换两个顺序表的内容
+    void swap(SeqList& other) noexcept {
+        std::swap(data, other.data);
+        std::swap(maxSize, other.maxSize);
+        std::swap(length, other.length);
+        std::swap(growable, other.growable);
+    }
+
     // 在末尾添加元素
     bool append(const T& element) {
+        if (length >= maxSize && growable) {
+            // element 可能引用表内元素，扩容前先复制
+            T copy(element);
+            return append(std::move(copy));
+        }
         if (length >= maxSize) {
             return false;
         }
-        data[length++] = element;
+        new (data + length) T(element);
+        ++length;
         return true;
     }
-    
-    // 在指定位置插入元素
-    bool insert(int index, const T& element) {
+
+    // 在末尾添加元素（移动）
+    bool append(T&& element) {
+        if (!ensureSpace(1)) {
+            return false;
+        }
+        new (data + length) T(std::move(element));
+        ++length;
+        return true;
+    }
+
+    // 在指定位置原地构造元素
+    template<typename... Args>
+    bool emplace(int index, Args&&... args) {
         if (index < 1 || index > length + 1) {
             return false;
         }
-        
-        if (length >= maxSize) {
+        if (length >= maxSize && !growable) {
             return false;
         }
-        
-        // 移动元素腾出空间
-        for (int i = length; i >= index; --i) {
-            data[i] = data[i-1];
+        // 先构造出元素，参数可能引用表内元素，且构造失败时表保持不变
+        T element(std::forward<Args>(args)...);
+        if (!ensureSpace(1)) {
+            return false;
         }
-        data[index-1] = element;
+        openGap(index - 1, 1);
+        new (data + index - 1) T(std::move(element));
         ++length;
         return true;
     }
-    
+
+    // 在指定位置插入元素
+    bool insert(int index, const T& element) {
+        return emplace(index, element);
+    }
+
+    // 在指定位置插入元素（移动）
+    bool insert(int index, T&& element) {
+        return emplace(index, std::move(element));
+    }
+
+    // 在指定位置插入区间 [first, last) 中的元素，后续元素只整体移动一次
+    template<typename InputIt,
+             typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+    bool insert(int index, InputIt first, InputIt last) {
+        if (index < 1 || index > length + 1) {
+            return false;
+        }
+        return insertRange(index, first, last,
+                           typename std::iterator_traits<InputIt>::iterator_category());
+    }
+
     // 删除指定位置的元素
     bool remove(int index, T& element) {
         if (index < 1 || index > length) {
             return false;
         }
-        element = data[index-1];
-        for (int i = index - 1; i < length - 1; ++i) {
-            data[i] = data[i+1];
+        element = std::move(data[index-1]);
+        closeGap(index - 1, 1);
+        return true;
+    }
+
+    // 删除位置 first 到 last（含两端）的所有元素，后续元素只整体移动一次
+    bool erase(int first, int last) {
+        if (first < 1 || last > length || first > last) {
+            return false;
         }
-        --length;
+        closeGap(first - 1, last - first + 1);
         return true;
     }
 
-    // 查找元素位置
+    // 查找元素位置，未找到返回 0（整数和浮点数使用向量化查找）
     int locate(const T& element) const {
-        for (int i = 0; i < length; ++i) {
-            if (data[i] == element) {
-                return i + 1;
-            }
+        return seqlist_simd::findFirst(data, length, element) + 1;
+    }
+
+    // 统计等于 element 的元素个数
+    int count(const T& element) const {
+        return seqlist_simd::count(data, length, element);
+    }
+
+    // 返回所有等于 element 的元素位置（从 1 开始，升序）
+    std::vector<int> find_all(const T& element) const {
+        std::vector<int> positions;
+        seqlist_simd::findAll(data, length, element, positions);
+        for (std::size_t i = 0; i < positions.size(); ++i) {
+            ++positions[i];
         }
-        return 0;
+        return positions;
     }
 
-    // 删除最小元素
+    // 删除最小元素，其余元素保持原有顺序
     bool deleteMin(T& minElement) {
         if (length == 0) {
             return false;
         }
-        int minIndex = 0;
-        for (int i = 1; i < length; ++i) {
-            if (data[i] < data[minIndex]) {
-                minIndex = i;
-            }
-        }
-        minElement = data[minIndex];
-        data[minIndex] = data[length-1];
-        --length;
+        int minIndex = seqlist_simd::minIndex(data, length);
+        minElement = std::move(data[minIndex]);
+        closeGap(minIndex, 1);
         return true;
     }
 
@@ -165,10 +401,53 @@ public:
         return length == maxSize;
     }
 
+    // 是否自动扩容
+    bool isGrowable() const {
+        return growable;
+    }
+
+    // 开启或关闭自动扩容
+    void setGrowable(bool value) {
+        growable = value;
+    }
+
+    // 保证容量至少为 n
+    void reserve(int n) {
+        if (n > maxSize) {
+            reallocate(n);
+        }
+    }
+
+    // 释放多余容量（至少保留 1 个位置）
+    void shrink_to_fit() {
+        int newSize = length > 0 ? length : 1;
+        if (newSize < maxSize) {
+            reallocate(newSize);
+        }
+    }
+
     // 清空顺序表
     void clear() {
+        destroy(data, length);
         length = 0;
     }
+
+    // 迭代器（指向连续存储的指针），可配合标准库算法使用
+    T* begin() {
+        return data;
+    }
+
+    T* end() {
+        return data + length;
+    }
+
+    const T* begin() const {
+        return data;
+    }
+
+    const T* end() const {
+        return data + length;
+    }
 };
 
 #endif // SEQLIST_HPP
@@ -0,0 +1,114 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "SeqList.hpp"
+
+// 中间位置插入的性能测试：在长度为 base 的顺序表中间插入元素
+//   legacy   ：原实现的逐个拷贝赋值后移（for 循环 data[i] = data[i-1]）
+//   insert   ：新的 insert，可平凡复制类型整体 memmove，其余类型移动搬迁
+//   range    ：insert(index, first, last)，后续元素只整体移动一次
+//   vector   ：std::vector::insert 作为参照
+// 逐个插入的次数较少（单次代价与表长成正比），区间插入一次插入 count 个元素。
+// 用法：./SeqListBenchmark [base] [count] [singleInserts]
+//   默认 base = 10^6，count = 10^6，singleInserts = 2000
+
+typedef std::chrono::steady_clock Clock;
+
+static double elapsedNs(Clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+// 原实现的插入算法，用于对比
+template<typename T>
+void legacyInsert(T* data, int& length, int index, const T& element) {
+    for (int i = length; i >= index; --i) {
+        data[i] = data[i-1];
+    }
+    data[index-1] = element;
+    ++length;
+}
+
+template<typename T, typename Make>
+void run(const char* name, int base, int count, int singles, Make make) {
+    std::vector<T> values;
+    values.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        values.push_back(make(i));
+    }
+
+    // legacy
+    T* legacy = new T[base + singles];
+    int legacyLength = 0;
+    for (int i = 0; i < base; ++i) {
+        legacy[legacyLength++] = make(i);
+    }
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < singles; ++i) {
+        legacyInsert(legacy, legacyLength, legacyLength / 2 + 1, values[i]);
+    }
+    double legacyNs = elapsedNs(start) / singles;
+    delete[] legacy;
+
+    // 逐个 insert
+    SeqList<T> list(base + singles);
+    for (int i = 0; i < base; ++i) {
+        list.append(make(i));
+    }
+    start = Clock::now();
+    for (int i = 0; i < singles; ++i) {
+        list.insert(list.size() / 2 + 1, values[i]);
+    }
+    double insertNs = elapsedNs(start) / singles;
+
+    // 区间插入
+    SeqList<T> rangeList(base + count);
+    for (int i = 0; i < base; ++i) {
+        rangeList.append(make(i));
+    }
+    start = Clock::now();
+    rangeList.insert(rangeList.size() / 2 + 1, values.begin(), values.end());
+    double rangeNs = elapsedNs(start) / count;
+
+    // std::vector
+    std::vector<T> vec;
+    vec.reserve(base + count);
+    for (int i = 0; i < base; ++i) {
+        vec.push_back(make(i));
+    }
+    start = Clock::now();
+    vec.insert(vec.begin() + vec.size() / 2, values.begin(), values.end());
+    double vectorNs = elapsedNs(start) / count;
+
+    std::cout << std::setw(14) << name << std::fixed << std::setprecision(2)
+              << std::setw(18) << legacyNs << std::setw(18) << insertNs
+              << std::setw(16) << rangeNs << std::setw(16) << vectorNs << std::endl;
+}
+
+struct MakeInt {
+    int operator()(int i) const { return i; }
+};
+
+struct MakeString {
+    std::string operator()(int i) const { return std::string(24, static_cast<char>('a' + i % 26)); }
+};
+
+int main(int argc, char* argv[]) {
+    int base = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    int count = argc > 2 ? std::atoi(argv[2]) : 1000000;
+    int singles = argc > 3 ? std::atoi(argv[3]) : 2000;
+    if (singles > count) {
+        singles = count;
+    }
+
+    std::cout << "base length " << base << ", range insert of " << count
+              << " elements, " << singles << " single inserts (ns per inserted element)" << std::endl;
+    std::cout << std::setw(14) << "type" << std::setw(18) << "legacy single"
+              << std::setw(18) << "insert single" << std::setw(16) << "range insert"
+              << std::setw(16) << "std::vector" << std::endl;
+    run<int>("int", base, count, singles, MakeInt());
+    run<std::string>("std::string", base, count, singles, MakeString());
+    return 0;
+}
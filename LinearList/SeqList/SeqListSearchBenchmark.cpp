@@ -0,0 +1,131 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+#include "SeqListSimd.hpp"
+
+// 查找内核的性能测试：数据规模从 L1 可容纳到远超末级缓存（DRAM），
+// 分别在标量、SSE4.1、AVX2 下测量
+//   locate   ：查找不存在的值（完整扫描一遍）
+//   count    ：统计某个值出现的次数
+//   find_all ：取出所有匹配位置（约 1/64 的元素匹配）
+//   min      ：deleteMin 使用的最小值下标查找
+// 输出每个元素的平均耗时（ns）以及按读取字节数计算的带宽（GB/s）。
+// 用法：./SeqListSearchBenchmark [maxBytes]
+//   默认 maxBytes = 256 MiB，规模从 4 KiB 起每次乘 4
+
+typedef std::chrono::steady_clock Clock;
+
+static volatile long sink;
+
+static const char* levelName(int level) {
+    switch (level) {
+    case seqlist_simd::LevelAVX2:
+        return "avx2";
+    case seqlist_simd::LevelSSE41:
+        return "sse4.1";
+    default:
+        return "scalar";
+    }
+}
+
+// 重复执行 op 直到总扫描量足够大，取 3 轮中最快的一轮，返回每个元素的耗时
+template<typename Op>
+double measure(int n, Op op) {
+    long repeats = 256L * 1024 * 1024 / n;
+    if (repeats < 3) {
+        repeats = 3;
+    }
+    double best = 0;
+    for (int round = 0; round < 3; ++round) {
+        Clock::time_point start = Clock::now();
+        for (long r = 0; r < repeats; ++r) {
+            sink = sink + op();
+        }
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / repeats / n;
+        if (round == 0 || ns < best) {
+            best = ns;
+        }
+    }
+    return best;
+}
+
+template<typename T>
+struct LocateOp {
+    const T* data;
+    int n;
+    long operator()() const { return seqlist_simd::findFirst(data, n, static_cast<T>(-1)); }
+};
+
+template<typename T>
+struct CountOp {
+    const T* data;
+    int n;
+    long operator()() const { return seqlist_simd::count(data, n, static_cast<T>(7)); }
+};
+
+template<typename T>
+struct FindAllOp {
+    const T* data;
+    int n;
+    std::vector<int>* out;
+    long operator()() const {
+        out->clear();
+        seqlist_simd::findAll(data, n, static_cast<T>(7), *out);
+        return static_cast<long>(out->size());
+    }
+};
+
+template<typename T>
+struct MinOp {
+    const T* data;
+    int n;
+    long operator()() const { return seqlist_simd::minIndex(data, n); }
+};
+
+template<typename T>
+void run(const char* name, long maxBytes) {
+    std::cout << "\n" << name << std::endl;
+    std::cout << std::setw(10) << "bytes" << std::setw(8) << "isa"
+              << std::setw(18) << "locate ns(GB/s)" << std::setw(18) << "count ns(GB/s)"
+              << std::setw(18) << "find_all ns(GB/s)" << std::setw(18) << "min ns(GB/s)" << std::endl;
+
+    for (long bytes = 4096; bytes <= maxBytes; bytes *= 4) {
+        int n = static_cast<int>(bytes / sizeof(T));
+        std::vector<T> values(n);
+        for (int i = 0; i < n; ++i) {
+            values[i] = static_cast<T>(std::rand() % 64 + 1);
+        }
+        std::vector<int> positions;
+        positions.reserve(n);
+
+        for (int level = seqlist_simd::LevelScalar; level <= seqlist_simd::supportedLevel(); ++level) {
+            seqlist_simd::setLevel(static_cast<seqlist_simd::Level>(level));
+            LocateOp<T> locate = {values.data(), n};
+            CountOp<T> count = {values.data(), n};
+            FindAllOp<T> findAll = {values.data(), n, &positions};
+            MinOp<T> minOp = {values.data(), n};
+            double ns[4] = {measure(n, locate), measure(n, count), measure(n, findAll), measure(n, minOp)};
+
+            std::cout << std::setw(10) << bytes << std::setw(8) << levelName(level) << std::fixed;
+            for (int k = 0; k < 4; ++k) {
+                std::cout << std::setw(9) << std::setprecision(3) << ns[k]
+                          << " (" << std::setw(5) << std::setprecision(1) << sizeof(T) / ns[k] << ")";
+            }
+            std::cout << std::endl;
+        }
+    }
+    seqlist_simd::setLevel(seqlist_simd::supportedLevel());
+}
+
+int main(int argc, char* argv[]) {
+    long maxBytes = argc > 1 ? std::atol(argv[1]) : 256L * 1024 * 1024;
+
+    std::cout << "supported isa: " << levelName(seqlist_simd::supportedLevel())
+              << ", per element time in ns (bandwidth in GB/s)" << std::endl;
+    run<int>("int", maxBytes);
+    run<float>("float", maxBytes);
+    run<double>("double", maxBytes);
+    return 0;
+}
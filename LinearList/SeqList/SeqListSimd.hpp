@@ -0,0 +1,622 @@
+#ifndef SEQLIST_SIMD_HPP
+#define SEQLIST_SIMD_HPP
+
+// SeqList 的查找内核：相等查找、计数、查找全部位置和最小值下标
+// 对 4/8 字节的整数以及 float/double 使用 AVX2 / SSE4.1 向量化实现，
+// 运行时按 simd::level() 选择指令集，其余类型以及非 x86 平台使用标量实现。
+// 定义 SEQLIST_NO_SIMD 可以在编译期关闭向量化。
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+#include "../../Simd/SimdLevel/SimdLevel.hpp"
+
+#if !defined(SEQLIST_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define SEQLIST_SIMD_X86 1
+#include <immintrin.h>
+#define SEQLIST_TARGET_AVX2 __attribute__((target("avx2")))
+#define SEQLIST_TARGET_SSE41 __attribute__((target("sse4.1")))
+#else
+#define SEQLIST_SIMD_X86 0
+#endif
+
+namespace seqlist_simd {
+
+// 指令集级别与全局开关见 Simd/SimdLevel/SimdLevel.hpp
+using simd::Level;
+using simd::LevelScalar;
+using simd::LevelSSE41;
+using simd::LevelAVX2;
+using simd::supportedLevel;
+using simd::level;
+using simd::setLevel;
+
+// 元素种类：决定使用哪一组向量内核
+enum Kind {
+    KindNone = 0,
+    KindI32,
+    KindI64,
+    KindF32,
+    KindF64
+};
+
+namespace detail {
+
+// 元素数少于该值时直接走标量路径，避免分派和尾部处理的开销
+const int kMinVectorLength = 16;
+
+// ---------- 标量实现 ----------
+
+template<typename T>
+int scalarFindFirst(const T* data, int n, const T& value) {
+    for (int i = 0; i < n; ++i) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+template<typename T>
+int scalarCount(const T* data, int n, const T& value) {
+    int result = 0;
+    for (int i = 0; i < n; ++i) {
+        if (data[i] == value) {
+            ++result;
+        }
+    }
+    return result;
+}
+
+template<typename T>
+void scalarFindAll(const T* data, int n, const T& value, std::vector<int>& out) {
+    for (int i = 0; i < n; ++i) {
+        if (data[i] == value) {
+            out.push_back(i);
+        }
+    }
+}
+
+// 返回第一个最小元素的下标（与 SeqList::deleteMin 的比较方式一致）
+template<typename T>
+int scalarMinIndex(const T* data, int n) {
+    if (n <= 0) {
+        return -1;
+    }
+    int minIndex = 0;
+    for (int i = 1; i < n; ++i) {
+        if (data[i] < data[minIndex]) {
+            minIndex = i;
+        }
+    }
+    return minIndex;
+}
+
+// 根据类型选择内核种类。只有有符号 32 位整数和浮点数支持向量化取最小值
+template<typename T>
+struct KindOf {
+    static const int eq =
+        !SEQLIST_SIMD_X86 ? KindNone :
+        std::is_same<T, float>::value ? KindF32 :
+        std::is_same<T, double>::value ? KindF64 :
+        (std::is_integral<T>::value && !std::is_same<T, bool>::value && sizeof(T) == 4) ? KindI32 :
+        (std::is_integral<T>::value && sizeof(T) == 8) ? KindI64 : KindNone;
+
+    static const int min =
+        eq == KindF32 || eq == KindF64 ? eq :
+        eq == KindI32 && std::is_signed<T>::value ? KindI32 : KindNone;
+};
+
+#if SEQLIST_SIMD_X86
+
+// ---------- 各指令集、各元素类型的基本操作 ----------
+// Elem 为向量中的元素类型，V 为数据/掩码向量，IV 为下标向量，CV 为计数向量
+
+struct Avx2I32 {
+    typedef int32_t Elem;
+    typedef __m256i V;
+    typedef __m256i IV;
+    typedef __m256i CV;
+    enum { Lanes = 8 };
+    SEQLIST_TARGET_AVX2 static V load(const Elem* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    SEQLIST_TARGET_AVX2 static V set1(Elem x) { return _mm256_set1_epi32(x); }
+    SEQLIST_TARGET_AVX2 static V eq(V a, V b) { return _mm256_cmpeq_epi32(a, b); }
+    SEQLIST_TARGET_AVX2 static V lt(V a, V b) { return _mm256_cmpgt_epi32(b, a); }
+    SEQLIST_TARGET_AVX2 static V orMask(V a, V b) { return _mm256_or_si256(a, b); }
+    SEQLIST_TARGET_AVX2 static int mask(V m) { return _mm256_movemask_ps(_mm256_castsi256_ps(m)); }
+    SEQLIST_TARGET_AVX2 static V blend(V a, V b, V m) { return _mm256_blendv_epi8(a, b, m); }
+    SEQLIST_TARGET_AVX2 static V unordered(V) { return _mm256_setzero_si256(); }
+    SEQLIST_TARGET_AVX2 static void store(Elem* out, V a) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), a); }
+    SEQLIST_TARGET_AVX2 static IV iota() { return _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7); }
+    SEQLIST_TARGET_AVX2 static IV idxAdd(IV a, int k) { return _mm256_add_epi32(a, _mm256_set1_epi32(k)); }
+    SEQLIST_TARGET_AVX2 static IV idxBlend(IV a, IV b, V m) { return _mm256_blendv_epi8(a, b, m); }
+    SEQLIST_TARGET_AVX2 static void idxStore(int* out, IV a) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), a); }
+    // 比较结果为全 1（即 -1），从累加器中减去即可计数
+    SEQLIST_TARGET_AVX2 static CV countZero() { return _mm256_setzero_si256(); }
+    SEQLIST_TARGET_AVX2 static CV countAdd(CV acc, V m) { return _mm256_sub_epi32(acc, m); }
+    SEQLIST_TARGET_AVX2 static int countSum(CV acc) {
+        int32_t lanes[8];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        return lanes[0] + lanes[1] + lanes[2] + lanes[3] + lanes[4] + lanes[5] + lanes[6] + lanes[7];
+    }
+};
+
+struct Avx2I64 {
+    typedef int64_t Elem;
+    typedef __m256i V;
+    typedef __m256i CV;
+    enum { Lanes = 4 };
+    SEQLIST_TARGET_AVX2 static V load(const Elem* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    SEQLIST_TARGET_AVX2 static V set1(Elem x) { return _mm256_set1_epi64x(x); }
+    SEQLIST_TARGET_AVX2 static V eq(V a, V b) { return _mm256_cmpeq_epi64(a, b); }
+    SEQLIST_TARGET_AVX2 static V orMask(V a, V b) { return _mm256_or_si256(a, b); }
+    SEQLIST_TARGET_AVX2 static int mask(V m) { return _mm256_movemask_pd(_mm256_castsi256_pd(m)); }
+    SEQLIST_TARGET_AVX2 static CV countZero() { return _mm256_setzero_si256(); }
+    SEQLIST_TARGET_AVX2 static CV countAdd(CV acc, V m) { return _mm256_sub_epi64(acc, m); }
+    SEQLIST_TARGET_AVX2 static int countSum(CV acc) {
+        int64_t lanes[4];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        return static_cast<int>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    }
+};
+
+struct Avx2F32 {
+    typedef float Elem;
+    typedef __m256 V;
+    typedef __m256i IV;
+    typedef __m256i CV;
+    enum { Lanes = 8 };
+    SEQLIST_TARGET_AVX2 static V load(const Elem* p) { return _mm256_loadu_ps(p); }
+    SEQLIST_TARGET_AVX2 static V set1(Elem x) { return _mm256_set1_ps(x); }
+    SEQLIST_TARGET_AVX2 static V eq(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+    SEQLIST_TARGET_AVX2 static V lt(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    SEQLIST_TARGET_AVX2 static V orMask(V a, V b) { return _mm256_or_ps(a, b); }
+    SEQLIST_TARGET_AVX2 static int mask(V m) { return _mm256_movemask_ps(m); }
+    SEQLIST_TARGET_AVX2 static V blend(V a, V b, V m) { return _mm256_blendv_ps(a, b, m); }
+    SEQLIST_TARGET_AVX2 static V unordered(V a) { return _mm256_cmp_ps(a, a, _CMP_UNORD_Q); }
+    SEQLIST_TARGET_AVX2 static void store(Elem* out, V a) { _mm256_storeu_ps(out, a); }
+    SEQLIST_TARGET_AVX2 static IV iota() { return _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7); }
+    SEQLIST_TARGET_AVX2 static IV idxAdd(IV a, int k) { return _mm256_add_epi32(a, _mm256_set1_epi32(k)); }
+    SEQLIST_TARGET_AVX2 static IV idxBlend(IV a, IV b, V m) { return _mm256_blendv_epi8(a, b, _mm256_castps_si256(m)); }
+    SEQLIST_TARGET_AVX2 static void idxStore(int* out, IV a) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), a); }
+    SEQLIST_TARGET_AVX2 static CV countZero() { return _mm256_setzero_si256(); }
+    SEQLIST_TARGET_AVX2 static CV countAdd(CV acc, V m) { return _mm256_sub_epi32(acc, _mm256_castps_si256(m)); }
+    SEQLIST_TARGET_AVX2 static int countSum(CV acc) {
+        int32_t lanes[8];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        return lanes[0] + lanes[1] + lanes[2] + lanes[3] + lanes[4] + lanes[5] + lanes[6] + lanes[7];
+    }
+};
+
+struct Avx2F64 {
+    typedef double Elem;
+    typedef __m256d V;
+    typedef __m256i IV;
+    typedef __m256i CV;
+    enum { Lanes = 4 };
+    SEQLIST_TARGET_AVX2 static V load(const Elem* p) { return _mm256_loadu_pd(p); }
+    SEQLIST_TARGET_AVX2 static V set1(Elem x) { return _mm256_set1_pd(x); }
+    SEQLIST_TARGET_AVX2 static V eq(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+    SEQLIST_TARGET_AVX2 static V lt(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+    SEQLIST_TARGET_AVX2 static V orMask(V a, V b) { return _mm256_or_pd(a, b); }
+    SEQLIST_TARGET_AVX2 static int mask(V m) { return _mm256_movemask_pd(m); }
+    SEQLIST_TARGET_AVX2 static V blend(V a, V b, V m) { return _mm256_blendv_pd(a, b, m); }
+    SEQLIST_TARGET_AVX2 static V unordered(V a) { return _mm256_cmp_pd(a, a, _CMP_UNORD_Q); }
+    SEQLIST_TARGET_AVX2 static void store(Elem* out, V a) { _mm256_storeu_pd(out, a); }
+    // 下标放在 64 位通道中，与数据通道一一对应
+    SEQLIST_TARGET_AVX2 static IV iota() { return _mm256_setr_epi64x(0, 1, 2, 3); }
+    SEQLIST_TARGET_AVX2 static IV idxAdd(IV a, int k) { return _mm256_add_epi64(a, _mm256_set1_epi64x(k)); }
+    SEQLIST_TARGET_AVX2 static IV idxBlend(IV a, IV b, V m) { return _mm256_blendv_epi8(a, b, _mm256_castpd_si256(m)); }
+    SEQLIST_TARGET_AVX2 static void idxStore(int* out, IV a) {
+        int64_t tmp[4];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(tmp), a);
+        for (int k = 0; k < 4; ++k) {
+            out[k] = static_cast<int>(tmp[k]);
+        }
+    }
+    SEQLIST_TARGET_AVX2 static CV countZero() { return _mm256_setzero_si256(); }
+    SEQLIST_TARGET_AVX2 static CV countAdd(CV acc, V m) { return _mm256_sub_epi64(acc, _mm256_castpd_si256(m)); }
+    SEQLIST_TARGET_AVX2 static int countSum(CV acc) {
+        int64_t lanes[4];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        return static_cast<int>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    }
+};
+
+struct Sse41I32 {
+    typedef int32_t Elem;
+    typedef __m128i V;
+    typedef __m128i IV;
+    typedef __m128i CV;
+    enum { Lanes = 4 };
+    SEQLIST_TARGET_SSE41 static V load(const Elem* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    SEQLIST_TARGET_SSE41 static V set1(Elem x) { return _mm_set1_epi32(x); }
+    SEQLIST_TARGET_SSE41 static V eq(V a, V b) { return _mm_cmpeq_epi32(a, b); }
+    SEQLIST_TARGET_SSE41 static V lt(V a, V b) { return _mm_cmplt_epi32(a, b); }
+    SEQLIST_TARGET_SSE41 static V orMask(V a, V b) { return _mm_or_si128(a, b); }
+    SEQLIST_TARGET_SSE41 static int mask(V m) { return _mm_movemask_ps(_mm_castsi128_ps(m)); }
+    SEQLIST_TARGET_SSE41 static V blend(V a, V b, V m) { return _mm_blendv_epi8(a, b, m); }
+    SEQLIST_TARGET_SSE41 static V unordered(V) { return _mm_setzero_si128(); }
+    SEQLIST_TARGET_SSE41 static void store(Elem* out, V a) { _mm_storeu_si128(reinterpret_cast<__m128i*>(out), a); }
+    SEQLIST_TARGET_SSE41 static IV iota() { return _mm_setr_epi32(0, 1, 2, 3); }
+    SEQLIST_TARGET_SSE41 static IV idxAdd(IV a, int k) { return _mm_add_epi32(a, _mm_set1_epi32(k)); }
+    SEQLIST_TARGET_SSE41 static IV idxBlend(IV a, IV b, V m) { return _mm_blendv_epi8(a, b, m); }
+    SEQLIST_TARGET_SSE41 static void idxStore(int* out, IV a) { _mm_storeu_si128(reinterpret_cast<__m128i*>(out), a); }
+    SEQLIST_TARGET_SSE41 static CV countZero() { return _mm_setzero_si128(); }
+    SEQLIST_TARGET_SSE41 static CV countAdd(CV acc, V m) { return _mm_sub_epi32(acc, m); }
+    SEQLIST_TARGET_SSE41 static int countSum(CV acc) {
+        int32_t lanes[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+};
+
+struct Sse41I64 {
+    typedef int64_t Elem;
+    typedef __m128i V;
+    typedef __m128i CV;
+    enum { Lanes = 2 };
+    SEQLIST_TARGET_SSE41 static V load(const Elem* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    SEQLIST_TARGET_SSE41 static V set1(Elem x) { return _mm_set1_epi64x(x); }
+    SEQLIST_TARGET_SSE41 static V eq(V a, V b) { return _mm_cmpeq_epi64(a, b); }
+    SEQLIST_TARGET_SSE41 static V orMask(V a, V b) { return _mm_or_si128(a, b); }
+    SEQLIST_TARGET_SSE41 static int mask(V m) { return _mm_movemask_pd(_mm_castsi128_pd(m)); }
+    SEQLIST_TARGET_SSE41 static CV countZero() { return _mm_setzero_si128(); }
+    SEQLIST_TARGET_SSE41 static CV countAdd(CV acc, V m) { return _mm_sub_epi64(acc, m); }
+    SEQLIST_TARGET_SSE41 static int countSum(CV acc) {
+        int64_t lanes[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        return static_cast<int>(lanes[0] + lanes[1]);
+    }
+};
+
+struct Sse41F32 {
+    typedef float Elem;
+    typedef __m128 V;
+    typedef __m128i IV;
+    typedef __m128i CV;
+    enum { Lanes = 4 };
+    SEQLIST_TARGET_SSE41 static V load(const Elem* p) { return _mm_loadu_ps(p); }
+    SEQLIST_TARGET_SSE41 static V set1(Elem x) { return _mm_set1_ps(x); }
+    SEQLIST_TARGET_SSE41 static V eq(V a, V b) { return _mm_cmpeq_ps(a, b); }
+    SEQLIST_TARGET_SSE41 static V lt(V a, V b) { return _mm_cmplt_ps(a, b); }
+    SEQLIST_TARGET_SSE41 static V orMask(V a, V b) { return _mm_or_ps(a, b); }
+    SEQLIST_TARGET_SSE41 static int mask(V m) { return _mm_movemask_ps(m); }
+    SEQLIST_TARGET_SSE41 static V blend(V a, V b, V m) { return _mm_blendv_ps(a, b, m); }
+    SEQLIST_TARGET_SSE41 static V unordered(V a) { return _mm_cmpunord_ps(a, a); }
+    SEQLIST_TARGET_SSE41 static void store(Elem* out, V a) { _mm_storeu_ps(out, a); }
+    SEQLIST_TARGET_SSE41 static IV iota() { return _mm_setr_epi32(0, 1, 2, 3); }
+    SEQLIST_TARGET_SSE41 static IV idxAdd(IV a, int k) { return _mm_add_epi32(a, _mm_set1_epi32(k)); }
+    SEQLIST_TARGET_SSE41 static IV idxBlend(IV a, IV b, V m) { return _mm_blendv_epi8(a, b, _mm_castps_si128(m)); }
+    SEQLIST_TARGET_SSE41 static void idxStore(int* out, IV a) { _mm_storeu_si128(reinterpret_cast<__m128i*>(out), a); }
+    SEQLIST_TARGET_SSE41 static CV countZero() { return _mm_setzero_si128(); }
+    SEQLIST_TARGET_SSE41 static CV countAdd(CV acc, V m) { return _mm_sub_epi32(acc, _mm_castps_si128(m)); }
+    SEQLIST_TARGET_SSE41 static int countSum(CV acc) {
+        int32_t lanes[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+};
+
+struct Sse41F64 {
+    typedef double Elem;
+    typedef __m128d V;
+    typedef __m128i IV;
+    typedef __m128i CV;
+    enum { Lanes = 2 };
+    SEQLIST_TARGET_SSE41 static V load(const Elem* p) { return _mm_loadu_pd(p); }
+    SEQLIST_TARGET_SSE41 static V set1(Elem x) { return _mm_set1_pd(x); }
+    SEQLIST_TARGET_SSE41 static V eq(V a, V b) { return _mm_cmpeq_pd(a, b); }
+    SEQLIST_TARGET_SSE41 static V lt(V a, V b) { return _mm_cmplt_pd(a, b); }
+    SEQLIST_TARGET_SSE41 static V orMask(V a, V b) { return _mm_or_pd(a, b); }
+    SEQLIST_TARGET_SSE41 static int mask(V m) { return _mm_movemask_pd(m); }
+    SEQLIST_TARGET_SSE41 static V blend(V a, V b, V m) { return _mm_blendv_pd(a, b, m); }
+    SEQLIST_TARGET_SSE41 static V unordered(V a) { return _mm_cmpunord_pd(a, a); }
+    SEQLIST_TARGET_SSE41 static void store(Elem* out, V a) { _mm_storeu_pd(out, a); }
+    SEQLIST_TARGET_SSE41 static IV iota() { return _mm_set_epi64x(1, 0); }
+    SEQLIST_TARGET_SSE41 static IV idxAdd(IV a, int k) { return _mm_add_epi64(a, _mm_set1_epi64x(k)); }
+    SEQLIST_TARGET_SSE41 static IV idxBlend(IV a, IV b, V m) { return _mm_blendv_epi8(a, b, _mm_castpd_si128(m)); }
+    SEQLIST_TARGET_SSE41 static void idxStore(int* out, IV a) {
+        int64_t tmp[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(tmp), a);
+        out[0] = static_cast<int>(tmp[0]);
+        out[1] = static_cast<int>(tmp[1]);
+    }
+    SEQLIST_TARGET_SSE41 static CV countZero() { return _mm_setzero_si128(); }
+    SEQLIST_TARGET_SSE41 static CV countAdd(CV acc, V m) { return _mm_sub_epi64(acc, _mm_castpd_si128(m)); }
+    SEQLIST_TARGET_SSE41 static int countSum(CV acc) {
+        int64_t lanes[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        return static_cast<int>(lanes[0] + lanes[1]);
+    }
+};
+
+template<int K> struct KindOps;
+template<> struct KindOps<KindI32> { typedef Avx2I32 Avx2; typedef Sse41I32 Sse41; };
+template<> struct KindOps<KindI64> { typedef Avx2I64 Avx2; typedef Sse41I64 Sse41; };
+template<> struct KindOps<KindF32> { typedef Avx2F32 Avx2; typedef Sse41F32 Sse41; };
+template<> struct KindOps<KindF64> { typedef Avx2F64 Avx2; typedef Sse41F64 Sse41; };
+
+// ---------- 与指令集无关的内核骨架 ----------
+// 内核本身必须带上与基本操作相同的 target 属性才能内联，
+// 因此用宏为 AVX2 和 SSE4.1 各生成一份。
+
+#define SEQLIST_DEFINE_KERNELS(PREFIX, TARGET)                                          \
+template<typename Ops>                                                                  \
+TARGET int PREFIX##FindFirst(const typename Ops::Elem* p, int n, typename Ops::Elem x) { \
+    typedef typename Ops::V V;                                                          \
+    const int L = Ops::Lanes;                                                           \
+    const V key = Ops::set1(x);                                                         \
+    int i = 0;                                                                          \
+    /* 每次检查 4 个向量，只在命中时才定位具体下标 */                                   \
+    for (; i + 4 * L <= n; i += 4 * L) {                                                \
+        V m0 = Ops::eq(Ops::load(p + i), key);                                          \
+        V m1 = Ops::eq(Ops::load(p + i + L), key);                                      \
+        V m2 = Ops::eq(Ops::load(p + i + 2 * L), key);                                  \
+        V m3 = Ops::eq(Ops::load(p + i + 3 * L), key);                                  \
+        if (Ops::mask(Ops::orMask(Ops::orMask(m0, m1), Ops::orMask(m2, m3))) != 0) {    \
+            break;                                                                      \
+        }                                                                               \
+    }                                                                                   \
+    for (; i + L <= n; i += L) {                                                        \
+        int bits = Ops::mask(Ops::eq(Ops::load(p + i), key));                           \
+        if (bits != 0) {                                                                \
+            return i + __builtin_ctz(bits);                                             \
+        }                                                                               \
+    }                                                                                   \
+    for (; i < n; ++i) {                                                                \
+        if (p[i] == x) {                                                                \
+            return i;                                                                   \
+        }                                                                               \
+    }                                                                                   \
+    return -1;                                                                          \
+}                                                                                       \
+                                                                                        \
+template<typename Ops>                                                                  \
+TARGET int PREFIX##Count(const typename Ops::Elem* p, int n, typename Ops::Elem x) {    \
+    const int L = Ops::Lanes;                                                           \
+    const typename Ops::V key = Ops::set1(x);                                           \
+    /* 两个向量累加器分别计数，最后再横向求和 */                                      \
+    typename Ops::CV c0 = Ops::countZero();                                             \
+    typename Ops::CV c1 = Ops::countZero();                                             \
+    int i = 0;                                                                          \
+    for (; i + 2 * L <= n; i += 2 * L) {                                                \
+        c0 = Ops::countAdd(c0, Ops::eq(Ops::load(p + i), key));                         \
+        c1 = Ops::countAdd(c1, Ops::eq(Ops::load(p + i + L), key));                     \
+    }                                                                                   \
+    int result = Ops::countSum(c0) + Ops::countSum(c1);                                 \
+    for (; i < n; ++i) {                                                                \
+        result += p[i] == x;                                                            \
+    }                                                                                   \
+    return result;                                                                      \
+}                                                                                       \
+                                                                                        \
+template<typename Ops>                                                                  \
+TARGET void PREFIX##FindAll(const typename Ops::Elem* p, int n, typename Ops::Elem x,   \
+                            std::vector<int>& out) {                                    \
+    const int L = Ops::Lanes;                                                           \
+    const typename Ops::V key = Ops::set1(x);                                           \
+    int i = 0;                                                                          \
+    for (; i + L <= n; i += L) {                                                        \
+        int bits = Ops::mask(Ops::eq(Ops::load(p + i), key));                           \
+        while (bits != 0) {                                                             \
+            out.push_back(i + __builtin_ctz(bits));                                     \
+            bits &= bits - 1;                                                           \
+        }                                                                               \
+    }                                                                                   \
+    for (; i < n; ++i) {                                                                \
+        if (p[i] == x) {                                                                \
+            out.push_back(i);                                                           \
+        }                                                                               \
+    }                                                                                   \
+}                                                                                       \
+                                                                                        \
+/* 每个通道记录自己见过的第一个最小值及其下标，最后在通道间归约；要求 n >= Lanes。  \
+   比较和混合构成循环依赖链，用两组累加器交替处理相邻向量以隐藏延迟 */           \
+template<typename Ops>                                                                  \
+TARGET int PREFIX##MinIndex(const typename Ops::Elem* p, int n) {                       \
+    typedef typename Ops::Elem Elem;                                                    \
+    typedef typename Ops::V V;                                                          \
+    typedef typename Ops::IV IV;                                                        \
+    const int L = Ops::Lanes;                                                           \
+    V best0 = Ops::load(p);                                                             \
+    /* 首个向量中含 NaN 时通道会一直停在 NaN 上，与标量语义不一致，退回标量实现 */    \
+    if (Ops::mask(Ops::unordered(best0)) != 0) {                                        \
+        return scalarMinIndex(p, n);                                                    \
+    }                                                                                   \
+    V best1 = best0;                                                                    \
+    IV bestIdx0 = Ops::iota();                                                          \
+    IV bestIdx1 = bestIdx0;                                                             \
+    IV idx0 = Ops::idxAdd(bestIdx0, L);                                                 \
+    IV idx1 = Ops::idxAdd(bestIdx0, 2 * L);                                             \
+    int i = L;                                                                          \
+    for (; i + 2 * L <= n; i += 2 * L) {                                                \
+        V x0 = Ops::load(p + i);                                                        \
+        V x1 = Ops::load(p + i + L);                                                    \
+        V m0 = Ops::lt(x0, best0);                                                      \
+        V m1 = Ops::lt(x1, best1);                                                      \
+        best0 = Ops::blend(best0, x0, m0);                                              \
+        best1 = Ops::blend(best1, x1, m1);                                              \
+        bestIdx0 = Ops::idxBlend(bestIdx0, idx0, m0);                                   \
+        bestIdx1 = Ops::idxBlend(bestIdx1, idx1, m1);                                   \
+        idx0 = Ops::idxAdd(idx0, 2 * L);                                                \
+        idx1 = Ops::idxAdd(idx1, 2 * L);                                                \
+    }                                                                                   \
+    Elem vals[2 * L];                                                                   \
+    int ids[2 * L];                                                                     \
+    Ops::store(vals, best0);                                                            \
+    Ops::store(vals + L, best1);                                                        \
+    Ops::idxStore(ids, bestIdx0);                                                       \
+    Ops::idxStore(ids + L, bestIdx1);                                                   \
+    int k = 0;                                                                          \
+    for (int j = 1; j < 2 * L; ++j) {                                                   \
+        if (vals[j] < vals[k] || (vals[j] == vals[k] && ids[j] < ids[k])) {             \
+            k = j;                                                                      \
+        }                                                                               \
+    }                                                                                   \
+    int result = ids[k];                                                                \
+    Elem minValue = vals[k];                                                            \
+    for (; i < n; ++i) {                                                                \
+        if (p[i] < minValue) {                                                          \
+            minValue = p[i];                                                            \
+            result = i;                                                                 \
+        }                                                                               \
+    }                                                                                   \
+    return result;                                                                      \
+}
+
+SEQLIST_DEFINE_KERNELS(avx2, SEQLIST_TARGET_AVX2)
+SEQLIST_DEFINE_KERNELS(sse41, SEQLIST_TARGET_SSE41)
+
+#undef SEQLIST_DEFINE_KERNELS
+
+// 把 T 按位转换为内核使用的元素类型（如 unsigned → int32_t，long → int64_t）
+template<typename Elem, typename T>
+Elem bitCast(const T& value) {
+    Elem result;
+    std::memcpy(&result, &value, sizeof(Elem));
+    return result;
+}
+
+template<typename Elem, typename T>
+const Elem* bitCast(const T* data) {
+    return reinterpret_cast<const Elem*>(data);
+}
+
+#endif // SEQLIST_SIMD_X86
+
+// ---------- 按元素种类分派 ----------
+
+template<typename T>
+int findFirst(const T* data, int n, const T& value, std::integral_constant<int, KindNone>) {
+    return scalarFindFirst(data, n, value);
+}
+
+template<typename T>
+int count(const T* data, int n, const T& value, std::integral_constant<int, KindNone>) {
+    return scalarCount(data, n, value);
+}
+
+template<typename T>
+void findAll(const T* data, int n, const T& value, std::vector<int>& out,
+             std::integral_constant<int, KindNone>) {
+    scalarFindAll(data, n, value, out);
+}
+
+template<typename T>
+int minIndex(const T* data, int n, std::integral_constant<int, KindNone>) {
+    return scalarMinIndex(data, n);
+}
+
+#if SEQLIST_SIMD_X86
+
+template<typename T, int K>
+int findFirst(const T* data, int n, const T& value, std::integral_constant<int, K>) {
+    typedef typename KindOps<K>::Avx2 Avx2;
+    typedef typename KindOps<K>::Sse41 Sse41;
+    typedef typename Avx2::Elem Elem;
+    if (n >= kMinVectorLength) {
+        switch (simd::level()) {
+        case LevelAVX2:
+            return avx2FindFirst<Avx2>(bitCast<Elem>(data), n, bitCast<Elem>(value));
+        case LevelSSE41:
+            return sse41FindFirst<Sse41>(bitCast<Elem>(data), n, bitCast<Elem>(value));
+        case LevelScalar:
+            break;
+        }
+    }
+    return scalarFindFirst(data, n, value);
+}
+
+template<typename T, int K>
+int count(const T* data, int n, const T& value, std::integral_constant<int, K>) {
+    typedef typename KindOps<K>::Avx2 Avx2;
+    typedef typename KindOps<K>::Sse41 Sse41;
+    typedef typename Avx2::Elem Elem;
+    if (n >= kMinVectorLength) {
+        switch (simd::level()) {
+        case LevelAVX2:
+            return avx2Count<Avx2>(bitCast<Elem>(data), n, bitCast<Elem>(value));
+        case LevelSSE41:
+            return sse41Count<Sse41>(bitCast<Elem>(data), n, bitCast<Elem>(value));
+        case LevelScalar:
+            break;
+        }
+    }
+    return scalarCount(data, n, value);
+}
+
+template<typename T, int K>
+void findAll(const T* data, int n, const T& value, std::vector<int>& out,
+             std::integral_constant<int, K>) {
+    typedef typename KindOps<K>::Avx2 Avx2;
+    typedef typename KindOps<K>::Sse41 Sse41;
+    typedef typename Avx2::Elem Elem;
+    if (n >= kMinVectorLength) {
+        switch (simd::level()) {
+        case LevelAVX2:
+            avx2FindAll<Avx2>(bitCast<Elem>(data), n, bitCast<Elem>(value), out);
+            return;
+        case LevelSSE41:
+            sse41FindAll<Sse41>(bitCast<Elem>(data), n, bitCast<Elem>(value), out);
+            return;
+        case LevelScalar:
+            break;
+        }
+    }
+    scalarFindAll(data, n, value, out);
+}
+
+template<typename T, int K>
+int minIndex(const T* data, int n, std::integral_constant<int, K>) {
+    typedef typename KindOps<K>::Avx2 Avx2;
+    typedef typename KindOps<K>::Sse41 Sse41;
+    typedef typename Avx2::Elem Elem;
+    if (n >= kMinVectorLength) {
+        switch (simd::level()) {
+        case LevelAVX2:
+            return avx2MinIndex<Avx2>(bitCast<Elem>(data), n);
+        case LevelSSE41:
+            return sse41MinIndex<Sse41>(bitCast<Elem>(data), n);
+        case LevelScalar:
+            break;
+        }
+    }
+    return scalarMinIndex(data, n);
+}
+
+#endif // SEQLIST_SIMD_X86
+
+} // namespace detail
+
+// ---------- 对外接口（下标从 0 开始） ----------
+
+// 返回第一个等于 value 的元素下标，不存在返回 -1
+template<typename T>
+int findFirst(const T* data, int n, const T& value) {
+    return detail::findFirst(data, n, value, std::integral_constant<int, detail::KindOf<T>::eq>());
+}
+
+// 统计等于 value 的元素个数
+template<typename T>
+int count(const T* data, int n, const T& value) {
+    return detail::count(data, n, value, std::integral_constant<int, detail::KindOf<T>::eq>());
+}
+
+// 把所有等于 value 的元素下标按升序追加到 out
+template<typename T>
+void findAll(const T* data, int n, const T& value, std::vector<int>& out) {
+    detail::findAll(data, n, value, out, std::integral_constant<int, detail::KindOf<T>::eq>());
+}
+
+// 返回第一个最小元素的下标，n <= 0 时返回 -1
+template<typename T>
+int minIndex(const T* data, int n) {
+    return detail::minIndex(data, n, std::integral_constant<int, detail::KindOf<T>::min>());
+}
+
+} // namespace seqlist_simd
+
+#endif // SEQLIST_SIMD_HPP
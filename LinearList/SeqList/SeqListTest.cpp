@@ -2,6 +2,12 @@
 #include <iostream>
 #include <cassert>
 #include <string>
+#include <list>
+#include <sstream>
+#include <iterator>
+#include <vector>
+#include <limits>
+#include <cstdlib>
 
 void testBasicOperations() {
     std::cout << "Testing basic operations..." << std::endl;
@@ -146,6 +152,266 @@ void testBoundaryConditions() {
     std::cout << "Boundary conditions tests passed!" << std::endl;
 }
 
+// 统计拷贝次数，验证插入/删除时元素是移动而不是拷贝
+struct Tracked {
+    static int copies;
+    std::string value;
+
+    Tracked() {}
+    Tracked(const char* v) : value(v) {}
+    Tracked(const Tracked& other) : value(other.value) { ++copies; }
+    Tracked(Tracked&& other) noexcept : value(std::move(other.value)) {}
+    Tracked& operator=(const Tracked& other) { value = other.value; ++copies; return *this; }
+    Tracked& operator=(Tracked&& other) noexcept { value = std::move(other.value); return *this; }
+    bool operator==(const Tracked& other) const { return value == other.value; }
+};
+int Tracked::copies = 0;
+
+void testGrowable() {
+    std::cout << "Testing growable list..." << std::endl;
+
+    SeqList<int> list(2, true);
+    assert(list.isGrowable() && "List should be growable");
+    for (int i = 1; i <= 100; ++i) {
+        assert(list.append(i) && "Append should grow the list");
+    }
+    assert(list.size() == 100 && "List size should be 100");
+    assert(list.capacity() == 128 && "Capacity should double when growing");
+    assert(list.insert(1, 0) && "Insert into a full growable list should succeed");
+
+    int value;
+    for (int i = 1; i <= 101; ++i) {
+        assert(list.get(i, value) && value == i - 1 && "Elements should survive reallocation");
+    }
+
+    // 追加表内元素自身，扩容时不能失效
+    SeqList<std::string> strList(1, true);
+    strList.append("self");
+    strList.append(*strList.begin());
+    assert(strList.size() == 2 && *(strList.begin() + 1) == "self" && "Self append should be safe");
+
+    list.reserve(1000);
+    assert(list.capacity() == 1000 && "Reserve should grow capacity");
+    list.shrink_to_fit();
+    assert(list.capacity() == 101 && "shrink_to_fit should release unused capacity");
+
+    // 固定容量的表可以切换为自动扩容
+    SeqList<int> fixed(1);
+    assert(fixed.append(1) && !fixed.append(2) && "Fixed list should reject append when full");
+    fixed.setGrowable(true);
+    assert(fixed.append(2) && fixed.size() == 2 && "Growable list should accept append");
+
+    std::cout << "Growable list tests passed!" << std::endl;
+}
+
+void testMoveAndEmplace() {
+    std::cout << "Testing move semantics and emplace..." << std::endl;
+
+    SeqList<std::string> list(4);
+    assert(list.emplace(1, 3, 'b') && "Emplace should succeed");
+    assert(list.emplace(1, "a") && "Emplace at the front should succeed");
+    assert(list.emplace(3, std::string("c")) && "Emplace at the end should succeed");
+    std::string value;
+    assert(list.get(1, value) && value == "a" && "First element should be 'a'");
+    assert(list.get(2, value) && value == "bbb" && "Second element should be 'bbb'");
+    assert(!list.emplace(5, "x") && "Emplace with index > size + 1 should fail");
+
+    SeqList<std::string> moved(std::move(list));
+    assert(moved.size() == 3 && "Moved list should keep the elements");
+    assert(list.size() == 0 && "Moved-from list should be empty");
+
+    SeqList<std::string> assigned(1);
+    assigned = std::move(moved);
+    assert(assigned.size() == 3 && assigned.get(3, value) && value == "c" && "Move assignment should transfer elements");
+
+    // 插入和删除时的元素搬移不产生拷贝
+    SeqList<Tracked> tracked(16);
+    for (int i = 0; i < 8; ++i) {
+        tracked.append(Tracked("x"));
+    }
+    Tracked::copies = 0;
+    tracked.insert(1, Tracked("front"));
+    Tracked removed;
+    tracked.remove(1, removed);
+    tracked.erase(2, 5);
+    assert(Tracked::copies == 0 && "Shifting elements should not copy");
+    assert(removed.value == "front" && tracked.size() == 4 && "Remove and erase should update the list");
+
+    std::cout << "Move semantics and emplace tests passed!" << std::endl;
+}
+
+void testRangeInsertAndErase() {
+    std::cout << "Testing range insert and erase..." << std::endl;
+
+    SeqList<int> list(20);
+    for (int i = 1; i <= 5; ++i) {
+        list.append(i * 10);
+    }
+
+    // 前向迭代器区间
+    std::list<int> source = {1, 2, 3};
+    assert(list.insert(2, source.begin(), source.end()) && "Range insert should succeed");
+    int expected1[] = {10, 1, 2, 3, 20, 30, 40, 50};
+    assert(list.size() == 8 && std::equal(list.begin(), list.end(), expected1) && "Range should be inserted at position 2");
+
+    // 单趟输入迭代器区间
+    std::istringstream input("7 8");
+    assert(list.insert(9, std::istream_iterator<int>(input), std::istream_iterator<int>()) && "Input range insert should succeed");
+    int expected2[] = {10, 1, 2, 3, 20, 30, 40, 50, 7, 8};
+    assert(list.size() == 10 && std::equal(list.begin(), list.end(), expected2) && "Input range should be appended");
+
+    // 容量不足时整体失败，表保持不变
+    std::vector<int> big(20, 0);
+    assert(!list.insert(1, big.begin(), big.end()) && "Range insert beyond capacity should fail");
+    assert(list.size() == 10 && "Failed insert should leave the list unchanged");
+    assert(!list.insert(12, source.begin(), source.end()) && "Range insert with invalid index should fail");
+
+    // 删除区间
+    assert(list.erase(2, 4) && "Erase should succeed");
+    int expected3[] = {10, 20, 30, 40, 50, 7, 8};
+    assert(list.size() == 7 && std::equal(list.begin(), list.end(), expected3) && "Positions 2..4 should be erased");
+    assert(!list.erase(0, 1) && "Erase with index 0 should fail");
+    assert(!list.erase(3, 8) && "Erase past the end should fail");
+    assert(!list.erase(4, 3) && "Erase with first > last should fail");
+    assert(list.erase(6, 7) && list.size() == 5 && "Erase at the tail should succeed");
+
+    // 非平凡类型的区间操作
+    SeqList<std::string> strList(4, true);
+    strList.append("a");
+    strList.append("e");
+    std::vector<std::string> middle = {"b", "c", "d"};
+    assert(strList.insert(2, middle.begin(), middle.end()) && "String range insert should grow the list");
+    std::string joined;
+    for (const std::string* p = strList.begin(); p != strList.end(); ++p) {
+        joined += *p;
+    }
+    assert(joined == "abcde" && "String range should be inserted in order");
+    assert(strList.erase(1, 5) && strList.empty() && "Erasing everything should empty the list");
+
+    // 插入取自表自身的区间：扩容（growable）和原地腾位（固定容量）两种情况
+    SeqList<std::string> self(4, true);
+    self.append("aaa");
+    self.append("bbb");
+    self.append("ccc");
+    self.append("ddd");
+    assert(self.insert(2, self.begin(), self.end()) && "Inserting the list into itself should succeed");
+    std::string selfJoined;
+    for (const std::string* p = self.begin(); p != self.end(); ++p) {
+        selfJoined += *p + ",";
+    }
+    assert(selfJoined == "aaa,aaa,bbb,ccc,ddd,bbb,ccc,ddd," && "Self range should be copied before moving elements");
+
+    SeqList<std::string> fixed(8);
+    fixed.append("x");
+    fixed.append("y");
+    fixed.append("z");
+    assert(fixed.insert(1, fixed.begin() + 1, fixed.end()) && "Inserting a sub-range of itself should succeed");
+    selfJoined.clear();
+    for (const std::string* p = fixed.begin(); p != fixed.end(); ++p) {
+        selfJoined += *p;
+    }
+    assert(selfJoined == "yzxyz" && "Sub-range should be copied before opening the gap");
+
+    std::cout << "Range insert and erase tests passed!" << std::endl;
+}
+
+// 在所有可用指令集下把向量化内核与标量实现逐一比对
+template<typename T>
+void checkKernelsAgainstScalar(const std::vector<T>& values, const T& key) {
+    using namespace seqlist_simd;
+    // 从不同偏移开始检查，覆盖未对齐的起始地址和各种尾部长度
+    for (int offset = 0; offset < 3 && offset <= static_cast<int>(values.size()); ++offset) {
+        const T* p = values.data() + offset;
+        int n = static_cast<int>(values.size()) - offset;
+        std::vector<int> expectedAll;
+        detail::scalarFindAll(p, n, key, expectedAll);
+        for (int lv = LevelScalar; lv <= supportedLevel(); ++lv) {
+            setLevel(static_cast<Level>(lv));
+            assert(findFirst(p, n, key) == detail::scalarFindFirst(p, n, key) && "findFirst should match scalar");
+            assert(count(p, n, key) == detail::scalarCount(p, n, key) && "count should match scalar");
+            std::vector<int> all;
+            findAll(p, n, key, all);
+            assert(all == expectedAll && "findAll should match scalar");
+            assert(minIndex(p, n) == detail::scalarMinIndex(p, n) && "minIndex should match scalar");
+        }
+    }
+    setLevel(supportedLevel());
+}
+
+template<typename T>
+void checkRandomKernels(int maxValue) {
+    for (int n = 0; n <= 130; n += (n < 40 ? 1 : 7)) {
+        std::vector<T> values;
+        for (int i = 0; i < n; ++i) {
+            values.push_back(static_cast<T>(std::rand() % maxValue));
+        }
+        checkKernelsAgainstScalar(values, static_cast<T>(std::rand() % maxValue));
+        checkKernelsAgainstScalar(values, static_cast<T>(maxValue + 1));
+    }
+}
+
+void testSimdSearch() {
+    std::cout << "Testing SIMD search kernels (level " << seqlist_simd::supportedLevel() << ")..." << std::endl;
+
+    std::srand(12345);
+    checkRandomKernels<int>(7);
+    checkRandomKernels<unsigned int>(7);
+    checkRandomKernels<long long>(7);
+    checkRandomKernels<float>(7);
+    checkRandomKernels<double>(7);
+    checkRandomKernels<short>(7);
+
+    // 负数、重复的最小值出现在不同通道中
+    std::vector<int> negatives(100, 5);
+    negatives[37] = std::numeric_limits<int>::min();
+    negatives[90] = std::numeric_limits<int>::min();
+    negatives[3] = -1;
+    checkKernelsAgainstScalar(negatives, -1);
+
+    // +0.0 与 -0.0 相等；NaN 不等于任何值，位于开头时按标量语义成为“最小值”
+    std::vector<double> zeros(40, 1.0);
+    zeros[10] = 0.0;
+    zeros[21] = -0.0;
+    checkKernelsAgainstScalar(zeros, -0.0);
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    zeros[25] = nan;
+    checkKernelsAgainstScalar(zeros, nan);
+    zeros[2] = nan;
+    checkKernelsAgainstScalar(zeros, 0.0);
+    zeros[0] = nan;
+    checkKernelsAgainstScalar(zeros, 1.0);
+    std::vector<float> floats(50, 2.0f);
+    floats[1] = std::numeric_limits<float>::quiet_NaN();
+    floats[44] = -3.5f;
+    checkKernelsAgainstScalar(floats, -3.5f);
+
+    // SeqList 接口
+    SeqList<int> list(1000);
+    for (int i = 0; i < 1000; ++i) {
+        list.append(i % 10);
+    }
+    assert(list.locate(7) == 8 && "locate should return the first match");
+    assert(list.locate(10) == 0 && "locate should return 0 when not found");
+    assert(list.count(3) == 100 && "count should find every match");
+    std::vector<int> positions = list.find_all(9);
+    assert(positions.size() == 100 && positions.front() == 10 && positions.back() == 1000 &&
+           "find_all should return 1-based positions");
+    list.set(500, -4);
+    list.set(700, -4);
+    int minValue;
+    assert(list.deleteMin(minValue) && minValue == -4 && "deleteMin should find the vectorized minimum");
+    assert(list.find_all(-4) == std::vector<int>(1, 699) && "deleteMin should remove the first minimum");
+
+    SeqList<std::string> strList(4);
+    strList.append("x");
+    strList.append("y");
+    strList.append("x");
+    assert(strList.count("x") == 2 && strList.find_all("y") == std::vector<int>(1, 2) &&
+           "Non-arithmetic types should use the scalar path");
+
+    std::cout << "SIMD search tests passed!" << std::endl;
+}
+
 int main() {
     try {
         testBasicOperations();
@@ -153,6 +419,10 @@ int main() {
         testCopyAndAssignment();
         testExtendedOperations();
         testBoundaryConditions();
+        testGrowable();
+        testMoveAndEmplace();
+        testRangeInsertAndErase();
+        testSimdSearch();
         
         std::cout << "\nAll tests passed successfully!" << std::endl;
         return 0;
@@ -4,6 +4,12 @@
 #include <iostream>
 #include <vector>
 #include <stdexcept>
+#include <type_traits>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include "../../Allocator/NodeAllocator/NodeAllocator.hpp"
+#include "SkipIndex.hpp"
 
 template<typename T>
 struct Node {
@@ -12,25 +18,203 @@ struct Node {
     Node(const T& d = T(), Node<T>* n = nullptr) : data(d), next(n) {}
 };
 
-template<typename T>
+// Alloc 为节点分配策略，见 Allocator/NodeAllocator/NodeAllocator.hpp
+template<typename T, typename Alloc = NewDeleteAllocator<Node<T>>>
 class SingleLinkedList {
 private:
+    Alloc alloc;
     Node<T>* head;  // 头结点（虚拟节点）
+    Node<T>* tail;  // 尾节点，空表时指向头结点
     int length;     // 链表长度（不包括头结点）
+    double compactThreshold;  // 自动紧缩的碎片率阈值，0 表示关闭
+    int modifications;        // 上次检查碎片率之后的结构修改次数
+    SkipIndex<Node<T>>* skip; // 位置索引（跳表），未开启时为 nullptr
+
+    // 分配策略能否整体预留/释放节点
+    typedef std::integral_constant<bool, NodeAllocatorTraits<Alloc>::bulkRelease> BulkTag;
+    // 能否跳过逐个析构、整体丢弃节点
+    typedef std::integral_constant<bool, NodeAllocatorTraits<Alloc>::bulkRelease &&
+                                         std::is_trivially_destructible<T>::value> DropTag;
+    // 节点能否直接转移给另一个链表
+    typedef std::integral_constant<bool, NodeAllocatorTraits<Alloc>::interchangeable> ShareTag;
+
+    void reserveNodes(size_t n, std::true_type) {
+        alloc.reserve(n);
+    }
+
+    void reserveNodes(size_t, std::false_type) {}
+
+    // 逐个析构并回收所有数据节点
+    void destroyNodes() {
+        Node<T>* current = head->next;
+        while (current != nullptr) {
+            Node<T>* next = current->next;
+            alloc.destroy(current);
+            current = next;
+        }
+        head->next = nullptr;
+        tail = head;
+        length = 0;
+    }
+
+    void clearNodes(std::false_type) {
+        destroyNodes();
+    }
+
+    // 节点无需析构：整体丢弃所有区域中的节点（包括头结点），再重新建立头结点
+    void clearNodes(std::true_type) {
+        alloc.reset();
+        head = alloc.create();
+        head->next = nullptr;
+        tail = head;
+        length = 0;
+    }
+
+    void releaseAll(std::false_type) {
+        destroyNodes();
+        alloc.destroy(head);
+    }
+
+    // 节点无需析构：内存随分配器析构一起释放
+    void releaseAll(std::true_type) {}
+
+    // 把 other 的节点链 [first, last] 接在 p 之后
+    void linkChain(Node<T>* p, Node<T>* first, Node<T>* last, int count) {
+        last->next = p->next;
+        p->next = first;
+        if (p == tail) {
+            tail = last;
+        }
+        length += count;
+    }
+
+    // 节点可以共享：直接转移 other 的节点链
+    void spliceNodes(Node<T>* p, SingleLinkedList& other, std::true_type) {
+        linkChain(p, other.head->next, other.tail, other.length);
+        other.head->next = nullptr;
+        other.tail = other.head;
+        other.length = 0;
+        other.rebuildIndex();
+    }
+
+    // 节点属于 other 的分配器：在本表的分配器中复制出一条新链，再清空 other
+    void spliceNodes(Node<T>* p, SingleLinkedList& other, std::false_type) {
+        reserveNodes(other.length, BulkTag());
+        Node<T>* first = alloc.create(other.head->next->data);
+        Node<T>* last = first;
+        try {
+            for (Node<T>* q = other.head->next->next; q != nullptr; q = q->next) {
+                last->next = alloc.create(q->data);
+                last = last->next;
+            }
+        } catch (...) {
+            last->next = nullptr;
+            while (first != nullptr) {
+                Node<T>* next = first->next;
+                alloc.destroy(first);
+                first = next;
+            }
+            throw;
+        }
+        linkChain(p, first, last, other.length);
+        other.clear();
+    }
+
+    // 节点可以共享：复制到临时链表再交换节点链，复制失败时本表保持不变
+    void assign(const SingleLinkedList& other, std::true_type) {
+        SingleLinkedList temp(other);
+        std::swap(head, temp.head);
+        std::swap(tail, temp.tail);
+        std::swap(length, temp.length);
+        std::swap(compactThreshold, temp.compactThreshold);
+        std::swap(modifications, temp.modifications);
+        std::swap(skip, temp.skip);
+    }
+
+    // 节点归各自的分配器所有：先清空再逐个复制，被清空的节点由本表的分配器复用。
+    // 复制中途抛出异常时本表只含已复制的前一部分元素
+    void assign(const SingleLinkedList& other, std::false_type) {
+        clear();
+        compactThreshold = other.compactThreshold;
+        modifications = 0;
+        reserveNodes(other.length, BulkTag());
+        for (Node<T>* p = other.head->next; p != nullptr; p = p->next) {
+            append(p->data);
+        }
+        setIndexed(other.isIndexed());
+    }
+
+    // 整体改变链表结构的操作之后重建位置索引
+    void rebuildIndex() {
+        if (skip != nullptr) {
+            skip->build(head);
+        }
+    }
+
+    // 定位第 index 个节点的前驱（index = 1 时为头结点）。
+    // 开启位置索引时为期望 O(log n)，并记下跳表各层的前驱供随后的插入/删除使用
+    Node<T>* prevOf(int index) const {
+        if (skip != nullptr) {
+            return skip->descend(index - 1);
+        }
+        if (index == length + 1) {
+            return tail;
+        }
+        Node<T>* p = head;
+        for (int i = 1; i < index; ++i) {
+            p = p->next;
+        }
+        return p;
+    }
+
+    // 第 index 个节点（1 <= index <= length）
+    Node<T>* nodeAt(int index) const {
+        if (skip != nullptr) {
+            return skip->find(index);
+        }
+        Node<T>* p = head->next;
+        for (int i = 1; i < index; ++i) {
+            p = p->next;
+        }
+        return p;
+    }
+
+    // 下一个节点位于当前节点之后这么多字节以内时视为"相邻"
+    static std::uintptr_t nearBytes() {
+        return sizeof(Node<T>) * 2 > 128 ? sizeof(Node<T>) * 2 : 128;
+    }
+
+    // 开启自动紧缩时，每累计一定次数的结构修改检查一次碎片率（O(n)），超过阈值则紧缩。
+    // 检查间隔与表长成正比，均摊到每次修改为 O(1)
+    void noteModification() {
+        if (compactThreshold <= 0) {
+            return;
+        }
+        int interval = length / 2 > 64 ? length / 2 : 64;
+        if (++modifications < interval) {
+            return;
+        }
+        modifications = 0;
+        if (fragmentation() > compactThreshold) {
+            compact();
+        }
+    }
 
 public:
     // 默认构造函数
-    SingleLinkedList() : length(0) {
-        head = new Node<T>;
+    SingleLinkedList() : length(0), compactThreshold(0), modifications(0), skip(nullptr) {
+        head = alloc.create();
         head->next = nullptr;
+        tail = head;
     }
     
-    // 使用vector构造
+    // 使用vector构造。节点按链表顺序依次创建，使用区域分配策略时在内存中连续排列
     SingleLinkedList(const std::vector<T>& v, bool reverse = true) : SingleLinkedList() {
+        reserveNodes(v.size(), BulkTag());
         if (reverse) {
-            // 头插法
-            for (const auto& item : v) {
-                insertHead(item);
+            // 效果与逐个头插相同：从后往前尾插
+            for (auto it = v.rbegin(); it != v.rend(); ++it) {
+                append(*it);
             }
         } else {
             // 尾插法
@@ -42,58 +226,63 @@ public:
 
     // 拷贝构造函数
     SingleLinkedList(const SingleLinkedList& other) : SingleLinkedList() {
+        compactThreshold = other.compactThreshold;
+        reserveNodes(other.length, BulkTag());
         Node<T>* p = other.head->next;
         while (p != nullptr) {
             append(p->data);
             p = p->next;
         }
+        setIndexed(other.isIndexed());
     }
 
     // 赋值运算符
     SingleLinkedList& operator=(const SingleLinkedList& other) {
         if (this != &other) {
-            SingleLinkedList temp(other);
-            std::swap(head, temp.head);
-            std::swap(length, temp.length);
+            assign(other, ShareTag());
         }
         return *this;
     }
     
     // 析构函数
     ~SingleLinkedList() {
-        clear();
-        delete head;
+        releaseAll(DropTag());
+        delete skip;
     }
 
-    // 清空链表
+    // 清空链表。使用区域分配策略且元素无需析构时，每个区域只需 O(1)
     void clear() {
-        Node<T>* current = head->next;
-        while (current != nullptr) {
-            Node<T>* next = current->next;
-            delete current;
-            current = next;
-        }
-        head->next = nullptr;
-        length = 0;
+        clearNodes(DropTag());
+        rebuildIndex();
     }
     
     // 头插法
     void insertHead(const T& data) {
-        Node<T>* newNode = new Node<T>(data);
+        if (skip != nullptr) {
+            insert(1, data);
+            return;
+        }
+        Node<T>* newNode = alloc.create(data);
         newNode->next = head->next;
         head->next = newNode;
+        if (tail == head) {
+            tail = newNode;
+        }
         ++length;
+        noteModification();
     }
 
-    // 尾插法
+    // 尾插法，借助尾指针 O(1)；开启位置索引时需要更新跳表，期望 O(log n)
     void append(const T& data) {
-        Node<T>* newNode = new Node<T>(data);
-        Node<T>* p = head;
-        while (p->next != nullptr) {
-            p = p->next;
+        if (skip != nullptr) {
+            insert(length + 1, data);
+            return;
         }
-        p->next = newNode;
+        Node<T>* newNode = alloc.create(data);
+        tail->next = newNode;
+        tail = newNode;
         ++length;
+        noteModification();
     }
     
     // 在指定位置插入元素
@@ -102,15 +291,18 @@ public:
             return false;
         }
         
-        Node<T>* p = head;
-        for (int i = 1; i < index; ++i) {
-            p = p->next;
-        }
-        
-        Node<T>* newNode = new Node<T>(data);
+        Node<T>* p = prevOf(index);
+        Node<T>* newNode = alloc.create(data);
         newNode->next = p->next;
         p->next = newNode;
+        if (p == tail) {
+            tail = newNode;
+        }
         ++length;
+        if (skip != nullptr) {
+            skip->insertAfterDescend(index, newNode);
+        }
+        noteModification();
         return true;
     }
     
@@ -120,16 +312,19 @@ public:
             return false;
         }
         
-        Node<T>* p = head;
-        for (int i = 1; i < index; ++i) {
-            p = p->next;
-        }
-        
+        Node<T>* p = prevOf(index);
         Node<T>* toDelete = p->next;
         data = toDelete->data;
         p->next = toDelete->next;
-        delete toDelete;
+        if (toDelete == tail) {
+            tail = p;
+        }
+        if (skip != nullptr) {
+            skip->removeAfterDescend(toDelete);
+        }
+        alloc.destroy(toDelete);
         --length;
+        noteModification();
         return true;
     }
     
@@ -139,11 +334,7 @@ public:
             return false;
         }
         
-        Node<T>* p = head->next;
-        for (int i = 1; i < index; ++i) {
-            p = p->next;
-        }
-        data = p->data;
+        data = nodeAt(index)->data;
         return true;
     }
 
@@ -153,11 +344,7 @@ public:
             return false;
         }
         
-        Node<T>* p = head->next;
-        for (int i = 1; i < index; ++i) {
-            p = p->next;
-        }
-        p->data = data;
+        nodeAt(index)->data = data;
         return true;
     }
 
@@ -179,6 +366,7 @@ public:
         Node<T>* prev = nullptr;
         Node<T>* curr = head->next;
         Node<T>* next = nullptr;
+        tail = curr;  // 原来的第一个节点成为尾节点
         
         while (curr != nullptr) {
             next = curr->next;
@@ -188,6 +376,98 @@ public:
         }
         
         head->next = prev;
+        rebuildIndex();
+    }
+
+    // 把 other 的全部节点移到第 index 个位置之前（index = length + 1 时接在表尾），
+    // other 变为空表。index 非法或 other 就是自身时返回 false。
+    // 节点可在链表间共享的分配策略（如默认策略）下不复制元素；
+    // 其他策略下节点属于 other 的分配器，只能复制元素，O(other.size())
+    bool splice(int index, SingleLinkedList& other) {
+        if (this == &other || index < 1 || index > length + 1) {
+            return false;
+        }
+        if (other.length == 0) {
+            return true;
+        }
+        spliceNodes(prevOf(index), other, ShareTag());
+        rebuildIndex();
+        return true;
+    }
+
+    // 把 other 整体接到表尾，other 变为空表（默认策略下 O(1)）
+    void concat(SingleLinkedList& other) {
+        splice(length + 1, other);
+    }
+
+    // 紧缩：节点集合不变，把元素按链表顺序重新分配到按地址升序排列的节点上并重连 next，
+    // 之后遍历时地址单调递增；配合 Slab/Arena 分配策略时节点基本连续。O(n log n)
+    void compact() {
+        modifications = 0;
+        if (length < 2) {
+            return;
+        }
+        std::vector<Node<T>*> nodes;
+        nodes.reserve(length);
+        for (Node<T>* p = head->next; p != nullptr; p = p->next) {
+            nodes.push_back(p);
+        }
+        if (std::is_sorted(nodes.begin(), nodes.end(), std::less<Node<T>*>())) {
+            return;
+        }
+        std::vector<T> values;
+        values.reserve(length);
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            values.push_back(std::move(nodes[i]->data));
+        }
+        std::sort(nodes.begin(), nodes.end(), std::less<Node<T>*>());
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            nodes[i]->data = std::move(values[i]);
+            nodes[i]->next = i + 1 < nodes.size() ? nodes[i + 1] : nullptr;
+        }
+        head->next = nodes.front();
+        tail = nodes.back();
+        rebuildIndex();
+    }
+
+    // 碎片率：相邻两个元素之间的链接中，下一个节点不在当前节点之后不远处
+    // （向后跳或跨度超过 nearBytes）的比例，范围 [0, 1]
+    double fragmentation() const {
+        if (length < 2) {
+            return 0;
+        }
+        int far = 0;
+        for (Node<T>* p = head->next; p->next != nullptr; p = p->next) {
+            std::uintptr_t cur = reinterpret_cast<std::uintptr_t>(p);
+            std::uintptr_t nxt = reinterpret_cast<std::uintptr_t>(p->next);
+            if (nxt <= cur || nxt - cur > nearBytes()) {
+                ++far;
+            }
+        }
+        return static_cast<double>(far) / (length - 1);
+    }
+
+    // 开启自动紧缩：碎片率超过 threshold（0~1）时自动调用 compact()，传 0 关闭
+    void setAutoCompact(double threshold) {
+        compactThreshold = threshold;
+        modifications = 0;
+    }
+
+    // 开启或关闭位置索引（可按位置访问的跳表）。开启后 get、set、insert、remove
+    // 按位置定位为期望 O(log n)，代价是约 n/3 座塔的额外内存，以及 append/insertHead
+    // 也要更新跳表（期望 O(log n)）。开启时按当前内容建立索引，O(n)
+    void setIndexed(bool value) {
+        if (value && skip == nullptr) {
+            skip = new SkipIndex<Node<T>>(head);
+            skip->build(head);
+        } else if (!value && skip != nullptr) {
+            delete skip;
+            skip = nullptr;
+        }
+    }
+
+    bool isIndexed() const {
+        return skip != nullptr;
     }
 
     // 获取长度
@@ -200,6 +480,11 @@ public:
         return length == 0;
     }
 
+    // 获取分配策略对象（例如查询区域占用）
+    const Alloc& getAllocator() const {
+        return alloc;
+    }
+
     // 打印链表
     void print() const {
         Node<T>* p = head->next;
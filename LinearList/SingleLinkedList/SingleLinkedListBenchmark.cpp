@@ -0,0 +1,218 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+#include "SingleLinkedList.hpp"
+
+// 尾插法构造的性能测试：SingleLinkedList(v, false) 对 n 个元素逐个 append
+//   legacy ：原实现每次 append 都从头结点走到表尾，总代价 O(n^2)
+//   tail   ：维护尾指针后每次 append 为 O(1)，总代价 O(n)
+// legacy 只在 n 不超过 legacyLimit 时运行。另外测量 concat 两个长表的耗时。
+//
+// 分配策略对比：用 SingleLinkedList(v, false) 构造 policyN 个元素，测量构造、
+// 遍历（locate 一个不存在的值）和析构（clear + 释放）的耗时
+//   new/delete (fresh)      ：默认策略，堆是干净的，节点大致按地址顺序分配
+//   new/delete (fragmented) ：默认策略，先随机释放一半同尺寸的内存块，模拟长时间运行后的堆
+//   slab                    ：SlabAllocator，每 256 个节点一块
+//   arena                   ：ArenaAllocator，构造时一次预留整张表，int 的 clear 整体丢弃
+//
+// 紧缩：在碎片化的堆上用默认策略构造 policyN 个元素，再做 policyN 次随机位置的删除/插入，
+// 测量 compact() 前后遍历一遍的耗时、碎片率以及 compact() 本身的耗时
+// 用法：./SingleLinkedListBenchmark [maxN] [legacyLimit] [policyN]
+//   默认 maxN = 10^7，legacyLimit = 10^5，policyN = 10^6
+
+typedef std::chrono::steady_clock Clock;
+
+static double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// 原实现的尾插法：从头结点开始找表尾
+static void legacyBuild(const std::vector<int>& v) {
+    Node<int>* head = new Node<int>;
+    for (const auto& item : v) {
+        Node<int>* newNode = new Node<int>(item);
+        Node<int>* p = head;
+        while (p->next != nullptr) {
+            p = p->next;
+        }
+        p->next = newNode;
+    }
+    while (head != nullptr) {
+        Node<int>* next = head->next;
+        delete head;
+        head = next;
+    }
+}
+
+static volatile long sink;
+
+// 一次构造/遍历/析构的耗时（毫秒），取 3 轮中最快的
+struct PolicyResult {
+    double buildMs;
+    double traverseMs;
+    double teardownMs;
+};
+
+template<typename List>
+PolicyResult runPolicy(const std::vector<int>& v) {
+    PolicyResult best = {0, 0, 0};
+    for (int round = 0; round < 3; ++round) {
+        Clock::time_point start = Clock::now();
+        List* list = new List(v, false);
+        double build = elapsedMs(start);
+
+        start = Clock::now();
+        int found = 0;
+        for (int i = 0; i < 5; ++i) {
+            found += list->locate(-1);
+        }
+        double traverse = elapsedMs(start) / 5;
+
+        start = Clock::now();
+        delete list;
+        double teardown = elapsedMs(start);
+
+        if (round == 0 || build < best.buildMs) best.buildMs = build;
+        if (round == 0 || traverse < best.traverseMs) best.traverseMs = traverse;
+        if (round == 0 || teardown < best.teardownMs) best.teardownMs = teardown;
+        sink = sink + found;
+    }
+    return best;
+}
+
+static void printPolicy(const char* name, const PolicyResult& r) {
+    std::cout << std::setw(26) << name << std::fixed << std::setprecision(2)
+              << std::setw(12) << r.buildMs << std::setw(14) << r.traverseMs
+              << std::setw(14) << r.teardownMs << std::endl;
+}
+
+// 在堆中留下大量随机分布的、与节点同尺寸的空洞，之后的节点分配会散落各处
+static std::vector<void*> fragmentHeap(size_t n) {
+    std::vector<void*> blocks(2 * n);
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        blocks[i] = ::operator new(sizeof(Node<int>));
+    }
+    std::vector<void*> kept;
+    for (size_t i = blocks.size(); i > 0; --i) {
+        std::swap(blocks[i - 1], blocks[std::rand() % i]);
+    }
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        if (i % 2 == 0) {
+            ::operator delete(blocks[i]);
+        } else {
+            kept.push_back(blocks[i]);
+        }
+    }
+    return kept;
+}
+
+static void benchPolicies(int n) {
+    std::vector<int> v(n);
+    for (int i = 0; i < n; ++i) {
+        v[i] = i;
+    }
+
+    std::cout << "\nallocator policies, " << n << " elements, ms" << std::endl;
+    std::cout << std::setw(26) << "policy" << std::setw(12) << "build"
+              << std::setw(14) << "traverse" << std::setw(14) << "teardown" << std::endl;
+    printPolicy("new/delete (fresh)", runPolicy<SingleLinkedList<int>>(v));
+    printPolicy("slab", runPolicy<SingleLinkedList<int, SlabAllocator<Node<int>, 256>>>(v));
+    printPolicy("arena", runPolicy<SingleLinkedList<int, ArenaAllocator<Node<int>>>>(v));
+
+    std::vector<void*> holes = fragmentHeap(n);
+    printPolicy("new/delete (fragmented)", runPolicy<SingleLinkedList<int>>(v));
+    for (size_t i = 0; i < holes.size(); ++i) {
+        ::operator delete(holes[i]);
+    }
+}
+
+template<typename List>
+double traverseMs(const List& list) {
+    double best = 0;
+    for (int round = 0; round < 5; ++round) {
+        Clock::time_point start = Clock::now();
+        sink = sink + list.locate(-1);
+        double ms = elapsedMs(start);
+        if (round == 0 || ms < best) {
+            best = ms;
+        }
+    }
+    return best;
+}
+
+static void benchCompaction(int n) {
+    std::vector<int> v(n);
+    for (int i = 0; i < n; ++i) {
+        v[i] = i;
+    }
+    std::vector<void*> holes = fragmentHeap(n);
+    SingleLinkedList<int> list(v, false);
+    // 在随机位置删除再插入：链表顺序与地址顺序进一步打乱。用表头附近的位置避免 O(n^2)
+    int value = 0;
+    for (int i = 0; i < n; ++i) {
+        int pos = std::rand() % 64 + 1;
+        list.remove(pos, value);
+        list.insert(std::rand() % 64 + 1, value);
+    }
+
+    std::cout << "\ncompaction, " << n << " elements on a fragmented heap" << std::endl;
+    std::cout << std::fixed << std::setprecision(3)
+              << "  before: fragmentation " << list.fragmentation()
+              << ", traverse " << traverseMs(list) << " ms" << std::endl;
+    Clock::time_point start = Clock::now();
+    list.compact();
+    double compactMs = elapsedMs(start);
+    std::cout << "  after : fragmentation " << list.fragmentation()
+              << ", traverse " << traverseMs(list) << " ms, compact() " << compactMs << " ms" << std::endl;
+    for (size_t i = 0; i < holes.size(); ++i) {
+        ::operator delete(holes[i]);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int maxN = argc > 1 ? std::atoi(argv[1]) : 10000000;
+    int legacyLimit = argc > 2 ? std::atoi(argv[2]) : 100000;
+    int policyN = argc > 3 ? std::atoi(argv[3]) : 1000000;
+
+    std::cout << "build via SingleLinkedList(v, false), total ms (ns per element)" << std::endl;
+    std::cout << std::setw(10) << "n" << std::setw(24) << "legacy" << std::setw(24) << "tail pointer" << std::endl;
+    for (long n = 1000; n <= maxN; n *= 10) {
+        std::vector<int> v(n);
+        for (long i = 0; i < n; ++i) {
+            v[i] = static_cast<int>(i);
+        }
+        std::cout << std::setw(10) << n << std::fixed << std::setprecision(2);
+
+        if (n <= legacyLimit) {
+            Clock::time_point start = Clock::now();
+            legacyBuild(v);
+            double ms = elapsedMs(start);
+            std::cout << std::setw(12) << ms << " (" << std::setw(9) << ms * 1e6 / n << ")";
+        } else {
+            std::cout << std::setw(24) << "skipped";
+        }
+
+        Clock::time_point start = Clock::now();
+        {
+            SingleLinkedList<int> list(v, false);
+        }
+        double ms = elapsedMs(start);
+        std::cout << std::setw(12) << ms << " (" << std::setw(9) << ms * 1e6 / n << ")" << std::endl;
+    }
+
+    // concat：只修改指针，与表长无关
+    std::vector<int> half(maxN / 2, 1);
+    SingleLinkedList<int> a(half, false);
+    SingleLinkedList<int> b(half, false);
+    Clock::time_point start = Clock::now();
+    a.concat(b);
+    double concatUs = elapsedMs(start) * 1000;
+    std::cout << "\nconcat of two lists with " << half.size() << " elements: "
+              << std::fixed << std::setprecision(3) << concatUs << " us, result size " << a.size() << std::endl;
+
+    benchPolicies(policyN);
+    benchCompaction(policyN);
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+#include "SingleLinkedList.hpp"
+
+// 按位置随机访问的性能测试：对 10^5 到 maxN 个元素的链表，在随机位置上执行
+//   get    ：get(i)
+//   set    ：set(i, x)
+//   insert ：insert(i, x) 后 remove(i)，表长不变（计为两次操作）
+// 分别测量开启位置索引（跳表）和普通链表每次操作的平均耗时（ns），
+// 以及开启索引（setIndexed(true)，O(n)）的耗时。普通链表只在 n 不超过 plainLimit 时测量。
+// 用法：./SingleLinkedListIndexBenchmark [maxN] [plainLimit]
+//   默认 maxN = 10^7，plainLimit = 10^5
+
+typedef std::chrono::steady_clock Clock;
+
+static volatile long sink;
+
+static double elapsedNs(Clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+// 对 list 做 ops 次随机位置操作，返回 get / set / insert+remove 每次操作的平均耗时
+template<typename List>
+void measure(List& list, int ops, double result[3]) {
+    int n = list.size();
+    std::vector<int> positions(ops);
+    for (int i = 0; i < ops; ++i) {
+        positions[i] = static_cast<int>((static_cast<long>(std::rand()) * RAND_MAX + std::rand()) % n) + 1;
+    }
+
+    int value = 0;
+    long sum = 0;
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < ops; ++i) {
+        list.get(positions[i], value);
+        sum += value;
+    }
+    result[0] = elapsedNs(start) / ops;
+
+    start = Clock::now();
+    for (int i = 0; i < ops; ++i) {
+        list.set(positions[i], i);
+    }
+    result[1] = elapsedNs(start) / ops;
+
+    start = Clock::now();
+    for (int i = 0; i < ops; ++i) {
+        list.insert(positions[i], i);
+        list.remove(positions[i], value);
+        sum += value;
+    }
+    result[2] = elapsedNs(start) / ops / 2;
+    sink = sink + sum;
+}
+
+int main(int argc, char* argv[]) {
+    int maxN = argc > 1 ? std::atoi(argv[1]) : 10000000;
+    int plainLimit = argc > 2 ? std::atoi(argv[2]) : 100000;
+
+    std::cout << "random positional access, ns per operation" << std::endl;
+    std::cout << std::setw(10) << "n" << std::setw(10) << "mode" << std::setw(12) << "get"
+              << std::setw(12) << "set" << std::setw(14) << "insert/remove" << std::setw(16) << "build index ms" << std::endl;
+
+    for (long n = 100000; n <= maxN; n *= 10) {
+        std::vector<int> v(n);
+        for (long i = 0; i < n; ++i) {
+            v[i] = static_cast<int>(i);
+        }
+        SingleLinkedList<int> list(v, false);
+        double result[3];
+
+        Clock::time_point start = Clock::now();
+        list.setIndexed(true);
+        double buildMs = elapsedNs(start) / 1e6;
+        measure(list, 200000, result);
+        std::cout << std::setw(10) << n << std::setw(10) << "indexed" << std::fixed << std::setprecision(1)
+                  << std::setw(12) << result[0] << std::setw(12) << result[1] << std::setw(14) << result[2]
+                  << std::setw(16) << buildMs << std::endl;
+
+        if (n <= plainLimit) {
+            list.setIndexed(false);
+            measure(list, 2000, result);
+            std::cout << std::setw(10) << n << std::setw(10) << "plain"
+                      << std::setw(12) << result[0] << std::setw(12) << result[1] << std::setw(14) << result[2]
+                      << std::setw(16) << "-" << std::endl;
+        }
+    }
+    return 0;
+}
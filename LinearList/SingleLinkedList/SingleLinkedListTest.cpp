@@ -1,5 +1,8 @@
 #include "SingleLinkedList.hpp"
+#include <algorithm>
 #include <cassert>
+#include <cstdlib>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -105,6 +108,63 @@ void testCopyAndAssignment() {
     std::cout << "Copy constructor and assignment operator tests passed!" << std::endl;
 }
 
+// 复制次数用完后拷贝构造抛出异常的元素，copiesLeft < 0 表示不限
+struct CopyLimited {
+    static int copiesLeft;
+    int value;
+
+    CopyLimited(int v = 0) : value(v) {}
+
+    CopyLimited(const CopyLimited& other) : value(other.value) {
+        if (copiesLeft == 0) {
+            throw std::runtime_error("copy failed");
+        }
+        if (copiesLeft > 0) {
+            --copiesLeft;
+        }
+    }
+
+    CopyLimited& operator=(const CopyLimited&) = default;
+};
+
+int CopyLimited::copiesLeft = -1;
+
+// 节点可以共享的分配策略下，赋值时复制失败不改变目标链表（包括位置索引）
+template<typename List>
+void checkStrongAssignment() {
+    List source, target;
+    for (int i = 1; i <= 5; ++i) {
+        source.append(CopyLimited(i));
+    }
+    target.append(CopyLimited(7));
+    target.append(CopyLimited(8));
+    target.setIndexed(true);
+
+    CopyLimited::copiesLeft = 3;
+    bool thrown = false;
+    try {
+        target = source;
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    CopyLimited::copiesLeft = -1;
+    assert(thrown && "Assignment should propagate the exception");
+
+    CopyLimited value;
+    assert(target.size() == 2 && target.isIndexed() && "Failed assignment should not change the list");
+    assert(target.get(1, value) && value.value == 7 && "Failed assignment should keep the old elements");
+    assert(target.get(2, value) && value.value == 8 && "Failed assignment should keep the old elements");
+}
+
+void testAssignmentExceptionSafety() {
+    std::cout << "Testing exception safety of assignment..." << std::endl;
+
+    checkStrongAssignment<SingleLinkedList<CopyLimited>>();
+    checkStrongAssignment<SingleLinkedList<CopyLimited, ThreadCacheAllocator<Node<CopyLimited>>>>();
+
+    std::cout << "Assignment exception safety tests passed!" << std::endl;
+}
+
 void testReverse() {
     std::cout << "Testing reverse operation..." << std::endl;
     
@@ -159,14 +219,315 @@ void testBoundaryConditions() {
     std::cout << "Boundary conditions tests passed!" << std::endl;
 }
 
+// 按位置依次取出所有元素
+template<typename T, typename Alloc>
+std::vector<T> toVector(const SingleLinkedList<T, Alloc>& list) {
+    std::vector<T> result;
+    T value;
+    for (int i = 1; i <= list.size(); ++i) {
+        list.get(i, value);
+        result.push_back(value);
+    }
+    return result;
+}
+
+void testTailPointer() {
+    std::cout << "Testing tail pointer maintenance..." << std::endl;
+
+    SingleLinkedList<int> list;
+    list.insertHead(2);
+    list.append(3);
+    assert(toVector(list) == std::vector<int>({2, 3}) && "Append after insertHead on empty list should follow it");
+
+    // 在表尾位置 insert 后再 append
+    assert(list.insert(3, 4) && "Insert at the end should succeed");
+    list.append(5);
+    assert(toVector(list) == std::vector<int>({2, 3, 4, 5}) && "Append should follow an insert at the end");
+
+    // 删除尾节点后再 append
+    int value;
+    assert(list.remove(4, value) && value == 5 && "Removing the last element should succeed");
+    list.append(6);
+    assert(toVector(list) == std::vector<int>({2, 3, 4, 6}) && "Append should follow the new last element");
+
+    // 翻转后再 append
+    list.reverse();
+    list.append(1);
+    assert(toVector(list) == std::vector<int>({6, 4, 3, 2, 1}) && "Append after reverse should go to the new end");
+
+    // 删光后再 append
+    while (!list.empty()) {
+        list.remove(1, value);
+    }
+    list.append(7);
+    assert(toVector(list) == std::vector<int>({7}) && "Append after removing everything should work");
+
+    // clear 和赋值后再 append
+    list.clear();
+    list.append(8);
+    assert(toVector(list) == std::vector<int>({8}) && "Append after clear should work");
+    SingleLinkedList<int> other(std::vector<int>({1, 2}), false);
+    list = other;
+    list.append(3);
+    assert(toVector(list) == std::vector<int>({1, 2, 3}) && "Append after assignment should use the copied tail");
+    SingleLinkedList<int> copied(list);
+    copied.append(4);
+    assert(toVector(copied) == std::vector<int>({1, 2, 3, 4}) && "Append after copy should use the copied tail");
+
+    // 尾插法构造大表应为线性时间
+    std::vector<int> big(200000);
+    for (int i = 0; i < 200000; ++i) {
+        big[i] = i;
+    }
+    SingleLinkedList<int> bigList(big, false);
+    assert(bigList.size() == 200000 && bigList.locate(199999) == 200000 && "Tail insertion should keep order");
+
+    std::cout << "Tail pointer tests passed!" << std::endl;
+}
+
+void testSpliceAndConcat() {
+    std::cout << "Testing splice and concat..." << std::endl;
+
+    SingleLinkedList<int> a(std::vector<int>({1, 2, 3}), false);
+    SingleLinkedList<int> b(std::vector<int>({7, 8}), false);
+
+    // 接到中间
+    assert(a.splice(2, b) && "Splice into the middle should succeed");
+    assert(toVector(a) == std::vector<int>({1, 7, 8, 2, 3}) && "Spliced nodes should appear before position 2");
+    assert(b.empty() && b.size() == 0 && "Source list should be empty after splice");
+    b.append(9);
+    assert(toVector(b) == std::vector<int>({9}) && "Source list should be usable after splice");
+
+    // 接到表头、表尾
+    assert(a.splice(1, b) && toVector(a).front() == 9 && "Splice at the front should succeed");
+    SingleLinkedList<int> c(std::vector<int>({4, 5}), false);
+    a.concat(c);
+    a.append(6);
+    assert(toVector(a) == std::vector<int>({9, 1, 7, 8, 2, 3, 4, 5, 6}) && "Concat should update the tail");
+    assert(c.empty() && "Concatenated list should be empty");
+
+    // 空表和非法参数
+    SingleLinkedList<int> empty;
+    assert(a.splice(3, empty) && a.size() == 9 && "Splicing an empty list should be a no-op");
+    empty.concat(a);
+    assert(empty.size() == 9 && a.empty() && "Concat into an empty list should move everything");
+    empty.append(10);
+    assert(empty.locate(10) == 10 && "Append after concat into empty list should go to the end");
+    assert(!empty.splice(0, a) && !empty.splice(12, a) && "Splice with an invalid index should fail");
+    assert(!empty.splice(1, empty) && "Splicing a list into itself should fail");
+
+    std::cout << "Splice and concat tests passed!" << std::endl;
+}
+
+void testArenaAllocator() {
+    std::cout << "Testing arena allocator..." << std::endl;
+
+    typedef ArenaAllocator<Node<int>, 1024> IntArena;
+    std::vector<int> v(5000);
+    for (int i = 0; i < 5000; ++i) {
+        v[i] = i;
+    }
+
+    // 构造时一次预留整张表：头结点所在的区域 + 一个容纳 5000 个节点的区域
+    SingleLinkedList<int, IntArena> list(v, false);
+    assert(list.size() == 5000 && list.locate(4999) == 5000 && "Arena list should keep order");
+    assert(list.getAllocator().arenasAllocated() == 2 && "Vector construction should reserve one arena");
+    SingleLinkedList<int, IntArena> reversed(v);
+    int value;
+    assert(reversed.get(1, value) && value == 4999 && "Reverse construction should match head insertion");
+
+    // 单个删除的节点被复用
+    assert(list.remove(10, value) && value == 9 && "Remove should succeed");
+    list.insertHead(-1);
+    assert(list.getAllocator().arenasAllocated() == 2 && "Freed node should be reused");
+
+    // 元素无需析构时整体丢弃，只保留一个区域
+    list.clear();
+    assert(list.empty() && list.getAllocator().arenasAllocated() == 1 && "Clear should drop all but one arena");
+    list.append(1);
+    list.append(2);
+    assert(toVector(list) == std::vector<int>({1, 2}) && "List should be usable after clear");
+
+    // 拷贝和赋值各自使用自己的分配器
+    SingleLinkedList<int, IntArena> copied(list);
+    copied.append(3);
+    list = copied;
+    assert(toVector(list) == std::vector<int>({1, 2, 3}) && "Assignment should copy into the own arena");
+
+    // 分配器不同的链表之间 splice 会复制元素
+    SingleLinkedList<int, IntArena> other(std::vector<int>({8, 9}), false);
+    assert(list.splice(2, other) && other.empty() && "Splice between arenas should succeed");
+    assert(toVector(list) == std::vector<int>({1, 8, 9, 2, 3}) && "Splice between arenas should copy in order");
+    list.append(4);
+    assert(list.locate(4) == 6 && "Append after splice should use the tail");
+
+    // 需要析构的元素仍逐个析构
+    SingleLinkedList<std::string, ArenaAllocator<Node<std::string>, 4>> strings;
+    for (int i = 0; i < 10; ++i) {
+        strings.append(std::string(32, static_cast<char>('a' + i)));
+    }
+    strings.clear();
+    strings.append("after clear");
+    std::string str;
+    assert(strings.get(1, str) && str == "after clear" && "String arena list should work after clear");
+
+    std::cout << "Arena allocator tests passed!" << std::endl;
+}
+
+void testCompaction() {
+    std::cout << "Testing compaction..." << std::endl;
+
+    typedef ArenaAllocator<Node<int>, 1024> IntArena;
+
+    // 头插法使逻辑顺序与分配顺序相反：每一步都向低地址跳
+    SingleLinkedList<int, IntArena> list;
+    for (int i = 0; i < 1000; ++i) {
+        list.insertHead(i);
+    }
+    assert(list.fragmentation() > 0.9 && "Head-inserted list should be fragmented");
+    std::vector<int> before = toVector(list);
+    list.compact();
+    assert(toVector(list) == before && "Compaction should keep the logical order");
+    assert(list.fragmentation() == 0 && "Compacted arena list should be contiguous");
+    list.append(-1);
+    assert(list.size() == 1001 && list.locate(-1) == 1001 && "Tail should be valid after compaction");
+
+    // 已经按地址排列时 compact 不做任何事
+    list.compact();
+    int value;
+    assert(list.get(1, value) && value == 999 && "Repeated compaction should be harmless");
+
+    // 需要析构的元素同样按值移动
+    SingleLinkedList<std::string> strings;
+    strings.insertHead("c");
+    strings.insertHead("b");
+    strings.insertHead("a");
+    strings.compact();
+    std::string str;
+    assert(strings.get(1, str) && str == "a" && strings.get(3, str) && str == "c" && "String compaction should keep order");
+
+    // 自动紧缩：频繁头插后碎片率保持在阈值附近
+    SingleLinkedList<int, IntArena> autoList;
+    autoList.setAutoCompact(0.5);
+    for (int i = 0; i < 5000; ++i) {
+        autoList.insertHead(i);
+    }
+    assert(autoList.fragmentation() < 0.6 && "Auto compaction should bound fragmentation");
+    assert(autoList.size() == 5000 && autoList.get(1, value) && value == 4999 && "Auto compaction should keep order");
+    assert(autoList.get(5000, value) && value == 0 && "Auto compaction should keep the last element");
+
+    // 赋值同样保留自动紧缩的设置
+    SingleLinkedList<int, IntArena> assigned;
+    assigned = autoList;
+    for (int i = 0; i < 20000; ++i) {
+        assigned.insertHead(i);
+    }
+    assert(assigned.fragmentation() < 0.6 && "Assignment should keep auto compaction");
+
+    std::cout << "Compaction tests passed!" << std::endl;
+}
+
+void testSkipIndex() {
+    std::cout << "Testing skip-list index..." << std::endl;
+
+    SingleLinkedList<int> list;
+    list.setIndexed(true);
+    assert(list.isIndexed() && "Index should be enabled");
+
+    // 与 std::vector 对照执行随机的位置操作
+    std::vector<int> reference;
+    std::srand(12345);
+    int value;
+    for (int step = 0; step < 20000; ++step) {
+        int op = std::rand() % 6;
+        int n = static_cast<int>(reference.size());
+        if (op <= 1 || n == 0) {
+            int pos = std::rand() % (n + 1) + 1;
+            assert(list.insert(pos, step) && "Indexed insert should succeed");
+            reference.insert(reference.begin() + (pos - 1), step);
+        } else if (op == 2) {
+            int pos = std::rand() % n + 1;
+            assert(list.remove(pos, value) && value == reference[pos - 1] && "Indexed remove should match");
+            reference.erase(reference.begin() + (pos - 1));
+        } else if (op == 3) {
+            int pos = std::rand() % n + 1;
+            assert(list.get(pos, value) && value == reference[pos - 1] && "Indexed get should match");
+        } else if (op == 4) {
+            int pos = std::rand() % n + 1;
+            assert(list.set(pos, -step) && "Indexed set should succeed");
+            reference[pos - 1] = -step;
+        } else if (std::rand() % 2) {
+            list.append(step);
+            reference.push_back(step);
+        } else {
+            list.insertHead(step);
+            reference.insert(reference.begin(), step);
+        }
+    }
+    assert(toVector(list) == reference && "Indexed list should match the reference");
+    assert(!list.insert(0, 1) && !list.get(list.size() + 1, value) && "Indexed bounds should be checked");
+
+    // 整体改变结构的操作之后索引仍然正确
+    list.reverse();
+    std::reverse(reference.begin(), reference.end());
+    SingleLinkedList<int> other(std::vector<int>({7, 8, 9}), false);
+    assert(list.splice(10, other) && "Splice into an indexed list should succeed");
+    reference.insert(reference.begin() + 9, {7, 8, 9});
+    list.compact();
+    for (int pos = 1; pos <= list.size(); pos += 37) {
+        assert(list.get(pos, value) && value == reference[pos - 1] && "Index should survive reverse/splice/compact");
+    }
+    assert(list.get(list.size(), value) && value == reference.back() && "Last element should be reachable");
+
+    // 拷贝保留索引模式，清空后可以继续使用
+    SingleLinkedList<int> copied(list);
+    assert(copied.isIndexed() && toVector(copied) == reference && "Copy should keep the index");
+    copied.clear();
+    copied.append(1);
+    copied.insert(1, 0);
+    assert(copied.get(2, value) && value == 1 && "Index should work after clear");
+
+    // 赋值同样沿用索引模式：开启和关闭都跟随右侧的链表
+    SingleLinkedList<int> assigned;
+    assigned = list;
+    assert(assigned.isIndexed() && toVector(assigned) == reference && "Assignment should keep the index");
+    assert(assigned.get(reference.size(), value) && value == reference.back() && "Assigned index should reach the tail");
+    assigned = SingleLinkedList<int>(std::vector<int>({1, 2}), false);
+    assert(!assigned.isIndexed() && toVector(assigned) == std::vector<int>({1, 2}) && "Assignment should drop the index");
+
+    // 区域分配策略下 clear 会重建头结点，索引随之更新
+    SingleLinkedList<int, ArenaAllocator<Node<int>, 64>> arena(std::vector<int>({1, 2, 3}), false);
+    arena.setIndexed(true);
+    arena.clear();
+    arena.append(5);
+    arena.insert(1, 4);
+    assert(arena.get(1, value) && value == 4 && arena.get(2, value) && value == 5 && "Arena index should survive clear");
+
+    // 关闭后回到逐个遍历
+    list.setIndexed(false);
+    assert(!list.isIndexed() && list.get(5, value) && value == reference[4] && "Disabling the index should keep data");
+    list.setIndexed(true);
+    assert(list.remove(list.size(), value) && value == reference.back() && "Remove last should succeed");
+    list.append(42);
+    assert(list.get(list.size(), value) && value == 42 && "Tail should be maintained in indexed mode");
+
+    std::cout << "Skip-list index tests passed!" << std::endl;
+}
+
 int main() {
     try {
         testBasicOperations();
         testStringList();
         testVectorConstruction();
         testCopyAndAssignment();
+        testAssignmentExceptionSafety();
         testReverse();
         testBoundaryConditions();
+        testTailPointer();
+        testSpliceAndConcat();
+        testArenaAllocator();
+        testCompaction();
+        testSkipIndex();
         
         std::cout << "\nAll tests passed successfully!" << std::endl;
         return 0;
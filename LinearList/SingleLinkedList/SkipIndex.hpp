@@ -0,0 +1,223 @@
+#ifndef SKIP_INDEX_HPP
+#define SKIP_INDEX_HPP
+
+#include <cstdint>
+#include <new>
+
+// 建立在单链表之上的可按位置索引的跳表：链表本身是第 0 层，
+// 约 1/4 的节点带有一座"塔"，塔的第 l 层指向同一层的下一座塔，并记录跨过的节点数（span）。
+// 按位置查找时从最高层向下走，期望 O(log n)。NodeT 需要有 next 成员，位置 0 为头结点
+template<typename NodeT>
+class SkipIndex {
+private:
+    static const int kMaxLevels = 16;  // 每层概率 1/4，可覆盖约 4^16 个元素
+
+    struct Tower;
+
+    struct Level {
+        Tower* next;  // 同一层的下一座塔，没有时为 nullptr
+        int span;     // 到 next 跨过的节点数，next 为空时无意义
+    };
+
+    struct Tower {
+        NodeT* node;
+        int height;
+
+        Level* levels() {
+            return reinterpret_cast<Level*>(this + 1);
+        }
+    };
+
+    Tower* head;                  // 头结点上的塔，高度为 kMaxLevels
+    int levels;                   // 当前使用的层数
+    std::uint64_t seed;
+    Tower* update[kMaxLevels];    // 最近一次 descend 在每一层停下的塔
+    int rank[kMaxLevels];         // 以及这些塔所在的位置
+
+    static Tower* createTower(NodeT* node, int height) {
+        void* memory = ::operator new(sizeof(Tower) + sizeof(Level) * height);
+        Tower* tower = static_cast<Tower*>(memory);
+        tower->node = node;
+        tower->height = height;
+        for (int l = 0; l < height; ++l) {
+            tower->levels()[l].next = nullptr;
+            tower->levels()[l].span = 0;
+        }
+        return tower;
+    }
+
+    static void destroyTower(Tower* tower) {
+        ::operator delete(tower);
+    }
+
+    // 塔高：每升一层的概率为 1/4
+    int randomHeight() {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        std::uint64_t bits = seed;
+        int height = 0;
+        while (height < kMaxLevels && (bits & 3) == 0) {
+            ++height;
+            bits >>= 2;
+        }
+        return height;
+    }
+
+    // 释放除头塔以外的所有塔（每座塔都出现在最低一层）
+    void releaseTowers() {
+        Tower* tower = levels > 0 ? head->levels()[0].next : nullptr;
+        while (tower != nullptr) {
+            Tower* next = tower->levels()[0].next;
+            destroyTower(tower);
+            tower = next;
+        }
+        for (int l = 0; l < kMaxLevels; ++l) {
+            head->levels()[l].next = nullptr;
+            head->levels()[l].span = 0;
+        }
+        levels = 0;
+    }
+
+public:
+    explicit SkipIndex(NodeT* headNode) : levels(0), seed(0x9E3779B97F4A7C15ULL) {
+        head = createTower(headNode, kMaxLevels);
+    }
+
+    ~SkipIndex() {
+        releaseTowers();
+        destroyTower(head);
+    }
+
+    SkipIndex(const SkipIndex&) = delete;
+    SkipIndex& operator=(const SkipIndex&) = delete;
+
+    // 按链表当前内容重新建立所有塔，O(n)
+    void build(NodeT* headNode) {
+        releaseTowers();
+        head->node = headNode;
+        Tower* last[kMaxLevels];
+        int lastPos[kMaxLevels];
+        for (int l = 0; l < kMaxLevels; ++l) {
+            last[l] = head;
+            lastPos[l] = 0;
+        }
+        int pos = 0;
+        for (NodeT* p = headNode->next; p != nullptr; p = p->next) {
+            ++pos;
+            int height = randomHeight();
+            if (height == 0) {
+                continue;
+            }
+            Tower* tower = createTower(p, height);
+            for (int l = 0; l < height; ++l) {
+                last[l]->levels()[l].next = tower;
+                last[l]->levels()[l].span = pos - lastPos[l];
+                last[l] = tower;
+                lastPos[l] = pos;
+            }
+            if (height > levels) {
+                levels = height;
+            }
+        }
+    }
+
+    // 返回位置 target 上的节点（0 为头结点），并记下每一层的前驱，供随后的 insertAfterDescend /
+    // removeAfterDescend 使用。期望 O(log n)
+    NodeT* descend(int target) {
+        Tower* x = head;
+        int pos = 0;
+        for (int l = levels - 1; l >= 0; --l) {
+            Level* level = x->levels() + l;
+            while (level->next != nullptr && pos + level->span <= target) {
+                pos += level->span;
+                x = level->next;
+                level = x->levels() + l;
+            }
+            update[l] = x;
+            rank[l] = pos;
+        }
+        NodeT* p = x->node;
+        while (pos < target) {
+            p = p->next;
+            ++pos;
+        }
+        return p;
+    }
+
+    // 只读查找，不记录前驱
+    NodeT* find(int target) const {
+        Tower* x = head;
+        int pos = 0;
+        for (int l = levels - 1; l >= 0; --l) {
+            const Level* level = x->levels() + l;
+            while (level->next != nullptr && pos + level->span <= target) {
+                pos += level->span;
+                x = level->next;
+                level = x->levels() + l;
+            }
+        }
+        NodeT* p = x->node;
+        while (pos < target) {
+            p = p->next;
+            ++pos;
+        }
+        return p;
+    }
+
+    // node 已经作为第 k 个元素链入链表，且之前调用过 descend(k - 1)
+    void insertAfterDescend(int k, NodeT* node) {
+        int height = randomHeight();
+        if (height > levels) {
+            for (int l = levels; l < height; ++l) {
+                update[l] = head;
+                rank[l] = 0;
+            }
+            levels = height;
+        }
+        Tower* tower = height > 0 ? createTower(node, height) : nullptr;
+        for (int l = 0; l < levels; ++l) {
+            Level* prev = update[l]->levels() + l;
+            if (l < height) {
+                Level* level = tower->levels() + l;
+                level->next = prev->next;
+                // prev 到原来的 next 跨过 prev->span 个节点，插入后 next 后移一位
+                level->span = prev->next != nullptr ? prev->span + rank[l] + 1 - k : 0;
+                prev->next = tower;
+                prev->span = k - rank[l];
+            } else if (prev->next != nullptr) {
+                ++prev->span;
+            }
+        }
+    }
+
+    // node 是刚从链表中摘下的原第 k 个元素，且之前调用过 descend(k - 1)
+    void removeAfterDescend(NodeT* node) {
+        Tower* victim = nullptr;
+        for (int l = 0; l < levels; ++l) {
+            Level* prev = update[l]->levels() + l;
+            Tower* next = prev->next;
+            if (next != nullptr && next->node == node) {
+                Level* level = next->levels() + l;
+                prev->next = level->next;
+                prev->span = level->next != nullptr ? prev->span + level->span - 1 : 0;
+                victim = next;
+            } else if (next != nullptr) {
+                --prev->span;
+            }
+        }
+        if (victim != nullptr) {
+            destroyTower(victim);
+        }
+        while (levels > 0 && head->levels()[levels - 1].next == nullptr) {
+            --levels;
+        }
+    }
+
+    // 当前层数（不含链表本身）
+    int height() const {
+        return levels;
+    }
+};
+
+#endif // SKIP_INDEX_HPP
@@ -0,0 +1,267 @@
+#ifndef SORTED_SEQLIST_HPP
+#define SORTED_SEQLIST_HPP
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include "../SeqList/SeqList.hpp"
+
+// 有序顺序表：元素保存在 SeqList 中并始终按 Compare 升序排列
+// 位置与 SeqList 一致，从 1 开始
+template<typename T, typename Compare = std::less<T>>
+class SortedSeqList {
+private:
+    SeqList<T> list;
+    Compare comp;
+
+    // Eytzinger（BFS）布局的只读索引：eytz[k] 的左右孩子为 eytz[2k]、eytz[2k+1]，
+    // rank[k] 为该元素在有序表中的位置。表被修改后索引失效
+    std::vector<T> eytz;
+    std::vector<int> rank;
+    bool indexed;
+
+    // 一次预取覆盖的 eytz 元素个数（约一个缓存行）
+    static const int kPrefetchStride = sizeof(T) >= 64 ? 1 : static_cast<int>(64 / sizeof(T));
+
+    const T& at(int pos) const {
+        return list.begin()[pos - 1];
+    }
+
+    void invalidateIndex() {
+        if (indexed) {
+            indexed = false;
+            std::vector<T>().swap(eytz);
+            std::vector<int>().swap(rank);
+        }
+    }
+
+    // 按中序遍历把有序表填入 BFS 布局
+    int fillEytzinger(int pos, int k) {
+        int n = list.size();
+        if (k <= n) {
+            pos = fillEytzinger(pos, 2 * k);
+            eytz[k] = at(pos);
+            rank[k] = pos;
+            ++pos;
+            pos = fillEytzinger(pos, 2 * k + 1);
+        }
+        return pos;
+    }
+
+    // 在 Eytzinger 布局上无分支地下降：goRight(x) 为真时进入右子树。
+    // 返回第一个使 goRight 为假的元素位置，不存在时返回 size() + 1
+    template<typename GoRight>
+    int searchEytzinger(GoRight goRight) const {
+        int n = list.size();
+        const T* base = eytz.data();
+        int k = 1;
+        while (k <= n) {
+#if defined(__GNUC__) || defined(__clang__)
+            // 预取若干层之后的子孙：它们在 eytz 中连续存放，大致落在同一个缓存行
+            __builtin_prefetch(base + static_cast<long>(k) * kPrefetchStride);
+#endif
+            k = 2 * k + (goRight(base[k]) ? 1 : 0);
+        }
+        // 去掉末尾连续的 1（以及其后的一个 0），回到最后一次向左走的节点
+#if defined(__GNUC__) || defined(__clang__)
+        k >>= __builtin_ffs(~k);
+#else
+        while (k & 1) {
+            k >>= 1;
+        }
+        k >>= 1;
+#endif
+        return k == 0 ? n + 1 : rank[k];
+    }
+
+    struct LessThan {
+        const Compare* comp;
+        const T* value;
+        bool operator()(const T& e) const { return (*comp)(e, *value); }
+    };
+
+    struct NotGreater {
+        const Compare* comp;
+        const T* value;
+        bool operator()(const T& e) const { return !(*comp)(*value, e); }
+    };
+
+public:
+    // 构造函数，grow 为 true 时表满后自动扩容
+    explicit SortedSeqList(int size, bool grow = false, const Compare& compare = Compare())
+        : list(size, grow), comp(compare), indexed(false) {}
+
+    // 插入元素并保持有序，相等元素插在已有元素之后
+    bool insert(const T& element) {
+        int pos = upper_bound(element);
+        bool ok = list.insert(pos, element);
+        if (ok) {
+            invalidateIndex();
+        }
+        return ok;
+    }
+
+    // 插入元素（移动）
+    bool insert(T&& element) {
+        int pos = upper_bound(element);
+        bool ok = list.insert(pos, std::move(element));
+        if (ok) {
+            invalidateIndex();
+        }
+        return ok;
+    }
+
+    // 合并一批元素：先整体追加到表尾，再一趟归并，复杂度 O(n + m)。
+    // 批次无序时先排序（O(m log m)）。固定容量放不下整批时返回 false，表保持不变
+    template<typename InputIt>
+    bool merge(InputIt first, InputIt last) {
+        int n = list.size();
+        if (!list.insert(n + 1, first, last)) {
+            return false;
+        }
+        T* begin = list.begin();
+        T* mid = begin + n;
+        T* end = list.end();
+        if (mid == end) {
+            return true;
+        }
+        if (!std::is_sorted(mid, end, comp)) {
+            std::stable_sort(mid, end, comp);
+        }
+        std::inplace_merge(begin, mid, end, comp);
+        invalidateIndex();
+        return true;
+    }
+
+    // 删除指定位置的元素
+    bool remove(int index, T& element) {
+        bool ok = list.remove(index, element);
+        if (ok) {
+            invalidateIndex();
+        }
+        return ok;
+    }
+
+    // 删除一个等于 value 的元素
+    bool removeValue(const T& value) {
+        int pos = locate(value);
+        if (pos == 0) {
+            return false;
+        }
+        list.erase(pos, pos);
+        invalidateIndex();
+        return true;
+    }
+
+    // 删除位置 first 到 last（含两端）的所有元素
+    bool erase(int first, int last) {
+        bool ok = list.erase(first, last);
+        if (ok) {
+            invalidateIndex();
+        }
+        return ok;
+    }
+
+    // 第一个不小于 value 的元素位置，不存在时返回 size() + 1
+    int lower_bound(const T& value) const {
+        if (indexed) {
+            LessThan goRight = {&comp, &value};
+            return searchEytzinger(goRight);
+        }
+        return static_cast<int>(std::lower_bound(list.begin(), list.end(), value, comp) - list.begin()) + 1;
+    }
+
+    // 第一个大于 value 的元素位置，不存在时返回 size() + 1
+    int upper_bound(const T& value) const {
+        if (indexed) {
+            NotGreater goRight = {&comp, &value};
+            return searchEytzinger(goRight);
+        }
+        return static_cast<int>(std::upper_bound(list.begin(), list.end(), value, comp) - list.begin()) + 1;
+    }
+
+    // 查找元素位置（第一个等于 value 的元素），未找到返回 0，复杂度 O(log n)
+    int locate(const T& value) const {
+        int pos = lower_bound(value);
+        if (pos <= list.size() && !comp(value, at(pos))) {
+            return pos;
+        }
+        return 0;
+    }
+
+    bool contains(const T& value) const {
+        return locate(value) != 0;
+    }
+
+    // 等于 value 的元素个数
+    int count(const T& value) const {
+        int pos = lower_bound(value);
+        if (pos > list.size() || comp(value, at(pos))) {
+            return 0;
+        }
+        return upper_bound(value) - pos;
+    }
+
+    // 为只读查找建立 Eytzinger 布局索引，之后的查找无分支并可预取；
+    // 任何修改操作都会丢弃索引，需要时重新调用
+    void buildIndex() {
+        int n = list.size();
+        std::vector<T> layout;
+        std::vector<int> ranks(n + 1, 0);
+        if (n > 0) {
+            layout.assign(n + 1, at(1));
+        }
+        eytz.swap(layout);
+        rank.swap(ranks);
+        fillEytzinger(1, 1);
+        indexed = true;
+    }
+
+    // 是否已建立 Eytzinger 索引
+    bool hasIndex() const {
+        return indexed;
+    }
+
+    // 获取元素
+    bool get(int index, T& element) const {
+        return list.get(index, element);
+    }
+
+    int size() const {
+        return list.size();
+    }
+
+    int capacity() const {
+        return list.capacity();
+    }
+
+    bool empty() const {
+        return list.empty();
+    }
+
+    bool full() const {
+        return list.full();
+    }
+
+    void reserve(int n) {
+        list.reserve(n);
+    }
+
+    void clear() {
+        list.clear();
+        invalidateIndex();
+    }
+
+    // 只读迭代器，元素按升序排列
+    const T* begin() const {
+        return list.begin();
+    }
+
+    const T* end() const {
+        return list.end();
+    }
+};
+
+#endif // SORTED_SEQLIST_HPP
@@ -0,0 +1,118 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+#include <algorithm>
+#include <vector>
+#include "SortedSeqList.hpp"
+
+// 有序顺序表的性能测试
+// 1. 查找：表长 n 从 10^3 到 maxN，随机查找 queries 次（约一半命中）
+//      SeqList::locate  ：线性扫描（n 较大时只测少量查询）
+//      binary           ：std::lower_bound 二分
+//      eytzinger        ：buildIndex() 之后的无分支 BFS 布局查找
+// 2. 批量插入：在长度为 base 的表中插入 m 个随机元素
+//      single insert    ：m 次有序插入
+//      merge            ：一次 merge，O(n + m)
+// 用法：./SortedSeqListBenchmark [maxN] [queries]
+//   默认 maxN = 10^7，queries = 10^6
+
+typedef std::chrono::steady_clock Clock;
+
+static double elapsedNs(Clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+static volatile long sink;
+
+static void benchLookup(int n, int queries) {
+    SortedSeqList<int> sorted(n);
+    std::vector<int> values(n);
+    for (int i = 0; i < n; ++i) {
+        values[i] = 2 * i;   // 偶数，查找奇数时未命中
+    }
+    sorted.merge(values.begin(), values.end());
+    SeqList<int> plain(n);
+    plain.insert(1, values.begin(), values.end());
+
+    std::vector<int> keys(queries);
+    for (int i = 0; i < queries; ++i) {
+        keys[i] = static_cast<int>((static_cast<long>(std::rand()) * 2 * n) / RAND_MAX);
+    }
+
+    // 线性扫描代价与 n 成正比，限制总扫描量
+    int linearQueries = static_cast<int>(std::min<long>(queries, 200000000L / n + 1));
+    Clock::time_point start = Clock::now();
+    long found = 0;
+    for (int i = 0; i < linearQueries; ++i) {
+        found += plain.locate(keys[i]);
+    }
+    double linearNs = elapsedNs(start) / linearQueries;
+
+    start = Clock::now();
+    for (int i = 0; i < queries; ++i) {
+        found += sorted.lower_bound(keys[i]);
+    }
+    double binaryNs = elapsedNs(start) / queries;
+
+    sorted.buildIndex();
+    start = Clock::now();
+    for (int i = 0; i < queries; ++i) {
+        found += sorted.lower_bound(keys[i]);
+    }
+    double eytzNs = elapsedNs(start) / queries;
+    sink = sink + found;
+
+    std::cout << std::setw(10) << n << std::fixed << std::setprecision(1)
+              << std::setw(18) << linearNs << std::setw(12) << binaryNs
+              << std::setw(12) << eytzNs << std::endl;
+}
+
+static void benchMerge(int base, int m) {
+    std::vector<int> initial(base);
+    for (int i = 0; i < base; ++i) {
+        initial[i] = std::rand();
+    }
+    std::vector<int> batch(m);
+    for (int i = 0; i < m; ++i) {
+        batch[i] = std::rand();
+    }
+
+    SortedSeqList<int> single(base + m);
+    single.merge(initial.begin(), initial.end());
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < m; ++i) {
+        single.insert(batch[i]);
+    }
+    double singleMs = elapsedNs(start) / 1e6;
+
+    SortedSeqList<int> merged(base + m);
+    merged.merge(initial.begin(), initial.end());
+    start = Clock::now();
+    std::sort(batch.begin(), batch.end());
+    merged.merge(batch.begin(), batch.end());
+    double mergeMs = elapsedNs(start) / 1e6;
+
+    std::cout << std::setw(10) << base << std::setw(10) << m << std::fixed << std::setprecision(2)
+              << std::setw(18) << singleMs << std::setw(14) << mergeMs << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int maxN = argc > 1 ? std::atoi(argv[1]) : 10000000;
+    int queries = argc > 2 ? std::atoi(argv[2]) : 1000000;
+
+    std::cout << "lookup, ns per query" << std::endl;
+    std::cout << std::setw(10) << "n" << std::setw(18) << "SeqList::locate"
+              << std::setw(12) << "binary" << std::setw(12) << "eytzinger" << std::endl;
+    for (long n = 1000; n <= maxN; n *= 10) {
+        benchLookup(static_cast<int>(n), queries);
+    }
+
+    std::cout << "\nbulk insert, total ms (merge includes sorting the batch)" << std::endl;
+    std::cout << std::setw(10) << "base" << std::setw(10) << "m"
+              << std::setw(18) << "single insert" << std::setw(14) << "merge" << std::endl;
+    benchMerge(1000000, 1000);
+    benchMerge(1000000, 10000);
+    benchMerge(1000000, 100000);
+    return 0;
+}
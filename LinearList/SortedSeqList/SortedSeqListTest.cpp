@@ -0,0 +1,156 @@
+#include "SortedSeqList.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <list>
+#include <algorithm>
+#include <functional>
+
+void testInsertKeepsOrder() {
+    std::cout << "Testing ordered insert..." << std::endl;
+
+    SortedSeqList<int> list(10);
+    assert(list.empty() && "New list should be empty");
+    int values[] = {5, 1, 9, 3, 7, 3};
+    for (int v : values) {
+        assert(list.insert(v) && "Insert should succeed");
+    }
+    int expected[] = {1, 3, 3, 5, 7, 9};
+    assert(list.size() == 6 && std::equal(list.begin(), list.end(), expected) && "Elements should be sorted");
+
+    SortedSeqList<int> small(2);
+    assert(small.insert(2) && small.insert(1) && "Inserts within capacity should succeed");
+    assert(!small.insert(3) && "Insert into a full fixed-capacity list should fail");
+
+    SortedSeqList<int> growing(1, true);
+    for (int i = 10; i > 0; --i) {
+        assert(growing.insert(i) && "Growable list should accept every insert");
+    }
+    assert(growing.size() == 10 && std::is_sorted(growing.begin(), growing.end()) && "Growable list should stay sorted");
+
+    // 自定义比较器：降序，相等元素保持插入顺序
+    SortedSeqList<std::string, std::greater<std::string>> desc(4, true);
+    desc.insert("b");
+    desc.insert("d");
+    desc.insert("a");
+    std::string joined;
+    for (const std::string* p = desc.begin(); p != desc.end(); ++p) {
+        joined += *p;
+    }
+    assert(joined == "dba" && "Custom comparator should order descending");
+
+    std::cout << "Ordered insert tests passed!" << std::endl;
+}
+
+void testSearch() {
+    std::cout << "Testing binary search..." << std::endl;
+
+    SortedSeqList<int> list(20);
+    int values[] = {2, 4, 4, 4, 8, 10};
+    for (int v : values) {
+        list.insert(v);
+    }
+
+    // 分别在二分查找和 Eytzinger 索引下检查同一组结果
+    for (int round = 0; round < 2; ++round) {
+        if (round == 1) {
+            list.buildIndex();
+            assert(list.hasIndex() && "Index should be built");
+        }
+        assert(list.lower_bound(4) == 2 && "lower_bound(4) should be position 2");
+        assert(list.upper_bound(4) == 5 && "upper_bound(4) should be position 5");
+        assert(list.lower_bound(1) == 1 && list.upper_bound(1) == 1 && "Bounds below the minimum should be 1");
+        assert(list.lower_bound(11) == 7 && list.upper_bound(10) == 7 && "Bounds past the maximum should be size + 1");
+        assert(list.lower_bound(5) == 5 && list.upper_bound(5) == 5 && "Bounds of a missing value should match");
+        assert(list.locate(4) == 2 && list.locate(10) == 6 && "locate should find the first match");
+        assert(list.locate(5) == 0 && list.locate(0) == 0 && "locate should return 0 for missing values");
+        assert(list.count(4) == 3 && list.count(7) == 0 && "count should use the bounds");
+        assert(list.contains(8) && !list.contains(9) && "contains should match locate");
+    }
+
+    // 修改后索引失效，查找退回二分
+    list.insert(6);
+    assert(!list.hasIndex() && "Modification should drop the index");
+    assert(list.locate(6) == 5 && "Search should still work without the index");
+
+    SortedSeqList<int> empty(1);
+    empty.buildIndex();
+    assert(empty.lower_bound(3) == 1 && empty.locate(3) == 0 && "Search on an empty indexed list should work");
+
+    // 随机数据与 std::lower_bound / std::upper_bound 比对，覆盖各种树高
+    std::srand(2024);
+    for (int n = 1; n <= 200; n += 13) {
+        SortedSeqList<int> random(n);
+        std::vector<int> reference;
+        for (int i = 0; i < n; ++i) {
+            int v = std::rand() % (n / 2 + 1);
+            random.insert(v);
+            reference.push_back(v);
+        }
+        std::sort(reference.begin(), reference.end());
+        random.buildIndex();
+        for (int v = -1; v <= n / 2 + 2; ++v) {
+            int lower = static_cast<int>(std::lower_bound(reference.begin(), reference.end(), v) - reference.begin()) + 1;
+            int upper = static_cast<int>(std::upper_bound(reference.begin(), reference.end(), v) - reference.begin()) + 1;
+            assert(random.lower_bound(v) == lower && "Eytzinger lower_bound should match std::lower_bound");
+            assert(random.upper_bound(v) == upper && "Eytzinger upper_bound should match std::upper_bound");
+        }
+    }
+
+    std::cout << "Binary search tests passed!" << std::endl;
+}
+
+void testMerge() {
+    std::cout << "Testing bulk merge..." << std::endl;
+
+    SortedSeqList<int> list(10);
+    list.insert(1);
+    list.insert(5);
+    list.insert(9);
+    list.buildIndex();
+
+    std::vector<int> batch = {2, 5, 10};
+    assert(list.merge(batch.begin(), batch.end()) && "Merge should succeed");
+    int expected1[] = {1, 2, 5, 5, 9, 10};
+    assert(list.size() == 6 && std::equal(list.begin(), list.end(), expected1) && "Batch should be merged in order");
+    assert(!list.hasIndex() && "Merge should drop the index");
+
+    // 无序批次先排序再归并
+    std::list<int> unsorted = {7, 0, 3};
+    assert(list.merge(unsorted.begin(), unsorted.end()) && "Unsorted batch should be accepted");
+    int expected2[] = {0, 1, 2, 3, 5, 5, 7, 9, 10};
+    assert(list.size() == 9 && std::equal(list.begin(), list.end(), expected2) && "Unsorted batch should be sorted first");
+
+    // 固定容量放不下整批时失败，表保持不变
+    std::vector<int> big = {4, 6};
+    assert(!list.merge(big.begin(), big.end()) && "Merge beyond capacity should fail");
+    assert(list.size() == 9 && std::equal(list.begin(), list.end(), expected2) && "Failed merge should leave the list unchanged");
+    assert(list.merge(big.begin(), big.begin()) && "Merging an empty batch should succeed");
+
+    // 删除
+    int removed;
+    assert(list.remove(1, removed) && removed == 0 && "Remove by position should succeed");
+    assert(list.removeValue(5) && list.count(5) == 1 && "removeValue should remove one match");
+    assert(!list.removeValue(42) && "removeValue of a missing value should fail");
+    assert(list.erase(1, 2) && list.lower_bound(3) == 1 && "erase should remove a range");
+    list.clear();
+    assert(list.empty() && "clear should empty the list");
+
+    std::cout << "Bulk merge tests passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testInsertKeepsOrder();
+        testSearch();
+        testMerge();
+
+        std::cout << "\nAll tests passed successfully!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,151 @@
+#ifndef CONCURRENT_LINKED_QUEUE_HPP
+#define CONCURRENT_LINKED_QUEUE_HPP
+
+#include <atomic>
+#include <utility>
+#include "HazardPointer.hpp"
+
+// Michael-Scott 无锁队列
+// 与 LinkedQueue 相同，使用带头结点（dummy）的单链表：front 指向头结点，
+// 第一个元素存放在 front->next 中。front/rear 改为原子指针，入队和出队通过 CAS 推进，
+// 出队摘下的旧头结点通过危险指针（HazardPointer.hpp）延迟释放。
+template<typename T>
+class ConcurrentLinkedQueue {
+private:
+    struct Node {
+        T data;
+        std::atomic<Node*> next;
+
+        Node() : data(), next(nullptr) {}
+        explicit Node(const T& d) : data(d), next(nullptr) {}
+        explicit Node(T&& d) : data(std::move(d)), next(nullptr) {}
+    };
+
+    static const int CACHE_LINE = 64;
+
+    alignas(CACHE_LINE) std::atomic<Node*> front;
+    alignas(CACHE_LINE) std::atomic<Node*> rear;
+
+    static void deleteNode(void* p) {
+        delete static_cast<Node*>(p);
+    }
+
+    // 把新节点挂到队尾
+    void link(Node* node) {
+        hazard::ThreadState& ts = hazard::threadState();
+        for (;;) {
+            Node* last = rear.load(std::memory_order_acquire);
+            ts.protect(0, last);
+            if (last != rear.load(std::memory_order_seq_cst)) {
+                continue;
+            }
+            Node* next = last->next.load(std::memory_order_acquire);
+            if (last != rear.load(std::memory_order_acquire)) {
+                continue;
+            }
+            if (next != nullptr) {
+                // rear 落后了，帮助其他线程推进
+                rear.compare_exchange_weak(last, next, std::memory_order_release,
+                                           std::memory_order_relaxed);
+                continue;
+            }
+            if (last->next.compare_exchange_weak(next, node, std::memory_order_release,
+                                                 std::memory_order_relaxed)) {
+                rear.compare_exchange_strong(last, node, std::memory_order_release,
+                                             std::memory_order_relaxed);
+                break;
+            }
+        }
+        ts.clear(0);
+    }
+
+public:
+    // 构造函数
+    ConcurrentLinkedQueue() {
+        Node* dummy = new Node;
+        front.store(dummy, std::memory_order_relaxed);
+        rear.store(dummy, std::memory_order_relaxed);
+    }
+
+    // 析构函数，调用时不能有其他线程访问队列
+    ~ConcurrentLinkedQueue() {
+        Node* p = front.load(std::memory_order_relaxed);
+        while (p != nullptr) {
+            Node* next = p->next.load(std::memory_order_relaxed);
+            delete p;
+            p = next;
+        }
+    }
+
+    // 禁止拷贝
+    ConcurrentLinkedQueue(const ConcurrentLinkedQueue&) = delete;
+    ConcurrentLinkedQueue& operator=(const ConcurrentLinkedQueue&) = delete;
+
+    // 入队操作
+    void enQueue(const T& e) {
+        link(new Node(e));
+    }
+
+    // 移动入队
+    void enQueue(T&& e) {
+        link(new Node(std::move(e)));
+    }
+
+    // 出队操作，队空返回 false
+    bool deQueue(T& e) {
+        hazard::ThreadState& ts = hazard::threadState();
+        for (;;) {
+            Node* first = front.load(std::memory_order_acquire);
+            ts.protect(0, first);
+            if (first != front.load(std::memory_order_seq_cst)) {
+                continue;
+            }
+            Node* last = rear.load(std::memory_order_acquire);
+            Node* next = first->next.load(std::memory_order_acquire);
+            ts.protect(1, next);
+            if (first != front.load(std::memory_order_seq_cst)) {
+                continue;
+            }
+            if (next == nullptr) {
+                ts.clear(0);
+                ts.clear(1);
+                return false;
+            }
+            if (first == last) {
+                // 队尾指针落后，先帮忙推进
+                rear.compare_exchange_weak(last, next, std::memory_order_release,
+                                           std::memory_order_relaxed);
+                continue;
+            }
+            if (front.compare_exchange_weak(first, next, std::memory_order_acq_rel,
+                                            std::memory_order_relaxed)) {
+                // next 成为新的头结点，它的数据只有赢得 CAS 的线程会读取
+                e = std::move(next->data);
+                ts.clear(0);
+                ts.clear(1);
+                ts.retire(first, &ConcurrentLinkedQueue::deleteNode);
+                return true;
+            }
+        }
+    }
+
+    // 检查队列是否为空（并发时为瞬时快照）
+    bool isEmpty() const {
+        hazard::ThreadState& ts = hazard::threadState();
+        Node* first;
+        do {
+            first = front.load(std::memory_order_acquire);
+            ts.protect(0, first);
+        } while (first != front.load(std::memory_order_seq_cst));
+        bool result = first->next.load(std::memory_order_acquire) == nullptr;
+        ts.clear(0);
+        return result;
+    }
+
+    // 立即尝试释放本线程积压的已出队节点
+    static void collect() {
+        hazard::threadState().collect();
+    }
+};
+
+#endif // CONCURRENT_LINKED_QUEUE_HPP
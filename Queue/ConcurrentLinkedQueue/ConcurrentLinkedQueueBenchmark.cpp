@@ -0,0 +1,81 @@
+#include <iostream>
+#include <iomanip>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "ConcurrentLinkedQueue.hpp"
+#include "../LinkedQueue/LinkedQueue.hpp"
+
+// 竞争测试：t 个线程（t = 1, 2, 4, ... N）各自反复执行"入队 + 出队"，
+// 对比 ConcurrentLinkedQueue 与 "LinkedQueue + std::mutex" 的总吞吐量。
+// 用法：./ConcurrentLinkedQueueBenchmark [最大线程数 N] [每线程操作对数]
+
+typedef std::chrono::steady_clock Clock;
+
+template<typename T>
+class LockedLinkedQueue {
+private:
+    LinkedQueue<T> queue;
+    std::mutex mtx;
+
+public:
+    void enQueue(const T& e) {
+        std::lock_guard<std::mutex> lock(mtx);
+        queue.enQueue(e);
+    }
+
+    bool deQueue(T& e) {
+        std::lock_guard<std::mutex> lock(mtx);
+        return queue.deQueue(e);
+    }
+};
+
+template<typename Queue>
+double run(int threads, long long pairsPerThread) {
+    Queue queue;
+    // 预先放入一些元素，避免出队总是看到空队列
+    for (int i = 0; i < 1024; ++i) {
+        queue.enQueue(i);
+    }
+    std::atomic<bool> go(false);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.push_back(std::thread([&queue, &go, pairsPerThread]() {
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            long long value;
+            for (long long i = 0; i < pairsPerThread; ++i) {
+                queue.enQueue(i);
+                queue.deQueue(value);
+            }
+        }));
+    }
+    Clock::time_point start = Clock::now();
+    go.store(true);
+    for (size_t i = 0; i < workers.size(); ++i) {
+        workers[i].join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return 2.0 * pairsPerThread * threads / seconds / 1e6;
+}
+
+int main(int argc, char* argv[]) {
+    int hw = static_cast<int>(std::thread::hardware_concurrency());
+    int maxThreads = argc > 1 ? std::atoi(argv[1]) : (hw > 0 ? hw : 4);
+    long long pairs = argc > 2 ? std::atoll(argv[2]) : 1000000LL;
+
+    std::cout << pairs << " enQueue+deQueue pairs per thread, total Mops/s" << std::endl;
+    std::cout << std::setw(10) << "threads" << std::setw(24) << "ConcurrentLinkedQueue"
+              << std::setw(24) << "LinkedQueue + mutex" << std::endl;
+    for (int t = 1; t <= maxThreads; t *= 2) {
+        double lockFree = run<ConcurrentLinkedQueue<long long>>(t, pairs);
+        double locked = run<LockedLinkedQueue<long long>>(t, pairs);
+        std::cout << std::setw(10) << t << std::setw(24) << std::fixed << std::setprecision(2)
+                  << lockFree << std::setw(24) << locked << std::endl;
+    }
+    return 0;
+}
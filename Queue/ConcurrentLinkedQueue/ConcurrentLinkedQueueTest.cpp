@@ -0,0 +1,145 @@
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include "ConcurrentLinkedQueue.hpp"
+
+// 统计存活对象个数，用于检查节点是否全部被回收
+struct Counted {
+    static std::atomic<int> alive;
+    int value;
+
+    Counted() : value(0) { alive.fetch_add(1); }
+    explicit Counted(int v) : value(v) { alive.fetch_add(1); }
+    Counted(const Counted& other) : value(other.value) { alive.fetch_add(1); }
+    Counted& operator=(const Counted& other) { value = other.value; return *this; }
+    ~Counted() { alive.fetch_sub(1); }
+};
+std::atomic<int> Counted::alive(0);
+
+void testBasicOperations() {
+    std::cout << "Testing basic operations..." << std::endl;
+
+    ConcurrentLinkedQueue<int> queue;
+    assert(queue.isEmpty() && "New queue should be empty");
+
+    for (int i = 1; i <= 5; ++i) {
+        queue.enQueue(i);
+    }
+    assert(!queue.isEmpty() && "Queue should not be empty after enQueue");
+
+    int value;
+    for (int i = 1; i <= 5; ++i) {
+        assert(queue.deQueue(value) && "deQueue should succeed");
+        assert(value == i && "Values should be dequeued in FIFO order");
+    }
+    assert(!queue.deQueue(value) && "deQueue should fail on empty queue");
+    assert(queue.isEmpty() && "Queue should be empty after all deQueue operations");
+
+    ConcurrentLinkedQueue<std::string> strQueue;
+    std::string str = "moved";
+    strQueue.enQueue(std::move(str));
+    strQueue.enQueue("copied");
+    assert(strQueue.deQueue(str) && str == "moved" && "First string should be 'moved'");
+    assert(strQueue.deQueue(str) && str == "copied" && "Second string should be 'copied'");
+
+    std::cout << "Basic operations tests passed!" << std::endl;
+}
+
+// 多生产者多消费者压力测试：每个值恰好被取出一次，且每个生产者的元素保持先进先出
+void testConcurrent(int producers, int consumers) {
+    std::cout << "Testing " << producers << " producers / " << consumers << " consumers..." << std::endl;
+
+    const int perProducer = 20000;
+    const int total = producers * perProducer;
+    ConcurrentLinkedQueue<int> queue;
+    std::vector<std::atomic<int>> seen(total);
+    for (int i = 0; i < total; ++i) {
+        seen[i].store(0);
+    }
+    std::atomic<int> consumed(0);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.push_back(std::thread([&queue, p, perProducer]() {
+            for (int i = 0; i < perProducer; ++i) {
+                queue.enQueue(p * perProducer + i);
+            }
+        }));
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.push_back(std::thread([&queue, &seen, &consumed, producers, perProducer, total]() {
+            std::vector<int> lastFrom(producers, -1);
+            int v;
+            while (consumed.load() < total) {
+                if (!queue.deQueue(v)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                int from = v / perProducer;
+                assert(v > lastFrom[from] && "Elements from one producer must stay in order");
+                lastFrom[from] = v;
+                seen[v].fetch_add(1);
+                consumed.fetch_add(1);
+            }
+        }));
+    }
+    for (size_t i = 0; i < threads.size(); ++i) {
+        threads[i].join();
+    }
+
+    assert(queue.isEmpty() && "Queue should be empty after all elements are consumed");
+    for (int i = 0; i < total; ++i) {
+        assert(seen[i].load() == 1 && "Every element should be dequeued exactly once");
+    }
+
+    std::cout << "Concurrent tests passed!" << std::endl;
+}
+
+// 出队的节点最终都会被回收
+void testReclamation() {
+    std::cout << "Testing memory reclamation..." << std::endl;
+
+    {
+        ConcurrentLinkedQueue<Counted> queue;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.push_back(std::thread([&queue, t]() {
+                Counted c;
+                for (int i = 0; i < 5000; ++i) {
+                    queue.enQueue(Counted(t * 5000 + i));
+                    queue.deQueue(c);
+                }
+            }));
+        }
+        for (size_t i = 0; i < threads.size(); ++i) {
+            threads[i].join();
+        }
+        Counted c;
+        while (queue.deQueue(c)) {
+        }
+    }
+    // 已退出线程遗留的节点会在下一次扫描时被接手并释放
+    ConcurrentLinkedQueue<Counted>::collect();
+    assert(Counted::alive.load() == 0 && "All retired nodes should be reclaimed");
+
+    std::cout << "Memory reclamation tests passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testBasicOperations();
+        testConcurrent(1, 1);
+        testConcurrent(4, 4);
+        testConcurrent(2, 6);
+        testReclamation();
+
+        std::cout << "\nAll tests passed successfully!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,199 @@
+#ifndef HAZARD_POINTER_HPP
+#define HAZARD_POINTER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+// 危险指针（Hazard Pointer）内存回收
+// 线程在解引用共享节点之前，先把节点地址发布到自己的危险指针槽位中；
+// 节点被摘除后不会立即释放，而是放入本线程的待回收列表（retire），
+// 待回收列表积累到一定数量后扫描所有线程的危险指针，只释放没有被任何线程保护的节点。
+namespace hazard {
+
+const int SLOTS_PER_THREAD = 2;
+
+// 每个线程占用一条记录，记录在线程退出后被标记为空闲供其他线程复用
+struct Record {
+    std::atomic<const void*> hp[SLOTS_PER_THREAD];
+    std::atomic<bool> active;
+    Record* next;
+
+    Record() : active(true), next(nullptr) {
+        for (int i = 0; i < SLOTS_PER_THREAD; ++i) {
+            hp[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+};
+
+// 待回收节点及其释放函数
+struct Retired {
+    void* ptr;
+    void (*deleter)(void*);
+};
+
+class Domain {
+private:
+    std::atomic<Record*> head;
+    std::atomic<int> recordCount;
+    std::mutex orphanMutex;
+    std::vector<Retired> orphans;   // 已退出线程遗留、暂时无法释放的节点
+
+public:
+    Domain() : head(nullptr), recordCount(0) {}
+
+    ~Domain() {
+        // 程序退出时不再有线程访问节点，全部释放
+        for (size_t i = 0; i < orphans.size(); ++i) {
+            orphans[i].deleter(orphans[i].ptr);
+        }
+        Record* r = head.load();
+        while (r != nullptr) {
+            Record* next = r->next;
+            delete r;
+            r = next;
+        }
+    }
+
+    Domain(const Domain&) = delete;
+    Domain& operator=(const Domain&) = delete;
+
+    // 获取一条空闲记录，没有则新建并挂到链表头部
+    Record* acquire() {
+        for (Record* r = head.load(std::memory_order_acquire); r != nullptr; r = r->next) {
+            bool expected = false;
+            if (!r->active.load(std::memory_order_relaxed) &&
+                r->active.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                return r;
+            }
+        }
+        Record* r = new Record;
+        Record* old = head.load(std::memory_order_relaxed);
+        do {
+            r->next = old;
+        } while (!head.compare_exchange_weak(old, r, std::memory_order_release,
+                                             std::memory_order_relaxed));
+        recordCount.fetch_add(1, std::memory_order_relaxed);
+        return r;
+    }
+
+    void release(Record* r) {
+        for (int i = 0; i < SLOTS_PER_THREAD; ++i) {
+            r->hp[i].store(nullptr, std::memory_order_release);
+        }
+        r->active.store(false, std::memory_order_release);
+    }
+
+    // 触发扫描的阈值，与危险指针总数成正比，保证回收的均摊代价为 O(1)
+    size_t threshold() const {
+        return static_cast<size_t>(2 * SLOTS_PER_THREAD * recordCount.load(std::memory_order_relaxed) + 16);
+    }
+
+    // 释放 list 中未被保护的节点，被保护的节点保留在 list 中
+    void scan(std::vector<Retired>& list) {
+        // 顺带接手已退出线程遗留的节点
+        {
+            std::unique_lock<std::mutex> lock(orphanMutex, std::try_to_lock);
+            if (lock.owns_lock() && !orphans.empty()) {
+                list.insert(list.end(), orphans.begin(), orphans.end());
+                orphans.clear();
+            }
+        }
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::vector<const void*> protectedPtrs;
+        for (Record* r = head.load(std::memory_order_acquire); r != nullptr; r = r->next) {
+            for (int i = 0; i < SLOTS_PER_THREAD; ++i) {
+                const void* p = r->hp[i].load(std::memory_order_seq_cst);
+                if (p != nullptr) {
+                    protectedPtrs.push_back(p);
+                }
+            }
+        }
+        std::sort(protectedPtrs.begin(), protectedPtrs.end());
+
+        size_t kept = 0;
+        for (size_t i = 0; i < list.size(); ++i) {
+            if (std::binary_search(protectedPtrs.begin(), protectedPtrs.end(),
+                                   static_cast<const void*>(list[i].ptr))) {
+                list[kept++] = list[i];
+            } else {
+                list[i].deleter(list[i].ptr);
+            }
+        }
+        list.resize(kept);
+    }
+
+    // 线程退出时移交无法立即释放的节点
+    void adopt(std::vector<Retired>& list) {
+        std::lock_guard<std::mutex> lock(orphanMutex);
+        orphans.insert(orphans.end(), list.begin(), list.end());
+        list.clear();
+    }
+};
+
+inline Domain& defaultDomain() {
+    static Domain domain;
+    return domain;
+}
+
+// 线程本地状态：本线程的危险指针记录和待回收列表
+class ThreadState {
+private:
+    Domain& domain;
+    Record* record;
+    std::vector<Retired> retired;
+
+public:
+    ThreadState() : domain(defaultDomain()), record(domain.acquire()) {}
+
+    ~ThreadState() {
+        domain.release(record);
+        domain.scan(retired);
+        if (!retired.empty()) {
+            domain.adopt(retired);
+        }
+    }
+
+    ThreadState(const ThreadState&) = delete;
+    ThreadState& operator=(const ThreadState&) = delete;
+
+    // 发布危险指针。调用方发布后必须重新读取来源以确认节点仍然可达
+    void protect(int slot, const void* p) {
+        record->hp[slot].store(p, std::memory_order_seq_cst);
+    }
+
+    void clear(int slot) {
+        record->hp[slot].store(nullptr, std::memory_order_release);
+    }
+
+    void retire(void* p, void (*deleter)(void*)) {
+        Retired r;
+        r.ptr = p;
+        r.deleter = deleter;
+        retired.push_back(r);
+        if (retired.size() >= domain.threshold()) {
+            domain.scan(retired);
+        }
+    }
+
+    // 立即扫描一次本线程的待回收列表
+    void collect() {
+        domain.scan(retired);
+    }
+
+    size_t pendingCount() const {
+        return retired.size();
+    }
+};
+
+inline ThreadState& threadState() {
+    static thread_local ThreadState state;
+    return state;
+}
+
+} // namespace hazard
+
+#endif // HAZARD_POINTER_HPP
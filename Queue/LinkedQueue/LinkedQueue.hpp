@@ -3,6 +3,9 @@
 
 #include <iostream>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "../../Allocator/NodeAllocator/NodeAllocator.hpp"
 
 template<typename T>
 struct Node {
@@ -11,16 +14,40 @@ struct Node {
     Node(const T& d = T(), Node<T>* n = nullptr) : data(d), next(n) {}
 };
 
-template<typename T>
+// Alloc 为节点分配策略，见 Allocator/NodeAllocator/NodeAllocator.hpp
+template<typename T, typename Alloc = NewDeleteAllocator<Node<T>>>
 class LinkedQueue {
 private:
     Node<T> *front, *rear;
     int size;
+    Alloc alloc;
+
+    // 节点能否交给另一个队列的分配器回收
+    typedef std::integral_constant<bool, NodeAllocatorTraits<Alloc>::interchangeable> ShareTag;
+
+    // 节点可以共享：复制到临时队列再交换，复制失败时本队列保持不变
+    void assign(const LinkedQueue& other, std::true_type) {
+        LinkedQueue temp(other);
+        std::swap(front, temp.front);
+        std::swap(rear, temp.rear);
+        std::swap(size, temp.size);
+    }
+
+    // 节点只能由各自的分配器回收：先清空再逐个复制，被清空的节点会被本队列的分配器复用。
+    // 复制中途抛出异常时本队列只含已复制的前一部分元素
+    void assign(const LinkedQueue& other, std::false_type) {
+        clear();
+        Node<T>* p = other.front->next;
+        while (p != nullptr) {
+            enQueue(p->data);
+            p = p->next;
+        }
+    }
 
 public:
     // 构造函数
     LinkedQueue() : size(0) {
-        front = new Node<T>;
+        front = alloc.create();
         front->next = nullptr;
         rear = front;
     }
@@ -28,7 +55,7 @@ public:
     // 析构函数
     ~LinkedQueue() {
         clear();
-        delete front;
+        alloc.destroy(front);
     }
 
     // 拷贝构造函数
@@ -43,10 +70,7 @@ public:
     // 赋值运算符
     LinkedQueue& operator=(const LinkedQueue& other) {
         if (this != &other) {
-            LinkedQueue temp(other);
-            std::swap(front, temp.front);
-            std::swap(rear, temp.rear);
-            std::swap(size, temp.size);
+            assign(other, ShareTag());
         }
         return *this;
     }
@@ -57,7 +81,7 @@ public:
         while (p != nullptr) {
             Node<T>* temp = p;
             p = p->next;
-            delete temp;
+            alloc.destroy(temp);
         }
         rear = front;
         front->next = nullptr;
@@ -76,7 +100,7 @@ public:
     
     // 入队操作
     void enQueue(const T& e) {
-        Node<T>* newNode = new Node<T>(e);
+        Node<T>* newNode = alloc.create(e);
         rear->next = newNode;
         rear = newNode;
         ++size;
@@ -93,7 +117,7 @@ public:
         if (temp == rear) {
             rear = front;
         }
-        delete temp;
+        alloc.destroy(temp);
         --size;
         return true;
     }
@@ -115,6 +139,11 @@ public:
         e = rear->data;
         return true;
     }
+
+    // 获取节点分配器（用于查看缓存状态等）
+    const Alloc& getAllocator() const {
+        return alloc;
+    }
 };
 
 #endif // LINKED_QUEUE_HPP
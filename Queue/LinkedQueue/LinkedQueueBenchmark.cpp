@@ -0,0 +1,111 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include "LinkedQueue.hpp"
+
+// 对比 LinkedQueue 各节点分配策略的耗时（ns/op）和系统分配次数（operator new 调用次数）。
+// 场景：
+//   churn：队列保持约 1000 个元素，反复入队/出队（消息队列稳定状态）
+//   burst：一次性入队 n 个元素再全部出队，重复多轮（突发流量）
+// 用法：./LinkedQueueBenchmark [操作次数]（默认 10^7）
+
+static long long allocationCount = 0;
+static volatile long long sink = 0;  // 防止编译器优化掉出队结果
+
+void* operator new(size_t size) {
+    ++allocationCount;
+    void* p = std::malloc(size);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+typedef std::chrono::steady_clock Clock;
+
+template<typename Queue>
+void churn(const char* name, long long ops) {
+    Queue queue;
+    for (int i = 0; i < 1000; ++i) {
+        queue.enQueue(i);
+    }
+    long long allocBefore = allocationCount;
+    Clock::time_point start = Clock::now();
+    long long value = 0;
+    long long sum = 0;
+    for (long long i = 0; i < ops; ++i) {
+        queue.enQueue(i);
+        queue.deQueue(value);
+        sum += value;
+    }
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    long long allocs = allocationCount - allocBefore;
+    std::cout << std::setw(16) << name << std::setw(14) << std::fixed << std::setprecision(2)
+              << ns / ops << std::setw(18) << static_cast<double>(allocs) / ops << std::endl;
+    sink = sum;
+}
+
+template<typename Queue>
+void burst(const char* name, long long ops, long long burstSize) {
+    Queue queue;
+    long long rounds = ops / burstSize;
+    long long allocBefore = allocationCount;
+    Clock::time_point start = Clock::now();
+    long long value;
+    for (long long r = 0; r < rounds; ++r) {
+        for (long long i = 0; i < burstSize; ++i) {
+            queue.enQueue(i);
+        }
+        while (queue.deQueue(value)) {
+        }
+    }
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    long long allocs = allocationCount - allocBefore;
+    long long total = rounds * burstSize;
+    std::cout << std::setw(16) << name << std::setw(14) << std::fixed << std::setprecision(2)
+              << ns / total << std::setw(18) << static_cast<double>(allocs) / total << std::endl;
+}
+
+template<template<typename> class Runner>
+void runAll(long long ops) {
+    Runner<LinkedQueue<long long>>::run("new/delete", ops);
+    Runner<LinkedQueue<long long, FreeListAllocator<Node<long long>>>>::run("free list", ops);
+    Runner<LinkedQueue<long long, SlabAllocator<Node<long long>, 256>>>::run("slab(256)", ops);
+    Runner<LinkedQueue<long long, ThreadCacheAllocator<Node<long long>>>>::run("thread cache", ops);
+}
+
+template<typename Queue>
+struct ChurnRunner {
+    static void run(const char* name, long long ops) { churn<Queue>(name, ops); }
+};
+
+template<typename Queue>
+struct BurstRunner {
+    static void run(const char* name, long long ops) { burst<Queue>(name, ops, 100000); }
+};
+
+int main(int argc, char* argv[]) {
+    long long ops = argc > 1 ? std::atoll(argv[1]) : 10000000LL;
+
+    std::cout << "churn: " << ops << " enQueue+deQueue pairs, ~1000 elements resident" << std::endl;
+    std::cout << std::setw(16) << "allocator" << std::setw(14) << "ns/op"
+              << std::setw(18) << "allocs/op" << std::endl;
+    runAll<ChurnRunner>(ops);
+
+    std::cout << "\nburst: rounds of 10^5 enQueue followed by draining the queue" << std::endl;
+    std::cout << std::setw(16) << "allocator" << std::setw(14) << "ns/op"
+              << std::setw(18) << "allocs/op" << std::endl;
+    runAll<BurstRunner>(ops);
+    return 0;
+}
@@ -2,6 +2,7 @@
 #include <cassert>
 #include <string>
 #include <iostream>
+#include <stdexcept>
 
 void testBasicOperations() {
     std::cout << "Testing basic operations..." << std::endl;
@@ -117,6 +118,63 @@ void testCopyAndAssignment() {
     std::cout << "Copy constructor and assignment operator tests passed!" << std::endl;
 }
 
+// 复制次数用完后拷贝构造抛出异常的元素，copiesLeft < 0 表示不限
+struct CopyLimited {
+    static int copiesLeft;
+    int value;
+
+    CopyLimited(int v = 0) : value(v) {}
+
+    CopyLimited(const CopyLimited& other) : value(other.value) {
+        if (copiesLeft == 0) {
+            throw std::runtime_error("copy failed");
+        }
+        if (copiesLeft > 0) {
+            --copiesLeft;
+        }
+    }
+
+    CopyLimited& operator=(const CopyLimited&) = default;
+};
+
+int CopyLimited::copiesLeft = -1;
+
+// 节点可以共享的分配策略下，赋值时复制失败不改变目标队列
+template<typename Queue>
+void checkStrongAssignment() {
+    Queue source, target;
+    for (int i = 1; i <= 5; ++i) {
+        source.enQueue(CopyLimited(i));
+    }
+    target.enQueue(CopyLimited(7));
+    target.enQueue(CopyLimited(8));
+
+    CopyLimited::copiesLeft = 3;
+    bool thrown = false;
+    try {
+        target = source;
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    CopyLimited::copiesLeft = -1;
+    assert(thrown && "Assignment should propagate the exception");
+
+    CopyLimited value;
+    assert(target.length() == 2 && "Failed assignment should not change the length");
+    assert(target.deQueue(value) && value.value == 7 && "Failed assignment should keep the old elements");
+    assert(target.deQueue(value) && value.value == 8 && "Failed assignment should keep the old elements");
+    assert(target.isEmpty() && "Failed assignment should not add elements");
+}
+
+void testAssignmentExceptionSafety() {
+    std::cout << "Testing exception safety of assignment..." << std::endl;
+
+    checkStrongAssignment<LinkedQueue<CopyLimited>>();
+    checkStrongAssignment<LinkedQueue<CopyLimited, ThreadCacheAllocator<Node<CopyLimited>>>>();
+
+    std::cout << "Assignment exception safety tests passed!" << std::endl;
+}
+
 void testClearOperation() {
     std::cout << "Testing clear operation..." << std::endl;
     
@@ -141,12 +199,97 @@ void testClearOperation() {
     std::cout << "Clear operation tests passed!" << std::endl;
 }
 
+// 对不同的节点分配策略运行同一组入队/出队操作
+template<typename Queue>
+void runAllocatorScenario() {
+    Queue queue;
+    int value;
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 1000; ++i) {
+            queue.enQueue(i);
+        }
+        assert(queue.length() == 1000 && "Queue should have 1000 elements");
+        for (int i = 0; i < 600; ++i) {
+            assert(queue.deQueue(value) && value == i && "Values should be dequeued in FIFO order");
+        }
+        queue.clear();
+        assert(queue.isEmpty() && "Queue should be empty after clear");
+    }
+
+    Queue copied;
+    copied.enQueue(42);
+    for (int i = 1; i <= 3; ++i) {
+        queue.enQueue(i);
+    }
+    copied = queue;
+    assert(copied.length() == 3 && "Assigned queue should have same length");
+    Queue constructed(copied);
+    for (int i = 1; i <= 3; ++i) {
+        assert(constructed.deQueue(value) && value == i && "Copied values should match");
+    }
+}
+
+// 静态队列在程序退出时析构，此时主线程的缓存已经析构
+static LinkedQueue<std::string, ThreadCacheAllocator<Node<std::string>>> staticQueue;
+
+void testAllocators() {
+    std::cout << "Testing node allocators..." << std::endl;
+
+    runAllocatorScenario<LinkedQueue<int>>();
+    runAllocatorScenario<LinkedQueue<int, FreeListAllocator<Node<int>>>>();
+    runAllocatorScenario<LinkedQueue<int, SlabAllocator<Node<int>, 64>>>();
+    runAllocatorScenario<LinkedQueue<int, ThreadCacheAllocator<Node<int>>>>();
+
+    for (int i = 0; i < 100; ++i) {
+        staticQueue.enQueue(std::string(32, 'a'));
+    }
+
+    // 非平凡类型的节点同样需要正确析构
+    LinkedQueue<std::string, SlabAllocator<Node<std::string>, 4>> stringQueue;
+    for (int i = 0; i < 10; ++i) {
+        stringQueue.enQueue(std::string(32, 'a' + i));
+    }
+    std::string str;
+    assert(stringQueue.deQueue(str) && str == std::string(32, 'a') && "String should survive slab storage");
+
+    // 空闲链表：出队的节点被缓存并在下次入队时复用
+    LinkedQueue<int, FreeListAllocator<Node<int>>> freeListQueue;
+    for (int i = 0; i < 10; ++i) {
+        freeListQueue.enQueue(i);
+    }
+    int value;
+    for (int i = 0; i < 10; ++i) {
+        freeListQueue.deQueue(value);
+    }
+    assert(freeListQueue.getAllocator().cachedCount() == 10 && "Dequeued nodes should be cached");
+    for (int i = 0; i < 4; ++i) {
+        freeListQueue.enQueue(i);
+    }
+    assert(freeListQueue.getAllocator().cachedCount() == 6 && "Cached nodes should be reused");
+
+    // 分块：稳定状态下反复入队出队不会申请新的内存块
+    LinkedQueue<int, SlabAllocator<Node<int>, 16>> slabQueue;
+    for (int i = 0; i < 10; ++i) {
+        slabQueue.enQueue(i);
+    }
+    size_t chunks = slabQueue.getAllocator().chunksAllocated();
+    for (int i = 0; i < 10000; ++i) {
+        slabQueue.enQueue(i);
+        slabQueue.deQueue(value);
+    }
+    assert(slabQueue.getAllocator().chunksAllocated() == chunks && "Steady state should not allocate");
+
+    std::cout << "Node allocator tests passed!" << std::endl;
+}
+
 int main() {
     try {
         testBasicOperations();
         testStringQueue();
         testCopyAndAssignment();
+        testAssignmentExceptionSafety();
         testClearOperation();
+        testAllocators();
         
         std::cout << "\nAll tests passed successfully!" << std::endl;
         return 0;
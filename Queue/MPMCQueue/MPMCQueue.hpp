@@ -0,0 +1,280 @@
+#ifndef MPMCQUEUE_HPP
+#define MPMCQUEUE_HPP
+
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#endif
+
+// 等待/唤醒计数器（event count）
+// 等待方先 prepareWait 取得当前纪元，再重新检查条件，条件仍不满足时才 wait；
+// 通知方在发布数据后调用 notifyAll，只有存在等待者时才会进入内核。
+// Linux 下基于 futex，其他平台退化为互斥锁 + 条件变量。
+class EventCount {
+private:
+    std::atomic<uint32_t> epoch;
+    std::atomic<int> waiters;
+#ifndef __linux__
+    std::mutex mtx;
+    std::condition_variable cv;
+#endif
+
+public:
+    EventCount() : epoch(0), waiters(0) {}
+
+    EventCount(const EventCount&) = delete;
+    EventCount& operator=(const EventCount&) = delete;
+
+    // 登记为等待者并返回当前纪元
+    uint32_t prepareWait() {
+        waiters.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return epoch.load(std::memory_order_seq_cst);
+    }
+
+    // 条件已满足，放弃等待
+    void cancelWait() {
+        waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // 若纪元未变化则挂起当前线程
+    void wait(uint32_t key) {
+#ifdef __linux__
+        while (epoch.load(std::memory_order_acquire) == key) {
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch),
+                    FUTEX_WAIT_PRIVATE, key, nullptr, nullptr, 0);
+        }
+#else
+        std::unique_lock<std::mutex> lock(mtx);
+        while (epoch.load(std::memory_order_acquire) == key) {
+            cv.wait_for(lock, std::chrono::milliseconds(1));
+        }
+#endif
+        waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // 唤醒全部等待者
+    void notifyAll() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters.load(std::memory_order_seq_cst) == 0) {
+            return;
+        }
+        epoch.fetch_add(1, std::memory_order_seq_cst);
+#ifdef __linux__
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch),
+                FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#else
+        std::lock_guard<std::mutex> lock(mtx);
+        cv.notify_all();
+#endif
+    }
+};
+
+// 多生产者/多消费者（MPMC）有界队列
+// 沿用 SeqQueue 的循环数组布局，每个槽位附带一个序号（Dmitry Vyukov 的有界队列算法）：
+// - 槽位序号 == 入队位置 pos：槽位空闲，生产者可通过 CAS 抢占 pos
+// - 槽位序号 == pos + 1：槽位已写入，消费者可通过 CAS 抢占 pos
+// 生产者之间、消费者之间只在各自的位置计数器上竞争，两端互不干扰。
+template<typename T>
+class MPMCQueue {
+private:
+    static const size_t CACHE_LINE = 64;
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    Cell* buffer;
+    size_t mask;
+    size_t maxLen;
+    int spinLimit;     // 阻塞接口在挂起前的自旋次数
+    bool parking;      // 自旋失败后是否挂起线程（否则一直 yield）
+
+    alignas(CACHE_LINE) std::atomic<size_t> enqueuePos;
+    alignas(CACHE_LINE) std::atomic<size_t> dequeuePos;
+    alignas(CACHE_LINE) std::atomic<bool> closed;
+    EventCount notEmpty;
+    EventCount notFull;
+
+    static size_t roundUpPow2(size_t n) {
+        size_t cap = 2;
+        while (cap < n) {
+            cap <<= 1;
+        }
+        return cap;
+    }
+
+    // 阻塞等待：先自旋，再 yield，最后在 EventCount 上挂起
+    template<typename TryOp>
+    bool waitFor(TryOp tryOp, EventCount& event) {
+        for (int i = 0; i < spinLimit; ++i) {
+            if (tryOp()) {
+                return true;
+            }
+            if (closed.load(std::memory_order_acquire)) {
+                return tryOp();
+            }
+            if (i > spinLimit / 2) {
+                std::this_thread::yield();
+            }
+        }
+        for (;;) {
+            if (!parking) {
+                if (tryOp()) {
+                    return true;
+                }
+                if (closed.load(std::memory_order_acquire)) {
+                    return tryOp();
+                }
+                std::this_thread::yield();
+                continue;
+            }
+            uint32_t key = event.prepareWait();
+            if (tryOp()) {
+                event.cancelWait();
+                return true;
+            }
+            if (closed.load(std::memory_order_acquire)) {
+                event.cancelWait();
+                return tryOp();
+            }
+            event.wait(key);
+        }
+    }
+
+public:
+    // 构造函数，容量向上取整为 2 的幂（至少为 2）
+    explicit MPMCQueue(int len, int spin = 128, bool park = true)
+        : spinLimit(spin), parking(park), enqueuePos(0), dequeuePos(0), closed(false) {
+        if (len <= 0) {
+            throw std::invalid_argument("Queue size must be positive");
+        }
+        maxLen = roundUpPow2(static_cast<size_t>(len));
+        mask = maxLen - 1;
+        buffer = new Cell[maxLen];
+        for (size_t i = 0; i < maxLen; ++i) {
+            buffer[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // 析构函数
+    ~MPMCQueue() {
+        delete[] buffer;
+    }
+
+    // 禁止拷贝
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    // 非阻塞入队，队满返回 false
+    bool tryEnQueue(const T& e) {
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &buffer[pos & mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->data = e;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        if (parking) {
+            notEmpty.notifyAll();
+        }
+        return true;
+    }
+
+    // 非阻塞出队，队空返回 false
+    bool tryDeQueue(T& e) {
+        size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &buffer[pos & mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        e = std::move(cell->data);
+        cell->sequence.store(pos + maxLen, std::memory_order_release);
+        if (parking) {
+            notFull.notifyAll();
+        }
+        return true;
+    }
+
+    // 阻塞入队，队列已关闭时返回 false
+    bool enQueue(const T& e) {
+        if (closed.load(std::memory_order_acquire)) {
+            return false;
+        }
+        return waitFor([this, &e]() {
+            return !closed.load(std::memory_order_acquire) && tryEnQueue(e);
+        }, notFull);
+    }
+
+    // 阻塞出队，队列已关闭且为空时返回 false
+    bool deQueue(T& e) {
+        return waitFor([this, &e]() { return tryDeQueue(e); }, notEmpty);
+    }
+
+    // 关闭队列：之后的入队均失败，阻塞中的线程被唤醒，消费者可继续取完剩余元素
+    void close() {
+        closed.store(true, std::memory_order_release);
+        notEmpty.notifyAll();
+        notFull.notifyAll();
+    }
+
+    // 队列是否已关闭
+    bool isClosed() const {
+        return closed.load(std::memory_order_acquire);
+    }
+
+    // 检查队列是否为空（并发时为瞬时快照）
+    bool empty() const {
+        return len() == 0;
+    }
+
+    // 获取队列长度（并发时为瞬时快照）
+    int len() const {
+        size_t d = dequeuePos.load(std::memory_order_acquire);
+        size_t e = enqueuePos.load(std::memory_order_acquire);
+        return e > d ? static_cast<int>(e - d) : 0;
+    }
+
+    // 获取队列容量
+    int capacity() const {
+        return static_cast<int>(maxLen);
+    }
+};
+
+#endif // MPMCQUEUE_HPP
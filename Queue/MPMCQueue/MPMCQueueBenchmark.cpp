@@ -0,0 +1,115 @@
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "MPMCQueue.hpp"
+
+// MPMCQueue 的扩展性测试：t 个生产者 + t 个消费者（t = 1, 2, 4, ... N）共享一个队列，
+// 统计总吞吐量以及元素从入队到出队的延迟分位数。
+// 用法：./MPMCQueueBenchmark [最大线程数 N] [每轮元素总数]
+// 默认 N 为硬件线程数，元素总数为 4*10^6。
+
+typedef std::chrono::steady_clock Clock;
+
+static long long nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now().time_since_epoch()).count();
+}
+
+struct Result {
+    double mops;
+    long long p50;
+    long long p99;
+    long long p999;
+};
+
+static Result run(int threads, long long total, bool park) {
+    MPMCQueue<long long> queue(4096, 128, park);
+    long long perProducer = total / threads;
+    std::atomic<int> ready(0);
+    std::atomic<bool> go(false);
+    std::vector<std::vector<long long>> samples(threads);
+
+    std::vector<std::thread> workers;
+    for (int p = 0; p < threads; ++p) {
+        workers.push_back(std::thread([&queue, &ready, &go, perProducer]() {
+            ready.fetch_add(1);
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            for (long long i = 0; i < perProducer; ++i) {
+                queue.enQueue(nowNs());
+            }
+        }));
+    }
+    for (int c = 0; c < threads; ++c) {
+        workers.push_back(std::thread([&queue, &ready, &go, &samples, c]() {
+            std::vector<long long>& mine = samples[c];
+            ready.fetch_add(1);
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            long long ts;
+            long long n = 0;
+            while (queue.deQueue(ts)) {
+                // 每 16 个元素采样一次延迟，减少计时本身的开销
+                if ((n++ & 15) == 0) {
+                    mine.push_back(nowNs() - ts);
+                }
+            }
+        }));
+    }
+
+    while (ready.load() < 2 * threads) {
+        std::this_thread::yield();
+    }
+    Clock::time_point start = Clock::now();
+    go.store(true);
+    for (int p = 0; p < threads; ++p) {
+        workers[p].join();
+    }
+    queue.close();
+    for (int c = 0; c < threads; ++c) {
+        workers[threads + c].join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::vector<long long> all;
+    for (int c = 0; c < threads; ++c) {
+        all.insert(all.end(), samples[c].begin(), samples[c].end());
+    }
+    std::sort(all.begin(), all.end());
+    Result r;
+    r.mops = perProducer * threads / seconds / 1e6;
+    r.p50 = all.empty() ? 0 : all[all.size() / 2];
+    r.p99 = all.empty() ? 0 : all[all.size() * 99 / 100];
+    r.p999 = all.empty() ? 0 : all[all.size() * 999 / 1000];
+    return r;
+}
+
+int main(int argc, char* argv[]) {
+    int hw = static_cast<int>(std::thread::hardware_concurrency());
+    int maxThreads = argc > 1 ? std::atoi(argv[1]) : (hw > 0 ? hw : 4);
+    long long total = argc > 2 ? std::atoll(argv[2]) : 4000000LL;
+
+    for (int mode = 0; mode < 2; ++mode) {
+        bool park = mode == 0;
+        std::cout << (park ? "Spin-then-park" : "Spin/yield only") << " waiting, "
+                  << total << " items per round" << std::endl;
+        std::cout << std::setw(18) << "producers/consumers" << std::setw(12) << "Mops/s"
+                  << std::setw(12) << "p50(ns)" << std::setw(12) << "p99(ns)"
+                  << std::setw(14) << "p99.9(ns)" << std::endl;
+        for (int t = 1; t <= maxThreads; t *= 2) {
+            Result r = run(t, total, park);
+            std::cout << std::setw(18) << t << std::setw(12) << std::fixed << std::setprecision(2)
+                      << r.mops << std::setw(12) << r.p50 << std::setw(12) << r.p99
+                      << std::setw(14) << r.p999 << std::endl;
+        }
+        std::cout << std::endl;
+    }
+    return 0;
+}
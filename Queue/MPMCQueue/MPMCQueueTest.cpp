@@ -0,0 +1,157 @@
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include "MPMCQueue.hpp"
+
+void testBasicOperations() {
+    std::cout << "Testing basic operations..." << std::endl;
+
+    MPMCQueue<int> queue(3);
+    assert(queue.capacity() == 4);  // 容量向上取整为 2 的幂
+    assert(queue.empty());
+
+    for (int i = 1; i <= 4; ++i) {
+        assert(queue.tryEnQueue(i));
+    }
+    assert(!queue.tryEnQueue(5));  // 队列已满
+    assert(queue.len() == 4);
+
+    int value;
+    for (int i = 1; i <= 4; ++i) {
+        assert(queue.tryDeQueue(value));
+        assert(value == i);
+    }
+    assert(!queue.tryDeQueue(value));  // 队列为空
+    assert(queue.empty());
+
+    // 绕圈使用
+    MPMCQueue<std::string> strQueue(2);
+    std::string str;
+    for (int round = 0; round < 10; ++round) {
+        assert(strQueue.enQueue("x" + std::to_string(round)));
+        assert(strQueue.deQueue(str));
+        assert(str == "x" + std::to_string(round));
+    }
+
+    std::cout << "Basic operations tests passed!" << std::endl;
+}
+
+void testClose() {
+    std::cout << "Testing close..." << std::endl;
+
+    MPMCQueue<int> queue(4);
+    assert(queue.enQueue(1));
+    assert(queue.enQueue(2));
+    queue.close();
+    assert(queue.isClosed());
+    assert(!queue.enQueue(3));  // 关闭后不能入队
+
+    // 关闭后仍可取出剩余元素
+    int value;
+    assert(queue.deQueue(value) && value == 1);
+    assert(queue.deQueue(value) && value == 2);
+    assert(!queue.deQueue(value));
+
+    // 阻塞中的消费者会被 close 唤醒
+    MPMCQueue<int> waiting(4);
+    std::atomic<bool> returned(false);
+    std::thread consumer([&waiting, &returned]() {
+        int v;
+        assert(!waiting.deQueue(v));
+        returned.store(true);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    waiting.close();
+    consumer.join();
+    assert(returned.load());
+
+    std::cout << "Close tests passed!" << std::endl;
+}
+
+// 多生产者多消费者：每个值恰好被取出一次
+void testConcurrent(int producers, int consumers, bool park) {
+    std::cout << "Testing " << producers << " producers / " << consumers
+              << " consumers" << (park ? " (parking)" : " (spinning)") << "..." << std::endl;
+
+    const int perProducer = 20000;
+    const int total = producers * perProducer;
+    MPMCQueue<int> queue(64, 16, park);
+    std::vector<std::atomic<int>> seen(total);
+    for (int i = 0; i < total; ++i) {
+        seen[i].store(0);
+    }
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.push_back(std::thread([&queue, p, perProducer]() {
+            for (int i = 0; i < perProducer; ++i) {
+                int v = p * perProducer + i;
+                if (i % 2 == 0) {
+                    assert(queue.enQueue(v));
+                } else {
+                    while (!queue.tryEnQueue(v)) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        }));
+    }
+
+    std::atomic<int> consumed(0);
+    std::vector<std::thread> consumerThreads;
+    for (int c = 0; c < consumers; ++c) {
+        consumerThreads.push_back(std::thread([&queue, &seen, &consumed]() {
+            int v;
+            while (queue.deQueue(v)) {
+                seen[v].fetch_add(1);
+                consumed.fetch_add(1);
+            }
+        }));
+    }
+
+    for (size_t i = 0; i < threads.size(); ++i) {
+        threads[i].join();
+    }
+    queue.close();
+    for (size_t i = 0; i < consumerThreads.size(); ++i) {
+        consumerThreads[i].join();
+    }
+
+    assert(consumed.load() == total);
+    for (int i = 0; i < total; ++i) {
+        assert(seen[i].load() == 1);
+    }
+
+    std::cout << "Concurrent tests passed!" << std::endl;
+}
+
+void testInvalidSize() {
+    std::cout << "Testing invalid size..." << std::endl;
+    try {
+        MPMCQueue<int> queue(-1);
+        assert(false);  // 不应该到达这里
+    } catch (const std::invalid_argument&) {
+        // 期望抛出异常
+    }
+    std::cout << "Invalid size tests passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testBasicOperations();
+        testClose();
+        testConcurrent(1, 1, true);
+        testConcurrent(4, 4, true);
+        testConcurrent(3, 2, false);
+        testInvalidSize();
+
+        std::cout << "\nAll tests passed successfully!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,179 @@
+#ifndef SPSCQUEUE_HPP
+#define SPSCQUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+// 单生产者/单消费者（SPSC）无锁环形队列
+// 沿用 SeqQueue 的 front/rear 循环数组设计，区别在于：
+// 1. 容量向上取整为 2 的幂，用位与掩码代替取模
+// 2. front/rear 为单调递增计数器，rear - front 即为长度，不需要预留空位
+// 3. front 只由消费者写，rear 只由生产者写，二者分别独占一条缓存行
+// 4. 双方各自缓存对方的下标，只有在看起来满/空时才重新读取对方的原子变量
+template<typename T>
+class SPSCQueue {
+private:
+    static const size_t CACHE_LINE = 64;
+
+    T* data;
+    size_t mask;       // 容量 - 1
+    size_t maxLen;     // 容量（2 的幂）
+
+    // 消费者独占：队首计数器和对 rear 的缓存
+    alignas(CACHE_LINE) std::atomic<size_t> front;
+    size_t cachedRear;
+
+    // 生产者独占：队尾计数器和对 front 的缓存
+    alignas(CACHE_LINE) std::atomic<size_t> rear;
+    size_t cachedFront;
+
+    // 避免 rear 所在缓存行与相邻对象发生伪共享
+    char padding[CACHE_LINE - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+
+    static size_t roundUpPow2(size_t n) {
+        size_t cap = 1;
+        while (cap < n) {
+            cap <<= 1;
+        }
+        return cap;
+    }
+
+public:
+    // 构造函数，容量向上取整为 2 的幂
+    explicit SPSCQueue(int len) : front(0), cachedRear(0), rear(0), cachedFront(0) {
+        if (len <= 0) {
+            throw std::invalid_argument("Queue size must be positive");
+        }
+        maxLen = roundUpPow2(static_cast<size_t>(len));
+        mask = maxLen - 1;
+        data = new T[maxLen];
+    }
+
+    // 析构函数
+    ~SPSCQueue() {
+        delete[] data;
+    }
+
+    // 原子下标无法安全拷贝，禁止拷贝
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    // 检查队列是否为空（并发时为瞬时快照）
+    bool empty() const {
+        return len() == 0;
+    }
+
+    // 获取队列长度（并发时为瞬时快照）
+    int len() const {
+        size_t f = front.load(std::memory_order_acquire);
+        size_t r = rear.load(std::memory_order_acquire);
+        return static_cast<int>(r - f);
+    }
+
+    // 获取队列容量
+    int capacity() const {
+        return static_cast<int>(maxLen);
+    }
+
+    // 入队操作，仅限生产者线程调用
+    bool enQueue(const T& e) {
+        size_t r = rear.load(std::memory_order_relaxed);
+        if (r - cachedFront == maxLen) {
+            cachedFront = front.load(std::memory_order_acquire);
+            if (r - cachedFront == maxLen) {
+                return false;
+            }
+        }
+        data[r & mask] = e;
+        rear.store(r + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 移动入队，仅限生产者线程调用
+    bool enQueue(T&& e) {
+        size_t r = rear.load(std::memory_order_relaxed);
+        if (r - cachedFront == maxLen) {
+            cachedFront = front.load(std::memory_order_acquire);
+            if (r - cachedFront == maxLen) {
+                return false;
+            }
+        }
+        data[r & mask] = std::move(e);
+        rear.store(r + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 批量入队，返回实际入队个数，仅限生产者线程调用
+    // 整批只发布一次 rear，减少跨核缓存行传递
+    int enQueueN(const T* items, int n) {
+        if (n <= 0) {
+            return 0;
+        }
+        size_t r = rear.load(std::memory_order_relaxed);
+        size_t space = maxLen - (r - cachedFront);
+        if (space < static_cast<size_t>(n)) {
+            cachedFront = front.load(std::memory_order_acquire);
+            space = maxLen - (r - cachedFront);
+        }
+        size_t count = space < static_cast<size_t>(n) ? space : static_cast<size_t>(n);
+        for (size_t i = 0; i < count; ++i) {
+            data[(r + i) & mask] = items[i];
+        }
+        if (count > 0) {
+            rear.store(r + count, std::memory_order_release);
+        }
+        return static_cast<int>(count);
+    }
+
+    // 出队操作，仅限消费者线程调用
+    bool deQueue(T& e) {
+        size_t f = front.load(std::memory_order_relaxed);
+        if (f == cachedRear) {
+            cachedRear = rear.load(std::memory_order_acquire);
+            if (f == cachedRear) {
+                return false;
+            }
+        }
+        e = std::move(data[f & mask]);
+        front.store(f + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 批量出队，返回实际出队个数，仅限消费者线程调用
+    int deQueueN(T* out, int n) {
+        if (n <= 0) {
+            return 0;
+        }
+        size_t f = front.load(std::memory_order_relaxed);
+        size_t avail = cachedRear - f;
+        if (avail < static_cast<size_t>(n)) {
+            cachedRear = rear.load(std::memory_order_acquire);
+            avail = cachedRear - f;
+        }
+        size_t count = avail < static_cast<size_t>(n) ? avail : static_cast<size_t>(n);
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = std::move(data[(f + i) & mask]);
+        }
+        if (count > 0) {
+            front.store(f + count, std::memory_order_release);
+        }
+        return static_cast<int>(count);
+    }
+
+    // 获取队首元素，仅限消费者线程调用
+    bool getFront(T& e) {
+        size_t f = front.load(std::memory_order_relaxed);
+        if (f == cachedRear) {
+            cachedRear = rear.load(std::memory_order_acquire);
+            if (f == cachedRear) {
+                return false;
+            }
+        }
+        e = data[f & mask];
+        return true;
+    }
+};
+
+#endif // SPSCQUEUE_HPP
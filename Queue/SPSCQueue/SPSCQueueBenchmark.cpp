@@ -0,0 +1,179 @@
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "SPSCQueue.hpp"
+#include "../SeqQueue/SeqQueue.hpp"
+
+// 对比 SPSCQueue 与 "SeqQueue + std::mutex" 在一个生产者线程、一个消费者线程之间传递数据的
+// 吞吐量和单条延迟。
+// 用法：./SPSCQueueBenchmark [元素个数]（默认 10^7）
+
+typedef std::chrono::steady_clock Clock;
+
+static long long nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now().time_since_epoch()).count();
+}
+
+// 用互斥锁包装的 SeqQueue，即目前业务中的用法
+template<typename T>
+class LockedSeqQueue {
+private:
+    SeqQueue<T> queue;
+    std::mutex mtx;
+
+public:
+    explicit LockedSeqQueue(int len) : queue(len + 1) {}
+
+    bool enQueue(const T& e) {
+        std::lock_guard<std::mutex> lock(mtx);
+        return queue.enQueue(e);
+    }
+
+    bool deQueue(T& e) {
+        std::lock_guard<std::mutex> lock(mtx);
+        return queue.deQueue(e);
+    }
+
+    int enQueueN(const T* items, int n) {
+        std::lock_guard<std::mutex> lock(mtx);
+        int i = 0;
+        while (i < n && queue.enQueue(items[i])) {
+            ++i;
+        }
+        return i;
+    }
+
+    int deQueueN(T* out, int n) {
+        std::lock_guard<std::mutex> lock(mtx);
+        int i = 0;
+        while (i < n && queue.deQueue(out[i])) {
+            ++i;
+        }
+        return i;
+    }
+};
+
+// 吞吐量：batch == 1 时使用单个 enQueue/deQueue，否则使用批量接口
+template<typename Queue>
+double throughput(long long count, int batch) {
+    Queue queue(1024);
+    Clock::time_point start = Clock::now();
+
+    std::thread producer([&queue, count, batch]() {
+        std::vector<long long> items(batch);
+        long long next = 0;
+        while (next < count) {
+            if (batch == 1) {
+                if (queue.enQueue(next)) {
+                    ++next;
+                } else {
+                    std::this_thread::yield();
+                }
+            } else {
+                int n = static_cast<int>(std::min<long long>(batch, count - next));
+                for (int i = 0; i < n; ++i) {
+                    items[i] = next + i;
+                }
+                int pushed = queue.enQueueN(items.data(), n);
+                next += pushed;
+                if (pushed == 0) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    });
+
+    std::vector<long long> buffer(batch);
+    long long received = 0;
+    long long sum = 0;
+    while (received < count) {
+        int n = batch == 1 ? (queue.deQueue(buffer[0]) ? 1 : 0)
+                           : queue.deQueueN(buffer.data(), batch);
+        if (n == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (int i = 0; i < n; ++i) {
+            sum += buffer[i];
+        }
+        received += n;
+    }
+    producer.join();
+
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    if (sum != count * (count - 1) / 2) {
+        std::cerr << "checksum mismatch" << std::endl;
+    }
+    return count / seconds / 1e6;
+}
+
+// 延迟：生产者以固定间隔写入时间戳，消费者记录从入队到出队的时间
+template<typename Queue>
+void latency(const char* name, int samples) {
+    Queue queue(1024);
+    std::vector<long long> result;
+    result.reserve(samples);
+
+    std::thread producer([&queue, samples]() {
+        for (int i = 0; i < samples; ++i) {
+            long long ts = nowNs();
+            while (!queue.enQueue(ts)) {
+                std::this_thread::yield();
+            }
+            // 控制发送速率，避免测成排队延迟
+            long long until = ts + 2000;
+            while (nowNs() < until) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    long long ts;
+    while (static_cast<int>(result.size()) < samples) {
+        if (queue.deQueue(ts)) {
+            result.push_back(nowNs() - ts);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    std::sort(result.begin(), result.end());
+    std::cout << std::setw(22) << name
+              << std::setw(10) << result[samples / 2]
+              << std::setw(10) << result[samples * 99 / 100]
+              << std::setw(12) << result[samples * 999 / 1000]
+              << std::setw(12) << result.back() << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    long long count = argc > 1 ? std::atoll(argv[1]) : 10000000LL;
+
+    std::cout << "Throughput (" << count << " items, Mops/s)" << std::endl;
+    std::cout << std::setw(22) << "queue" << std::setw(12) << "batch=1"
+              << std::setw(12) << "batch=16" << std::setw(12) << "batch=256" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << std::setw(22) << "SPSCQueue"
+              << std::setw(12) << throughput<SPSCQueue<long long>>(count, 1)
+              << std::setw(12) << throughput<SPSCQueue<long long>>(count, 16)
+              << std::setw(12) << throughput<SPSCQueue<long long>>(count, 256) << std::endl;
+    std::cout << std::setw(22) << "SeqQueue + mutex"
+              << std::setw(12) << throughput<LockedSeqQueue<long long>>(count, 1)
+              << std::setw(12) << throughput<LockedSeqQueue<long long>>(count, 16)
+              << std::setw(12) << throughput<LockedSeqQueue<long long>>(count, 256) << std::endl;
+
+    int samples = 100000;
+    std::cout << "\nLatency (" << samples << " samples, ns)" << std::endl;
+    std::cout << std::setw(22) << "queue" << std::setw(10) << "p50" << std::setw(10) << "p99"
+              << std::setw(12) << "p99.9" << std::setw(12) << "max" << std::endl;
+    latency<SPSCQueue<long long>>("SPSCQueue", samples);
+    latency<LockedSeqQueue<long long>>("SeqQueue + mutex", samples);
+    return 0;
+}
@@ -0,0 +1,164 @@
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <thread>
+#include <vector>
+#include "SPSCQueue.hpp"
+
+void testBasicOperations() {
+    std::cout << "Testing basic operations..." << std::endl;
+
+    // 容量向上取整为 2 的幂，且不需要预留空位
+    SPSCQueue<int> queue(5);
+    assert(queue.capacity() == 8);
+    assert(queue.empty());
+    assert(queue.len() == 0);
+
+    for (int i = 1; i <= 8; ++i) {
+        assert(queue.enQueue(i));
+    }
+    assert(!queue.enQueue(9));  // 队列已满
+    assert(queue.len() == 8);
+
+    int value;
+    assert(queue.getFront(value));
+    assert(value == 1);
+    for (int i = 1; i <= 8; ++i) {
+        assert(queue.deQueue(value));
+        assert(value == i);
+    }
+    assert(!queue.deQueue(value));  // 队列为空
+    assert(!queue.getFront(value));
+    assert(queue.empty());
+
+    std::cout << "Basic operations tests passed!" << std::endl;
+}
+
+void testWrapAround() {
+    std::cout << "Testing wrap around..." << std::endl;
+
+    SPSCQueue<std::string> queue(4);
+    std::string value;
+    // 多次绕圈，验证掩码下标的正确性
+    for (int round = 0; round < 10; ++round) {
+        assert(queue.enQueue("a" + std::to_string(round)));
+        assert(queue.enQueue("b" + std::to_string(round)));
+        assert(queue.enQueue("c" + std::to_string(round)));
+        assert(queue.deQueue(value) && value == "a" + std::to_string(round));
+        assert(queue.deQueue(value) && value == "b" + std::to_string(round));
+        assert(queue.deQueue(value) && value == "c" + std::to_string(round));
+    }
+    assert(queue.empty());
+
+    std::cout << "Wrap around tests passed!" << std::endl;
+}
+
+void testBatchOperations() {
+    std::cout << "Testing batch operations..." << std::endl;
+
+    SPSCQueue<int> queue(8);
+    int input[12];
+    for (int i = 0; i < 12; ++i) {
+        input[i] = i;
+    }
+
+    // 只有 8 个空位，批量入队只能放进 8 个
+    assert(queue.enQueueN(input, 12) == 8);
+    assert(queue.len() == 8);
+    assert(queue.enQueueN(input, 1) == 0);
+
+    int output[12];
+    assert(queue.deQueueN(output, 5) == 5);
+    for (int i = 0; i < 5; ++i) {
+        assert(output[i] == i);
+    }
+
+    // 跨越数组末尾的批量入队
+    assert(queue.enQueueN(input + 8, 4) == 4);
+    assert(queue.deQueueN(output, 12) == 7);
+    for (int i = 0; i < 7; ++i) {
+        assert(output[i] == i + 5);
+    }
+    assert(queue.deQueueN(output, 1) == 0);
+    assert(queue.enQueueN(input, 0) == 0);
+
+    std::cout << "Batch operations tests passed!" << std::endl;
+}
+
+void testProducerConsumer() {
+    std::cout << "Testing producer/consumer threads..." << std::endl;
+
+    const int count = 200000;
+    SPSCQueue<int> queue(64);
+
+    std::thread producer([&queue, count]() {
+        int batch[16];
+        int next = 0;
+        while (next < count) {
+            // 交替使用单个入队和批量入队
+            if (next % 3 == 0) {
+                if (queue.enQueue(next)) {
+                    ++next;
+                } else {
+                    std::this_thread::yield();
+                }
+            } else {
+                int n = 0;
+                while (n < 16 && next + n < count) {
+                    batch[n] = next + n;
+                    ++n;
+                }
+                int pushed = queue.enQueueN(batch, n);
+                next += pushed;
+                if (pushed == 0) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    });
+
+    int expected = 0;
+    int buffer[8];
+    while (expected < count) {
+        int n = queue.deQueueN(buffer, 8);
+        if (n == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (int i = 0; i < n; ++i) {
+            assert(buffer[i] == expected);
+            ++expected;
+        }
+    }
+    producer.join();
+    assert(queue.empty());
+
+    std::cout << "Producer/consumer tests passed!" << std::endl;
+}
+
+void testInvalidSize() {
+    std::cout << "Testing invalid size..." << std::endl;
+    try {
+        SPSCQueue<int> queue(0);
+        assert(false);  // 不应该到达这里
+    } catch (const std::invalid_argument&) {
+        // 期望抛出异常
+    }
+    std::cout << "Invalid size tests passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testBasicOperations();
+        testWrapAround();
+        testBatchOperations();
+        testProducerConsumer();
+        testInvalidSize();
+
+        std::cout << "\nAll tests passed successfully!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+}
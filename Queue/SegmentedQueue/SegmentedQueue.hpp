@@ -0,0 +1,279 @@
+#ifndef SEGMENTED_QUEUE_HPP
+#define SEGMENTED_QUEUE_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// 分段链式队列
+// 与 LinkedQueue 的接口一致，但链表中的每个节点（块）存放一组元素而不是一个元素：
+// 块大小默认为 4 KiB，元素在块内连续存放，块与块之间用指针相连。
+// 出队时从头块读取，头块用完后释放（保留一个空闲块供入队复用，避免在块边界反复申请/释放）。
+template<typename T, size_t BlockBytes = 4096>
+class SegmentedQueue {
+private:
+    typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Slot;
+
+    // 每块容纳的元素个数，至少为 1
+    static const size_t PER_BLOCK =
+        (BlockBytes > sizeof(void*) + sizeof(Slot))
+            ? (BlockBytes - sizeof(void*)) / sizeof(Slot)
+            : 1;
+
+    struct Block {
+        Block* next;
+        Slot slots[PER_BLOCK];
+
+        Block() : next(nullptr) {}
+
+        T* at(size_t i) {
+            return reinterpret_cast<T*>(&slots[i]);
+        }
+
+        const T* at(size_t i) const {
+            return reinterpret_cast<const T*>(&slots[i]);
+        }
+    };
+
+    Block* frontBlock;   // 队首所在块
+    size_t frontIndex;   // 队首在块内的位置
+    Block* rearBlock;    // 队尾所在块
+    size_t rearIndex;    // 队尾下一个可写入位置
+    Block* spare;        // 缓存的空闲块
+    int size;
+
+    Block* newBlock() {
+        if (spare != nullptr) {
+            Block* b = spare;
+            spare = nullptr;
+            b->next = nullptr;
+            return b;
+        }
+        return new Block;
+    }
+
+    void recycleBlock(Block* b) {
+        if (spare == nullptr) {
+            spare = b;
+        } else {
+            delete b;
+        }
+    }
+
+    // 在队尾构造一个元素。队尾块已满时，元素先构造进新块，构造成功后才把新块接到链尾，
+    // 构造抛出异常时新块退回 spare，队列保持不变
+    template<typename... Args>
+    void pushBack(Args&&... args) {
+        if (rearIndex < PER_BLOCK) {
+            new (rearBlock->at(rearIndex)) T(std::forward<Args>(args)...);
+            ++rearIndex;
+        } else {
+            Block* b = newBlock();
+            try {
+                new (b->at(0)) T(std::forward<Args>(args)...);
+            } catch (...) {
+                recycleBlock(b);
+                throw;
+            }
+            rearBlock->next = b;
+            rearBlock = b;
+            rearIndex = 1;
+        }
+        ++size;
+    }
+
+    // 出队后推进队首，头块用完则回收
+    void advanceFront() {
+        ++frontIndex;
+        --size;
+        if (size == 0) {
+            // 队列为空时队首与队尾必在同一块，把下标拨回块首以便从头复用
+            frontIndex = 0;
+            rearIndex = 0;
+        } else if (frontIndex == PER_BLOCK) {
+            Block* old = frontBlock;
+            frontBlock = frontBlock->next;
+            frontIndex = 0;
+            recycleBlock(old);
+        }
+    }
+
+public:
+    // 前向迭代器，按出队顺序遍历元素
+    template<typename Value, typename BlockPtr>
+    class Iterator {
+    private:
+        BlockPtr block;
+        size_t index;
+        int remaining;
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef typename std::remove_const<Value>::type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Value* pointer;
+        typedef Value& reference;
+
+        Iterator(BlockPtr b, size_t i, int n) : block(b), index(i), remaining(n) {}
+
+        reference operator*() const {
+            return *block->at(index);
+        }
+
+        pointer operator->() const {
+            return block->at(index);
+        }
+
+        Iterator& operator++() {
+            --remaining;
+            if (++index == PER_BLOCK) {
+                block = block->next;
+                index = 0;
+            }
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const Iterator& other) const {
+            return remaining == other.remaining;
+        }
+
+        bool operator!=(const Iterator& other) const {
+            return remaining != other.remaining;
+        }
+    };
+
+    typedef Iterator<T, Block*> iterator;
+    typedef Iterator<const T, const Block*> const_iterator;
+
+    // 构造函数
+    SegmentedQueue() : frontIndex(0), rearIndex(0), spare(nullptr), size(0) {
+        frontBlock = rearBlock = new Block;
+    }
+
+    // 析构函数
+    ~SegmentedQueue() {
+        clear();
+        delete frontBlock;
+        delete spare;
+    }
+
+    // 拷贝构造函数
+    SegmentedQueue(const SegmentedQueue& other) : SegmentedQueue() {
+        for (const_iterator it = other.begin(); it != other.end(); ++it) {
+            enQueue(*it);
+        }
+    }
+
+    // 赋值运算符
+    SegmentedQueue& operator=(const SegmentedQueue& other) {
+        if (this != &other) {
+            SegmentedQueue temp(other);
+            std::swap(frontBlock, temp.frontBlock);
+            std::swap(frontIndex, temp.frontIndex);
+            std::swap(rearBlock, temp.rearBlock);
+            std::swap(rearIndex, temp.rearIndex);
+            std::swap(spare, temp.spare);
+            std::swap(size, temp.size);
+        }
+        return *this;
+    }
+
+    // 清空队列，只保留一个块
+    void clear() {
+        while (size > 0) {
+            frontBlock->at(frontIndex)->~T();
+            advanceFront();
+        }
+        // 释放队首块之后的所有块（clear 后它们都已为空）
+        Block* p = frontBlock->next;
+        while (p != nullptr) {
+            Block* next = p->next;
+            delete p;
+            p = next;
+        }
+        frontBlock->next = nullptr;
+        rearBlock = frontBlock;
+        frontIndex = rearIndex = 0;
+    }
+
+    // 检查队列是否为空
+    bool isEmpty() const {
+        return size == 0;
+    }
+
+    // 获取队列长度
+    int length() const {
+        return size;
+    }
+
+    // 入队操作
+    void enQueue(const T& e) {
+        pushBack(e);
+    }
+
+    // 移动入队
+    void enQueue(T&& e) {
+        pushBack(std::move(e));
+    }
+
+    // 出队操作
+    bool deQueue(T& e) {
+        if (isEmpty()) {
+            return false;
+        }
+        T* p = frontBlock->at(frontIndex);
+        e = std::move(*p);
+        p->~T();
+        advanceFront();
+        return true;
+    }
+
+    // 获取队首元素
+    bool getFront(T& e) const {
+        if (isEmpty()) {
+            return false;
+        }
+        e = *frontBlock->at(frontIndex);
+        return true;
+    }
+
+    // 获取队尾元素
+    bool getRear(T& e) const {
+        if (isEmpty()) {
+            return false;
+        }
+        e = *rearBlock->at(rearIndex - 1);
+        return true;
+    }
+
+    // 每块可容纳的元素个数
+    static size_t blockCapacity() {
+        return PER_BLOCK;
+    }
+
+    iterator begin() {
+        return iterator(frontBlock, frontIndex, size);
+    }
+
+    iterator end() {
+        return iterator(nullptr, 0, 0);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(frontBlock, frontIndex, size);
+    }
+
+    const_iterator end() const {
+        return const_iterator(nullptr, 0, 0);
+    }
+};
+
+#endif // SEGMENTED_QUEUE_HPP
@@ -0,0 +1,130 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <malloc.h>
+#include "SegmentedQueue.hpp"
+#include "../LinkedQueue/LinkedQueue.hpp"
+
+// 对比 SegmentedQueue 与逐元素节点的 LinkedQueue：
+//   内存占用：队列中有 n 个元素时堆内存的实际占用（含 malloc 开销，glibc 的 malloc_usable_size）
+//   吞吐量：一次性入队 n 个再全部出队，以及保持 1000 个元素的稳定收发
+// 用法：./SegmentedQueueBenchmark [n]（默认 10^6）
+
+static long long liveBytes = 0;
+
+void* operator new(size_t size) {
+    void* p = std::malloc(size);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    liveBytes += static_cast<long long>(malloc_usable_size(p)) + sizeof(size_t);
+    return p;
+}
+
+// 不内联，避免编译器把 free 与 new 表达式直接配对而误报 -Wmismatched-new-delete
+__attribute__((noinline)) void operator delete(void* p) noexcept {
+    if (p != nullptr) {
+        liveBytes -= static_cast<long long>(malloc_usable_size(p)) + sizeof(size_t);
+    }
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    operator delete(p);
+}
+
+typedef std::chrono::steady_clock Clock;
+static volatile long long sink = 0;
+
+struct Payload64 {
+    long long fields[8];
+
+    Payload64() : fields() {}
+    explicit Payload64(long long v) {
+        for (int i = 0; i < 8; ++i) {
+            fields[i] = v;
+        }
+    }
+};
+
+template<typename T>
+long long valueOf(const T& v);
+
+template<>
+long long valueOf<int>(const int& v) {
+    return v;
+}
+
+template<>
+long long valueOf<Payload64>(const Payload64& v) {
+    return v.fields[0];
+}
+
+template<typename Queue, typename T>
+void measure(const char* name, long long n) {
+    // 内存占用
+    long long before = liveBytes;
+    double bytesPerElement;
+    {
+        Queue queue;
+        for (long long i = 0; i < n; ++i) {
+            queue.enQueue(T(static_cast<int>(i)));
+        }
+        bytesPerElement = static_cast<double>(liveBytes - before) / n;
+    }
+
+    // 入队 n 个再全部出队
+    Queue queue;
+    Clock::time_point start = Clock::now();
+    for (long long i = 0; i < n; ++i) {
+        queue.enQueue(T(static_cast<int>(i)));
+    }
+    T value = T();
+    long long sum = 0;
+    while (queue.deQueue(value)) {
+        sum += valueOf(value);
+    }
+    double fillDrain = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / n;
+
+    // 稳定收发
+    for (int i = 0; i < 1000; ++i) {
+        queue.enQueue(T(i));
+    }
+    start = Clock::now();
+    for (long long i = 0; i < n; ++i) {
+        queue.enQueue(T(static_cast<int>(i)));
+        queue.deQueue(value);
+        sum += valueOf(value);
+    }
+    double churn = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / n;
+    sink = sum;
+
+    std::cout << std::setw(28) << name << std::fixed << std::setprecision(2)
+              << std::setw(14) << bytesPerElement
+              << std::setw(18) << fillDrain
+              << std::setw(14) << churn << std::endl;
+}
+
+static void header(const char* title) {
+    std::cout << "\n== " << title << " ==" << std::endl;
+    std::cout << std::setw(28) << "queue" << std::setw(14) << "bytes/elem"
+              << std::setw(18) << "fill+drain ns/op" << std::setw(14) << "churn ns/op" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    long long n = argc > 1 ? std::atoll(argv[1]) : 1000000LL;
+    std::cout << "n = " << n << std::endl;
+
+    header("int");
+    measure<LinkedQueue<int>, int>("LinkedQueue", n);
+    measure<SegmentedQueue<int>, int>("SegmentedQueue (4 KiB)", n);
+    measure<SegmentedQueue<int, 65536>, int>("SegmentedQueue (64 KiB)", n);
+
+    header("64-byte payload");
+    measure<LinkedQueue<Payload64>, Payload64>("LinkedQueue", n);
+    measure<SegmentedQueue<Payload64>, Payload64>("SegmentedQueue (4 KiB)", n);
+    measure<SegmentedQueue<Payload64, 65536>, Payload64>("SegmentedQueue (64 KiB)", n);
+    return 0;
+}
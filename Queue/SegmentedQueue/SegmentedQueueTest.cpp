@@ -0,0 +1,219 @@
+#include "SegmentedQueue.hpp"
+#include <cassert>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <stdexcept>
+
+void testBasicOperations() {
+    std::cout << "Testing basic operations..." << std::endl;
+
+    SegmentedQueue<int> queue;
+    assert(queue.isEmpty() && "New queue should be empty");
+    assert(queue.length() == 0 && "New queue should have length 0");
+
+    for (int i = 1; i <= 5; i++) {
+        queue.enQueue(i);
+        assert(queue.length() == i && "Queue length should increase after enQueue");
+    }
+
+    int front, rear;
+    assert(queue.getFront(front) && front == 1 && "Front element should be 1");
+    assert(queue.getRear(rear) && rear == 5 && "Rear element should be 5");
+
+    int value;
+    for (int i = 1; i <= 5; i++) {
+        assert(queue.deQueue(value) && value == i && "Values should be dequeued in FIFO order");
+    }
+    assert(queue.isEmpty() && "Queue should be empty after all deQueue operations");
+    assert(!queue.deQueue(value) && "deQueue should fail on empty queue");
+    assert(!queue.getFront(value) && "getFront should fail on empty queue");
+    assert(!queue.getRear(value) && "getRear should fail on empty queue");
+
+    std::cout << "Basic operations tests passed!" << std::endl;
+}
+
+// 使用很小的块，覆盖跨块入队/出队的各种边界
+void testBlockBoundaries() {
+    std::cout << "Testing block boundaries..." << std::endl;
+
+    typedef SegmentedQueue<int, 32> SmallQueue;
+    const int perBlock = static_cast<int>(SmallQueue::blockCapacity());
+    assert(perBlock >= 1 && "Block should hold at least one element");
+
+    SmallQueue queue;
+    int value;
+    int next = 0;
+    int expected = 0;
+    // 不同步长交替入队出队，队列长度在块边界附近来回变化
+    for (int round = 0; round < 50; ++round) {
+        int pushes = (round % 7) + perBlock - 1;
+        int pops = (round % 5) + perBlock - 2;
+        for (int i = 0; i < pushes; ++i) {
+            queue.enQueue(next++);
+        }
+        int rear;
+        assert(queue.getRear(rear) && rear == next - 1 && "Rear should be the last enqueued value");
+        for (int i = 0; i < pops && !queue.isEmpty(); ++i) {
+            assert(queue.deQueue(value) && value == expected && "Values should cross blocks in order");
+            ++expected;
+        }
+        assert(queue.length() == next - expected && "Length should match pushes minus pops");
+    }
+    while (queue.deQueue(value)) {
+        assert(value == expected++ && "Draining should preserve order");
+    }
+    assert(expected == next && "All values should be dequeued");
+
+    // 恰好填满一块后清空，再继续使用
+    for (int i = 0; i < perBlock; ++i) {
+        queue.enQueue(i);
+    }
+    for (int i = 0; i < perBlock; ++i) {
+        assert(queue.deQueue(value) && value == i && "Full block should drain in order");
+    }
+    queue.enQueue(99);
+    assert(queue.getFront(value) && value == 99 && "Queue should be reusable after exact drain");
+
+    std::cout << "Block boundaries tests passed!" << std::endl;
+}
+
+void testIteration() {
+    std::cout << "Testing iteration..." << std::endl;
+
+    SegmentedQueue<std::string, 64> queue;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 20; ++i) {
+        queue.enQueue("item" + std::to_string(i));
+        expected.push_back("item" + std::to_string(i));
+    }
+    std::string value;
+    for (int i = 0; i < 3; ++i) {
+        queue.deQueue(value);
+    }
+    expected.erase(expected.begin(), expected.begin() + 3);
+
+    size_t index = 0;
+    for (SegmentedQueue<std::string, 64>::iterator it = queue.begin(); it != queue.end(); ++it) {
+        assert(*it == expected[index++] && "Iteration should follow dequeue order");
+        *it += "!";
+    }
+    assert(index == expected.size() && "Iteration should visit every element");
+
+    const SegmentedQueue<std::string, 64>& constQueue = queue;
+    index = 0;
+    for (SegmentedQueue<std::string, 64>::const_iterator it = constQueue.begin(); it != constQueue.end(); ++it) {
+        assert(it->size() == expected[index].size() + 1 && "Elements should be modifiable through iterator");
+        ++index;
+    }
+
+    SegmentedQueue<int> empty;
+    assert(!(empty.begin() != empty.end()) && "Empty queue should have begin == end");
+
+    std::cout << "Iteration tests passed!" << std::endl;
+}
+
+void testCopyAndClear() {
+    std::cout << "Testing copy, assignment and clear..." << std::endl;
+
+    SegmentedQueue<std::string, 64> original;
+    for (int i = 0; i < 30; ++i) {
+        original.enQueue(std::to_string(i));
+    }
+
+    SegmentedQueue<std::string, 64> copied(original);
+    assert(copied.length() == original.length() && "Copied queue should have same length");
+
+    SegmentedQueue<std::string, 64> assigned;
+    assigned.enQueue("old");
+    assigned = original;
+    assert(assigned.length() == original.length() && "Assigned queue should have same length");
+
+    std::string a, b, c;
+    while (original.deQueue(a)) {
+        assert(copied.deQueue(b) && assigned.deQueue(c) && "Copies should have the same elements");
+        assert(a == b && b == c && "Values should be the same in all queues");
+    }
+
+    for (int i = 0; i < 30; ++i) {
+        original.enQueue(std::to_string(i));
+    }
+    original.clear();
+    assert(original.isEmpty() && original.length() == 0 && "Queue should be empty after clear");
+    original.enQueue("again");
+    assert(original.getFront(a) && a == "again" && "Queue should be usable after clear");
+
+    std::cout << "Copy, assignment and clear tests passed!" << std::endl;
+}
+
+// 拷贝时可以按需抛出异常的元素
+struct ThrowingValue {
+    static bool throwOnCopy;
+    int value;
+
+    ThrowingValue(int v = 0) : value(v) {}
+
+    ThrowingValue(const ThrowingValue& other) : value(other.value) {
+        if (throwOnCopy) {
+            throw std::runtime_error("copy failed");
+        }
+    }
+
+    ThrowingValue& operator=(const ThrowingValue&) = default;
+};
+
+bool ThrowingValue::throwOnCopy = false;
+
+// 在块边界入队时元素构造抛出异常，队列应保持原状
+void testThrowingEnqueue() {
+    std::cout << "Testing exception safety of enQueue..." << std::endl;
+
+    typedef SegmentedQueue<ThrowingValue, 64> SmallQueue;
+    const int perBlock = static_cast<int>(SmallQueue::blockCapacity());
+
+    SmallQueue queue;
+    ThrowingValue v;
+    for (int i = 0; i < perBlock; ++i) {
+        queue.enQueue(ThrowingValue(i));
+    }
+
+    ThrowingValue::throwOnCopy = true;
+    bool thrown = false;
+    try {
+        queue.enQueue(v);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    ThrowingValue::throwOnCopy = false;
+    assert(thrown && "enQueue should propagate the exception");
+    assert(queue.length() == perBlock && "Failed enQueue should not change the length");
+    assert(queue.getRear(v) && v.value == perBlock - 1 && "Rear should be unchanged after failed enQueue");
+
+    for (int i = 0; i < perBlock; ++i) {
+        assert(queue.deQueue(v) && v.value == i && "Existing elements should be intact");
+    }
+    assert(queue.isEmpty() && "Queue should be empty after draining");
+
+    queue.enQueue(ThrowingValue(42));
+    assert(queue.getRear(v) && v.value == 42 && "Rear should be the new element");
+    assert(queue.deQueue(v) && v.value == 42 && "Queue should be usable after failed enQueue");
+    assert(queue.isEmpty() && "Queue should be empty again");
+
+    std::cout << "Exception safety tests passed!" << std::endl;
+}
+
+int main() {
+    try {
+        testBasicOperations();
+        testBlockBoundaries();
+        testIteration();
+        testCopyAndClear();
+        testThrowingEnqueue();
+
+        std::cout << "\nAll tests passed successfully!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+}
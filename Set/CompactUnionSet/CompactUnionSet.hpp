@@ -0,0 +1,157 @@
+#ifndef COMPACT_UNION_SET_HPP
+#define COMPACT_UNION_SET_HPP
+
+#include <vector>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+// Per-element data of a CompactUnionSet, stored in its own array
+template<typename T, typename Index>
+class CompactUnionSetData {
+private:
+    std::vector<T> data;  // Data array
+
+protected:
+    void resizeData(Index n) {
+        data.resize(static_cast<size_t>(n));
+    }
+
+    size_t dataBytes() const {
+        return data.capacity() * sizeof(T);
+    }
+
+public:
+    // Initialize element data
+    void setData(Index index, const T& value) {
+        if (index < 0 || static_cast<size_t>(index) >= data.size()) {
+            throw std::out_of_range("Index out of range");
+        }
+        data[static_cast<size_t>(index)] = value;
+    }
+
+    // Get element data
+    T getData(Index index) const {
+        if (index < 0 || static_cast<size_t>(index) >= data.size()) {
+            throw std::out_of_range("Index out of range");
+        }
+        return data[static_cast<size_t>(index)];
+    }
+};
+
+// T = void: no data array and no setData/getData
+template<typename Index>
+class CompactUnionSetData<void, Index> {
+protected:
+    void resizeData(Index) {}
+
+    size_t dataBytes() const {
+        return 0;
+    }
+};
+
+// Disjoint-set with a single packed array: parent[i] >= 0 is the parent of i,
+// parent[i] < 0 marks a root whose set has -parent[i] elements (union by size).
+// Index is the signed index type (32-bit is enough for up to 2^31 - 1 elements),
+// T is the per-element data type, or void to store no data at all.
+// find, isConnected and getSetSize halve paths in place although they are
+// const, so even read-only use from several threads must be synchronized.
+template<typename T = void, typename Index = std::int32_t>
+class CompactUnionSet : public CompactUnionSetData<T, Index> {
+    static_assert(std::is_integral<Index>::value && std::is_signed<Index>::value,
+                  "Index must be a signed integer type");
+
+private:
+    mutable std::vector<Index> parent;  // Parent index, or minus the set size for roots
+    Index size;                         // Number of elements
+    Index setCount;                     // Number of distinct sets
+
+    // Iterative find with path halving; a root's parent slot is negative
+    Index findRoot(Index x) const {
+        Index* p = parent.data();
+        while (p[x] >= 0) {
+            Index up = p[x];
+            if (p[up] < 0) {
+                return up;
+            }
+            p[x] = p[up];
+            x = p[up];
+        }
+        return x;
+    }
+
+    void checkIndex(Index x) const {
+        if (x < 0 || x >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+    }
+
+public:
+    // Constructor
+    explicit CompactUnionSet(Index n) {
+        if (n <= 0) {
+            throw std::invalid_argument("Size must be positive");
+        }
+        size = n;
+        setCount = n;
+        parent.assign(static_cast<size_t>(n), Index(-1));  // Every element is a root of size 1
+        this->resizeData(n);
+    }
+
+    // Find the representative of the set containing x
+    Index find(Index x) const {
+        checkIndex(x);
+        return findRoot(x);
+    }
+
+    // Union by size, returns false if x and y were already in the same set
+    bool merge(Index x, Index y) {
+        checkIndex(x);
+        checkIndex(y);
+
+        Index rootX = findRoot(x);
+        Index rootY = findRoot(y);
+
+        if (rootX == rootY) return false;  // Already in same set
+
+        // Sizes are stored negated, so the larger set has the smaller entry
+        if (parent[rootX] < parent[rootY]) {
+            std::swap(rootX, rootY);
+        }
+        parent[rootY] += parent[rootX];
+        parent[rootX] = rootY;
+        --setCount;
+        return true;
+    }
+
+    // Check if two elements are in the same set
+    bool isConnected(Index x, Index y) const {
+        checkIndex(x);
+        checkIndex(y);
+        return findRoot(x) == findRoot(y);
+    }
+
+    // Get the number of elements
+    Index getSize() const {
+        return size;
+    }
+
+    // Get number of distinct sets
+    Index getSetCount() const {
+        return setCount;
+    }
+
+    // Get the number of elements in the set containing x
+    Index getSetSize(Index x) const {
+        return -parent[find(x)];
+    }
+
+    // Heap memory used by the parent and data arrays, in bytes
+    size_t memoryBytes() const {
+        return parent.capacity() * sizeof(Index) + this->dataBytes();
+    }
+};
+
+#endif // COMPACT_UNION_SET_HPP
@@ -0,0 +1,120 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+#include "CompactUnionSet.hpp"
+#include "../UnionSet/UnionSet.hpp"
+
+// Memory and speed of the packed layout against UnionSet, on n elements (default 10^7):
+//   merge : n merges of uniformly random pairs
+//   query : n isConnected calls on random pairs
+// Columns:
+//   UnionSet<int>          : parent + rank + data arrays (union by rank)
+//   Compact<int, int32>    : packed parent array + data array
+//   Compact<void, int32>   : packed parent array only
+//   Compact<void, int64>   : packed parent array with 64-bit indices
+// Bytes/element count the heap arrays; times are ms, best of 3.
+// Usage: ./CompactUnionSetBenchmark [n]
+
+typedef std::chrono::steady_clock Clock;
+
+static volatile long sink;
+
+struct Result {
+    double bytes;
+    double merge;
+    double query;
+    long check;
+};
+
+static std::uint32_t nextRandom(std::uint32_t& seed) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+static double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+static size_t memoryBytes(const UnionSet<int>& set) {
+    // parent and rank, plus the data array
+    return static_cast<size_t>(set.getSize()) * (2 * sizeof(int) + sizeof(int));
+}
+
+template<typename T, typename Index>
+static size_t memoryBytes(const CompactUnionSet<T, Index>& set) {
+    return set.memoryBytes();
+}
+
+template<typename Set, typename Make>
+Result run(Make make, int n, const std::vector<int>& ops) {
+    Result best = {0, 0, 0, 0};
+    size_t half = ops.size() / 2;
+    for (int round = 0; round < 3; ++round) {
+        std::unique_ptr<Set> set(make());
+        Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < half; i += 2) {
+            set->merge(ops[i], ops[i + 1]);
+        }
+        double merge = elapsedMs(start);
+
+        const Set& view = *set;
+        long connected = 0;
+        start = Clock::now();
+        for (size_t i = half; i < ops.size(); i += 2) {
+            connected += view.isConnected(ops[i], ops[i + 1]);
+        }
+        double query = elapsedMs(start);
+
+        if (round == 0 || merge < best.merge) best.merge = merge;
+        if (round == 0 || query < best.query) best.query = query;
+        best.bytes = static_cast<double>(memoryBytes(view)) / n;
+        best.check = connected * 1000003L + view.getSetCount();
+        sink = sink + best.check;
+    }
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc > 1 ? std::atoi(argv[1]) : 10000000;
+    if (n < 2) {
+        n = 2;
+    }
+
+    // n merges followed by n queries, each a pair of indices
+    std::uint32_t seed = 2463534242u;
+    std::vector<int> ops(4 * static_cast<size_t>(n));
+    for (size_t i = 0; i < ops.size(); ++i) {
+        ops[i] = static_cast<int>(nextRandom(seed) % static_cast<std::uint32_t>(n));
+    }
+
+    const char* names[] = {"UnionSet<int>", "Compact<int, int32>", "Compact<void, int32>", "Compact<void, int64>"};
+    Result results[] = {
+        run<UnionSet<int>>([n]() { return new UnionSet<int>(n); }, n, ops),
+        run<CompactUnionSet<int, std::int32_t>>([n]() { return new CompactUnionSet<int, std::int32_t>(n); }, n, ops),
+        run<CompactUnionSet<void, std::int32_t>>([n]() { return new CompactUnionSet<void, std::int32_t>(n); }, n, ops),
+        run<CompactUnionSet<void, std::int64_t>>([n]() { return new CompactUnionSet<void, std::int64_t>(n); }, n, ops)
+    };
+    for (int i = 1; i < 4; ++i) {
+        if (results[i].check != results[0].check) {
+            std::cout << "result mismatch" << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "Random union/find on " << n << " elements, ms (best of 3)" << std::endl;
+    std::cout << std::setw(22) << "" << std::setw(12) << "bytes/elem" << std::setw(12) << "merge"
+              << std::setw(12) << "query" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    for (int i = 0; i < 4; ++i) {
+        std::cout << std::setw(22) << names[i] << std::setw(12) << results[i].bytes
+                  << std::setw(12) << results[i].merge << std::setw(12) << results[i].query << std::endl;
+    }
+    return 0;
+}
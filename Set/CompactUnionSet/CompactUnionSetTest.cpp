@@ -0,0 +1,201 @@
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "CompactUnionSet.hpp"
+
+// CompactUnionSet<void, ...> must not provide setData/getData
+template<typename S>
+class HasSetData {
+    template<typename U>
+    static char test(decltype(&U::setData));
+    template<typename U>
+    static long test(...);
+
+public:
+    static const bool value = sizeof(test<S>(0)) == sizeof(char);
+};
+
+void testBasicOperations() {
+    std::cout << "Testing basic operations..." << std::endl;
+
+    CompactUnionSet<> set(6);
+    assert(set.getSize() == 6);
+    assert(set.getSetCount() == 6);
+    for (int i = 0; i < 6; i++) {
+        assert(set.find(i) == i);
+        assert(set.getSetSize(i) == 1);
+    }
+
+    assert(set.merge(0, 1));     // {0,1} {2} {3} {4} {5}
+    assert(!set.merge(1, 0));
+    assert(set.merge(2, 3));     // {0,1} {2,3} {4} {5}
+    assert(set.merge(3, 4));     // {0,1} {2,3,4} {5}
+    assert(set.getSetCount() == 3);
+    assert(set.isConnected(2, 4));
+    assert(!set.isConnected(0, 2));
+    assert(set.getSetSize(4) == 3);
+
+    // The smaller set is attached below the root of the larger one
+    int root = set.find(2);
+    assert(set.merge(1, 2));
+    assert(set.find(0) == root);
+    assert(set.getSetSize(0) == 5);
+    assert(set.getSetCount() == 2);
+
+    std::cout << "Basic operations test passed!" << std::endl;
+}
+
+void testData() {
+    std::cout << "Testing data storage..." << std::endl;
+
+    static_assert(!HasSetData<CompactUnionSet<void> >::value, "void data must not be stored");
+    static_assert(HasSetData<CompactUnionSet<std::string> >::value, "data accessors expected");
+
+    CompactUnionSet<std::string> set(3);
+    set.setData(0, "Apple");
+    set.setData(2, "Cherry");
+    set.merge(0, 2);
+    assert(set.getData(0) == "Apple");
+    assert(set.getData(1).empty());
+    assert(set.getData(2) == "Cherry");
+
+    try {
+        set.setData(3, "Date");
+        assert(false);
+    } catch (const std::out_of_range& e) {
+        // Expected exception
+    }
+
+    // Without data only the parent array is allocated
+    CompactUnionSet<void, std::int32_t> small(1000);
+    CompactUnionSet<void, std::int64_t> wide(1000);
+    CompactUnionSet<int, std::int32_t> withData(1000);
+    assert(small.memoryBytes() == 1000 * sizeof(std::int32_t));
+    assert(wide.memoryBytes() == 1000 * sizeof(std::int64_t));
+    assert(withData.memoryBytes() == 1000 * (sizeof(std::int32_t) + sizeof(int)));
+
+    std::cout << "Data storage test passed!" << std::endl;
+}
+
+void testEdgeCases() {
+    std::cout << "Testing edge cases..." << std::endl;
+
+    try {
+        CompactUnionSet<> set(0);
+        assert(false);
+    } catch (const std::invalid_argument& e) {
+        // Expected exception
+    }
+
+    CompactUnionSet<> set(3);
+    try {
+        set.find(-1);
+        assert(false);
+    } catch (const std::out_of_range& e) {
+        // Expected exception
+    }
+    try {
+        set.merge(0, 3);
+        assert(false);
+    } catch (const std::out_of_range& e) {
+        // Expected exception
+    }
+    try {
+        set.getSetSize(3);
+        assert(false);
+    } catch (const std::out_of_range& e) {
+        // Expected exception
+    }
+
+    // Copies are independent
+    set.merge(0, 1);
+    CompactUnionSet<> copy(set);
+    copy.merge(1, 2);
+    assert(copy.getSetCount() == 1);
+    assert(set.getSetCount() == 2);
+    assert(!set.isConnected(0, 2));
+
+    std::cout << "Edge cases test passed!" << std::endl;
+}
+
+// Compare against a naive labelling on a random sequence, with both index widths
+template<typename Index>
+void checkRandomAgainstNaive() {
+    const int n = 2000;
+    CompactUnionSet<void, Index> set(n);
+    std::vector<int> label(n);
+    for (int i = 0; i < n; i++) label[i] = i;
+    int count = n;
+    std::srand(11);
+    for (int step = 0; step < 3000; step++) {
+        int x = std::rand() % n;
+        int y = std::rand() % n;
+        if (step % 2 == 0) {
+            bool expected = label[x] != label[y];
+            if (expected) {
+                int from = label[x];
+                for (int i = 0; i < n; i++) {
+                    if (label[i] == from) label[i] = label[y];
+                }
+                count--;
+            }
+            assert(set.merge(x, y) == expected);
+            assert(set.getSetCount() == count);
+        } else {
+            assert(set.isConnected(x, y) == (label[x] == label[y]));
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        int members = 0;
+        for (int j = 0; j < n; j++) {
+            if (label[j] == label[i]) members++;
+        }
+        assert(set.getSetSize(i) == members);
+    }
+}
+
+void testRandomAgainstNaive() {
+    std::cout << "Testing random operations against naive labelling..." << std::endl;
+
+    checkRandomAgainstNaive<std::int32_t>();
+    checkRandomAgainstNaive<std::int64_t>();
+    checkRandomAgainstNaive<std::int16_t>();
+
+    std::cout << "Random operations test passed!" << std::endl;
+}
+
+void testLargeSet() {
+    std::cout << "Testing a large set..." << std::endl;
+
+    const int n = 1000000;
+    CompactUnionSet<> set(n);
+    for (int i = 1; i < n; i++) {
+        assert(set.merge(i - 1, i));
+    }
+    assert(set.getSetCount() == 1);
+    assert(set.getSetSize(n / 2) == n);
+
+    const CompactUnionSet<>& view = set;
+    for (int i = 0; i < n; i += 1000) {
+        assert(view.isConnected(0, i));
+    }
+
+    std::cout << "Large set test passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Starting CompactUnionSet tests..." << std::endl;
+
+    testBasicOperations();
+    testData();
+    testEdgeCases();
+    testRandomAgainstNaive();
+    testLargeSet();
+
+    std::cout << "All tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,147 @@
+#ifndef CONCURRENT_UNION_SET_HPP
+#define CONCURRENT_UNION_SET_HPP
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+// Lock-free disjoint-set for concurrent merge/find from many threads
+// (Jayanti-Tarjan style):
+// - every parent slot is an atomic index, links are made by CAS on a root
+// - randomized linking by index: of two roots, the one with the lower
+//   priority (a fixed bijective hash of its index) goes below the other,
+//   which keeps trees O(log n) deep in expectation without rank or size
+// - find uses path splitting; the splitting CAS is relaxed and may fail
+//   harmlessly, since it only ever replaces a parent with an ancestor
+// Index is the signed index type, as in CompactUnionSet.
+template<typename Index = std::int32_t>
+class ConcurrentUnionSet {
+    static_assert(std::is_integral<Index>::value && std::is_signed<Index>::value,
+                  "Index must be a signed integer type");
+
+private:
+    typedef typename std::make_unsigned<Index>::type Key;
+
+    std::unique_ptr<std::atomic<Index>[]> parent;  // Parent index, roots point to themselves
+    Index size;                                    // Number of elements
+    std::atomic<Index> setCount;                   // Number of distinct sets
+
+    // Linking priority: a bijection on Key (xor-shifts and an odd multiplier), so only equal indices tie
+    static Key priority(Index x) {
+        std::uint64_t k = static_cast<Key>(x);
+        k ^= k >> (sizeof(Key) * 4);
+        k = static_cast<Key>(k * 0x9E3779B97F4A7C15ULL);
+        k ^= k >> (sizeof(Key) * 4 - 3);
+        return static_cast<Key>(k);
+    }
+
+    // Root of x with path splitting: every node on the path is pointed at its
+    // grandparent, then the walk continues from its old parent
+    Index findRoot(Index x) const {
+        for (;;) {
+            Index p = parent[x].load(std::memory_order_acquire);
+            Index gp = parent[p].load(std::memory_order_acquire);
+            if (p == gp) {
+                return p;
+            }
+            parent[x].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+            x = p;
+        }
+    }
+
+    void checkIndex(Index x) const {
+        if (x < 0 || x >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+    }
+
+public:
+    // Constructor
+    explicit ConcurrentUnionSet(Index n) {
+        if (n <= 0) {
+            throw std::invalid_argument("Size must be positive");
+        }
+        size = n;
+        setCount.store(n);
+        parent.reset(new std::atomic<Index>[static_cast<size_t>(n)]);
+        for (Index i = 0; i < n; ++i) {
+            parent[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ConcurrentUnionSet(const ConcurrentUnionSet&) = delete;
+    ConcurrentUnionSet& operator=(const ConcurrentUnionSet&) = delete;
+
+    // Find the current representative of the set containing x, thread-safe.
+    // The result may stop being a root as soon as another thread merges it
+    Index find(Index x) const {
+        checkIndex(x);
+        return findRoot(x);
+    }
+
+    // Merge the sets containing x and y, thread-safe.
+    // Returns true if this call linked two sets, so across all threads the
+    // number of true results equals the number of merges that happened
+    bool merge(Index x, Index y) {
+        checkIndex(x);
+        checkIndex(y);
+
+        for (;;) {
+            Index rootX = findRoot(x);
+            Index rootY = findRoot(y);
+            if (rootX == rootY) {
+                return false;  // Already in same set
+            }
+
+            // The root with the lower priority is linked below the other
+            if (priority(rootX) > priority(rootY)) {
+                std::swap(rootX, rootY);
+            }
+            Index expected = rootX;
+            if (parent[rootX].compare_exchange_strong(expected, rootY, std::memory_order_acq_rel)) {
+                setCount.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+            // rootX was linked by another thread in the meantime, retry from the old roots
+            x = rootX;
+            y = rootY;
+        }
+    }
+
+    // Check if two elements are in the same set, thread-safe.
+    // A true answer stays true; false means they were apart at some point during the call
+    bool isConnected(Index x, Index y) const {
+        checkIndex(x);
+        checkIndex(y);
+
+        for (;;) {
+            Index rootX = findRoot(x);
+            Index rootY = findRoot(y);
+            if (rootX == rootY) {
+                return true;
+            }
+            // Two different roots, and rootX is still a root after rootY was found
+            if (parent[rootX].load(std::memory_order_seq_cst) == rootX) {
+                return false;
+            }
+            x = rootX;
+            y = rootY;
+        }
+    }
+
+    // Get the number of elements
+    Index getSize() const {
+        return size;
+    }
+
+    // Get number of distinct sets, exact once no merge is in progress
+    Index getSetCount() const {
+        return setCount.load(std::memory_order_relaxed);
+    }
+};
+
+#endif // CONCURRENT_UNION_SET_HPP
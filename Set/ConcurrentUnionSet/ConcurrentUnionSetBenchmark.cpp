@@ -0,0 +1,134 @@
+#include <iostream>
+#include <iomanip>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ConcurrentUnionSet.hpp"
+#include "../CompactUnionSet/CompactUnionSet.hpp"
+#include "../../Graphic/ChainForwardStar/ChainForwardStar.hpp"
+
+// Connected components of a random directed graph stored in a ChainForwardStar
+// (default 2^20 vertices, 2^22 edges with uniformly random endpoints).
+//   sequential : one thread, CompactUnionSet, merge every edge
+//   t=1, 2, 4  : ConcurrentUnionSet, threads take blocks of 1024 vertices from
+//                a shared counter and merge along their out-edges
+// Reported as ms and millions of edges per second, best of 3.
+// Usage: ./ConcurrentUnionSetBenchmark [max threads N] [vertices] [edges]
+
+typedef std::chrono::steady_clock Clock;
+
+static const size_t MAX_EDGES = 1 << 24;
+static const int BLOCK = 1024;
+
+typedef ChainForwardStar<char, MAX_EDGES> Graph;
+
+static volatile long sink;
+
+static std::uint32_t nextRandom(std::uint32_t& seed) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+static double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Returns the number of components through count
+double runSequential(const Graph& graph, int& count) {
+    int n = graph.getVertexCount();
+    Clock::time_point start = Clock::now();
+    CompactUnionSet<> set(n);
+    for (int v = 0; v < n; ++v) {
+        graph.forEachEdge(v, [&](int to, int) { set.merge(v, to); });
+    }
+    double ms = elapsedMs(start);
+    count = set.getSetCount();
+    return ms;
+}
+
+double runConcurrent(const Graph& graph, int threads, int& count) {
+    int n = graph.getVertexCount();
+    Clock::time_point start = Clock::now();
+    ConcurrentUnionSet<> set(n);
+    std::atomic<int> next(0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.push_back(std::thread([&]() {
+            for (;;) {
+                int begin = next.fetch_add(BLOCK);
+                if (begin >= n) {
+                    break;
+                }
+                int end = begin + BLOCK < n ? begin + BLOCK : n;
+                for (int v = begin; v < end; ++v) {
+                    graph.forEachEdge(v, [&](int to, int) { set.merge(v, to); });
+                }
+            }
+        }));
+    }
+    for (size_t i = 0; i < workers.size(); ++i) {
+        workers[i].join();
+    }
+    double ms = elapsedMs(start);
+    count = set.getSetCount();
+    return ms;
+}
+
+template<typename F>
+double best3(F f) {
+    double best = 0;
+    for (int round = 0; round < 3; ++round) {
+        double t = f();
+        if (round == 0 || t < best) best = t;
+    }
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    int maxThreads = argc > 1 ? std::atoi(argv[1]) : 16;
+    int n = argc > 2 ? std::atoi(argv[2]) : 1 << 20;
+    long m = argc > 3 ? std::atol(argv[3]) : 1L << 22;
+    if (maxThreads < 1) maxThreads = 1;
+    if (n < 1) n = 1;
+    if (m > static_cast<long>(MAX_EDGES)) m = MAX_EDGES;
+
+    Graph graph(n);
+    std::uint32_t seed = 2463534242u;
+    for (long i = 0; i < m; ++i) {
+        int from = static_cast<int>(nextRandom(seed) % static_cast<std::uint32_t>(n));
+        int to = static_cast<int>(nextRandom(seed) % static_cast<std::uint32_t>(n));
+        graph.addEdge(from, to);
+    }
+
+    int expected = 0;
+    double sequential = best3([&]() { return runSequential(graph, expected); });
+    std::cout << "Connected components: " << n << " vertices, " << m << " edges, "
+              << expected << " components, " << std::thread::hardware_concurrency()
+              << " hardware threads, best of 3" << std::endl;
+    std::cout << std::setw(12) << "" << std::setw(12) << "ms" << std::setw(12) << "Medges/s" << std::endl;
+    std::cout << std::fixed << std::setprecision(1)
+              << std::setw(12) << "sequential" << std::setw(12) << sequential
+              << std::setw(12) << m / sequential / 1e3 << std::endl;
+
+    for (int t = 1; t <= maxThreads; t *= 2) {
+        int count = 0;
+        double ms = best3([&]() { return runConcurrent(graph, t, count); });
+        if (count != expected) {
+            std::cout << "result mismatch" << std::endl;
+            return 1;
+        }
+        sink = sink + count;
+        std::cout << std::setw(12) << "t=" + std::to_string(t)
+                  << std::setw(12) << ms << std::setw(12) << m / ms / 1e3 << std::endl;
+        if (t < maxThreads && t * 2 > maxThreads) {
+            t = maxThreads / 2;   // The last round uses maxThreads
+        }
+    }
+    return 0;
+}
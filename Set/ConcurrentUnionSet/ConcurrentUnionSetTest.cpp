@@ -0,0 +1,215 @@
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "ConcurrentUnionSet.hpp"
+#include "../CompactUnionSet/CompactUnionSet.hpp"
+
+static std::uint32_t nextRandom(std::uint32_t& seed) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+void testBasicOperations() {
+    std::cout << "Testing basic operations..." << std::endl;
+
+    ConcurrentUnionSet<> set(6);
+    assert(set.getSize() == 6);
+    assert(set.getSetCount() == 6);
+    for (int i = 0; i < 6; i++) {
+        assert(set.find(i) == i);
+    }
+
+    assert(set.merge(0, 1));     // {0,1} {2} {3} {4} {5}
+    assert(!set.merge(1, 0));
+    assert(!set.merge(2, 2));
+    assert(set.merge(2, 3));     // {0,1} {2,3} {4} {5}
+    assert(set.merge(3, 4));     // {0,1} {2,3,4} {5}
+    assert(set.getSetCount() == 3);
+    assert(set.isConnected(2, 4));
+    assert(!set.isConnected(0, 2));
+    assert(set.find(2) == set.find(4));
+
+    assert(set.merge(1, 4));
+    assert(set.isConnected(0, 3));
+    assert(!set.isConnected(5, 0));
+    assert(set.getSetCount() == 2);
+
+    std::cout << "Basic operations test passed!" << std::endl;
+}
+
+void testEdgeCases() {
+    std::cout << "Testing edge cases..." << std::endl;
+
+    try {
+        ConcurrentUnionSet<> set(0);
+        assert(false);
+    } catch (const std::invalid_argument& e) {
+        // Expected exception
+    }
+
+    ConcurrentUnionSet<std::int64_t> set(3);
+    try {
+        set.find(3);
+        assert(false);
+    } catch (const std::out_of_range& e) {
+        // Expected exception
+    }
+    try {
+        set.merge(-1, 0);
+        assert(false);
+    } catch (const std::out_of_range& e) {
+        // Expected exception
+    }
+    try {
+        set.isConnected(0, 3);
+        assert(false);
+    } catch (const std::out_of_range& e) {
+        // Expected exception
+    }
+
+    std::cout << "Edge cases test passed!" << std::endl;
+}
+
+// Single-threaded random sequence against CompactUnionSet, with several index widths
+template<typename Index>
+void checkAgainstSequential() {
+    const int n = 5000;
+    ConcurrentUnionSet<Index> set(n);
+    CompactUnionSet<void, Index> reference(n);
+    std::uint32_t seed = 12345;
+    for (int step = 0; step < 20000; step++) {
+        int x = nextRandom(seed) % n;
+        int y = nextRandom(seed) % n;
+        if (step % 3 == 0) {
+            assert(set.isConnected(x, y) == reference.isConnected(x, y));
+        } else {
+            assert(set.merge(x, y) == reference.merge(x, y));
+        }
+        assert(set.getSetCount() == reference.getSetCount());
+    }
+}
+
+void testAgainstSequential() {
+    std::cout << "Testing against sequential union-find..." << std::endl;
+
+    checkAgainstSequential<std::int16_t>();
+    checkAgainstSequential<std::int32_t>();
+    checkAgainstSequential<std::int64_t>();
+
+    std::cout << "Sequential comparison test passed!" << std::endl;
+}
+
+// Many threads merge disjoint slices of one random edge list; the final
+// partition must match the sequential one and the true results must add up
+void testConcurrentMerge() {
+    std::cout << "Testing concurrent merges..." << std::endl;
+
+    const int n = 50000;
+    const int edges = 100000;
+    const int threads = 8;
+    std::vector<int> from(edges), to(edges);
+    std::uint32_t seed = 2463534242u;
+    for (int i = 0; i < edges; i++) {
+        from[i] = nextRandom(seed) % n;
+        to[i] = nextRandom(seed) % n;
+    }
+    CompactUnionSet<> reference(n);
+    for (int i = 0; i < edges; i++) {
+        reference.merge(from[i], to[i]);
+    }
+
+    for (int round = 0; round < 20; round++) {
+        ConcurrentUnionSet<> set(n);
+        std::atomic<int> linked(0);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; t++) {
+            workers.push_back(std::thread([&, t]() {
+                int local = 0;
+                for (int i = t; i < edges; i += threads) {
+                    local += set.merge(from[i], to[i]);
+                }
+                linked.fetch_add(local);
+            }));
+        }
+        for (size_t i = 0; i < workers.size(); i++) workers[i].join();
+
+        assert(set.getSetCount() == reference.getSetCount());
+        assert(linked.load() == n - reference.getSetCount());
+        for (int i = 0; i < n; i++) {
+            assert(set.isConnected(i, reference.find(i)));
+            assert(set.find(i) == set.find(reference.find(i)));
+        }
+    }
+
+    std::cout << "Concurrent merge test passed!" << std::endl;
+}
+
+// Queries racing with merges: every pair already merged by the querying
+// thread must be connected, and a connected answer must never be revoked
+void testConcurrentQueries() {
+    std::cout << "Testing queries during merges..." << std::endl;
+
+    const int n = 4096;
+    const int threads = 6;
+    ConcurrentUnionSet<> set(n);
+    std::atomic<bool> done(false);
+
+    // Writers each chain their own stripe i, i + threads, i + 2 * threads, ...
+    // and finally join the stripes, so the result is a single set
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.push_back(std::thread([&, t]() {
+            for (int i = t + threads; i < n; i += threads) {
+                set.merge(i - threads, i);
+                assert(set.isConnected(t, i));
+            }
+            if (t > 0) {
+                set.merge(t - 1, t);
+            }
+        }));
+    }
+
+    // Readers check that connectivity is monotonic
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 2; r++) {
+        readers.push_back(std::thread([&, r]() {
+            std::vector<char> seen(n, 0);
+            std::uint32_t seed = 777u + r;
+            while (!done.load()) {
+                int x = nextRandom(seed) % n;
+                bool connected = set.isConnected(0, x);
+                assert(connected || !seen[x]);
+                if (connected) seen[x] = 1;
+            }
+        }));
+    }
+    for (size_t i = 0; i < workers.size(); i++) workers[i].join();
+    done.store(true);
+    for (size_t i = 0; i < readers.size(); i++) readers[i].join();
+
+    assert(set.getSetCount() == 1);
+    for (int i = 0; i < n; i++) {
+        assert(set.isConnected(0, i));
+    }
+
+    std::cout << "Concurrent query test passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Starting ConcurrentUnionSet tests..." << std::endl;
+
+    testBasicOperations();
+    testEdgeCases();
+    testAgainstSequential();
+    testConcurrentMerge();
+    testConcurrentQueries();
+
+    std::cout << "All tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -4,37 +4,65 @@
 #include <iostream>
 #include <vector>
 #include <stdexcept>
+#include <utility>
 
+// Which root becomes the parent when two sets are merged
+enum class UnionBy {
+    Rank,   // the root with the higher rank (upper bound of tree height)
+    Size    // the root of the larger set
+};
+
+// Disjoint-set with union by rank or by size and path halving.
+// The const queries (find, isConnected, getSetSize) also compress paths and
+// therefore write to the parent array: a UnionSet shared between threads
+// needs external synchronization even if every thread only queries it.
+// For concurrent merges and queries use ConcurrentUnionSet instead.
 template<typename T>
 class UnionSet {
 private:
-    std::vector<int> parent;  // Parent array
+    mutable std::vector<int> parent;  // Parent array, compressed by const queries as well
+    // Only the array used by the strategy is allocated, so merge reads one extra array
     std::vector<int> rank;    // Rank array for union by rank
+    std::vector<int> sizes;   // Set sizes for union by size, valid for roots only
     std::vector<T> data;      // Data array
     int size;                 // Size of the set
+    int setCount;             // Number of distinct sets
+    UnionBy strategy;         // Linking rule used by merge
+
+    // Iterative find with path halving: every node on the path is pointed
+    // at its grandparent, which halves the path length in a single pass
+    int findRoot(int x) const {
+        while (parent[x] != x) {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    }
 
     // Private const version of find for use in const member functions
     int find(int x) const {
         if (x < 0 || x >= size) {
             throw std::out_of_range("Index out of range");
         }
-        // For const version, we can't modify the parent array
-        int current = x;
-        while (current != parent[current]) {
-            current = parent[current];
-        }
-        return current;
+        return findRoot(x);
     }
 
 public:
     // Constructor
-    explicit UnionSet(int n) {
+    explicit UnionSet(int n, UnionBy by = UnionBy::Rank) {
         if (n <= 0) {
             throw std::invalid_argument("Size must be positive");
         }
         size = n;
+        setCount = n;
+        strategy = by;
         parent.resize(n);
-        rank.resize(n, 1);
+        if (by == UnionBy::Rank) {
+            rank.resize(n, 1);
+        }
+        else {
+            sizes.resize(n, 1);
+        }
         data.resize(n);
         
         // Initialize each element as its own set
@@ -47,8 +75,11 @@ public:
     UnionSet(const UnionSet& other) 
         : parent(other.parent)
         , rank(other.rank)
+        , sizes(other.sizes)
         , data(other.data)
-        , size(other.size) {
+        , size(other.size)
+        , setCount(other.setCount)
+        , strategy(other.strategy) {
     }
 
     // Assignment operator
@@ -56,8 +87,11 @@ public:
         if (this != &other) {
             parent = other.parent;
             rank = other.rank;
+            sizes = other.sizes;
             data = other.data;
             size = other.size;
+            setCount = other.setCount;
+            strategy = other.strategy;
         }
         return *this;
     }
@@ -83,34 +117,38 @@ public:
         if (x < 0 || x >= size) {
             throw std::out_of_range("Index out of range");
         }
-        if (x != parent[x]) {
-            parent[x] = find(parent[x]);  // Path compression
-        }
-        return parent[x];
+        return findRoot(x);
     }
 
-    // Union operation with rank
-    void merge(int x, int y) {
+    // Union operation by rank or by size, returns false if x and y were already in the same set
+    bool merge(int x, int y) {
         if (x < 0 || x >= size || y < 0 || y >= size) {
             throw std::out_of_range("Index out of range");
         }
         
-        int rootX = find(x);
-        int rootY = find(y);
+        int rootX = findRoot(x);
+        int rootY = findRoot(y);
 
-        if (rootX == rootY) return;  // Already in same set
+        if (rootX == rootY) return false;  // Already in same set
 
-        // Union by rank
-        if (rank[rootX] < rank[rootY]) {
-            parent[rootX] = rootY;
-        }
-        else if (rank[rootX] > rank[rootY]) {
-            parent[rootY] = rootX;
+        // Make rootY the new root
+        if (strategy == UnionBy::Rank) {
+            if (rank[rootX] > rank[rootY]) {
+                std::swap(rootX, rootY);
+            }
+            else if (rank[rootX] == rank[rootY]) {
+                rank[rootY]++;
+            }
         }
         else {
-            parent[rootX] = rootY;
-            rank[rootY]++;
+            if (sizes[rootX] > sizes[rootY]) {
+                std::swap(rootX, rootY);
+            }
+            sizes[rootY] += sizes[rootX];
         }
+        parent[rootX] = rootY;
+        --setCount;
+        return true;
     }
 
     // Check if two elements are in the same set
@@ -128,20 +166,30 @@ public:
 
     // Get number of distinct sets
     int getSetCount() const {
-        int count = 0;
-        for (int i = 0; i < size; i++) {
-            if (parent[i] == i) {
-                count++;
-            }
+        return setCount;
+    }
+
+    // Get the number of elements in the set containing x, only maintained with union by size
+    int getSetSize(int x) const {
+        if (strategy != UnionBy::Size) {
+            throw std::runtime_error("Set sizes are only maintained with union by size");
         }
-        return count;
+        return sizes[find(x)];
     }
 
-    // Get the rank of an element
+    // Get the linking rule used by merge
+    UnionBy getStrategy() const {
+        return strategy;
+    }
+
+    // Get the rank of an element, only maintained with union by rank
     int getRank(int x) const {
         if (x < 0 || x >= size) {
             throw std::out_of_range("Index out of range");
         }
+        if (strategy != UnionBy::Rank) {
+            throw std::runtime_error("Ranks are only maintained with union by rank");
+        }
         return rank[x];
     }
 };
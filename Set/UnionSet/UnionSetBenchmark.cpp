@@ -0,0 +1,177 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+#include "UnionSet.hpp"
+
+// Random union/find on n elements (default 10^7):
+//   merge   : n merges of uniformly random pairs
+//   query   : n isConnected calls on random pairs (the const path)
+//   count   : 100 calls to getSetCount
+// Columns compare the previous implementation (recursive find, const find
+// without compression, O(n) getSetCount) against the current one with
+// union by rank and union by size. Times are ms, best of 3.
+// Usage: ./UnionSetBenchmark [n]
+
+typedef std::chrono::steady_clock Clock;
+
+static volatile long sink;
+
+// The previous implementation, kept for comparison
+class LegacyUnionSet {
+private:
+    std::vector<int> parent;
+    std::vector<int> rank;
+    std::vector<int> data;
+    int size;
+
+    int find(int x) const {
+        int current = x;
+        while (current != parent[current]) {
+            current = parent[current];
+        }
+        return current;
+    }
+
+public:
+    explicit LegacyUnionSet(int n) : parent(n), rank(n, 1), data(n), size(n) {
+        for (int i = 0; i < n; ++i) {
+            parent[i] = i;
+        }
+    }
+
+    int find(int x) {
+        if (x != parent[x]) {
+            parent[x] = find(parent[x]);
+        }
+        return parent[x];
+    }
+
+    void merge(int x, int y) {
+        int rootX = find(x);
+        int rootY = find(y);
+        if (rootX == rootY) return;
+        if (rank[rootX] < rank[rootY]) {
+            parent[rootX] = rootY;
+        }
+        else if (rank[rootX] > rank[rootY]) {
+            parent[rootY] = rootX;
+        }
+        else {
+            parent[rootX] = rootY;
+            rank[rootY]++;
+        }
+    }
+
+    bool isConnected(int x, int y) const {
+        return find(x) == find(y);
+    }
+
+    int getSetCount() const {
+        int count = 0;
+        for (int i = 0; i < size; i++) {
+            if (parent[i] == i) {
+                count++;
+            }
+        }
+        return count;
+    }
+};
+
+struct Timing {
+    double merge;
+    double query;
+    double count;
+    long check;
+};
+
+static std::uint32_t nextRandom(std::uint32_t& seed) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+static double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+template<typename Set>
+Timing run(Set& set, const std::vector<int>& ops) {
+    Timing t;
+    size_t half = ops.size() / 2;
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < half; i += 2) {
+        set.merge(ops[i], ops[i + 1]);
+    }
+    t.merge = elapsedMs(start);
+
+    const Set& view = set;
+    long connected = 0;
+    start = Clock::now();
+    for (size_t i = half; i < ops.size(); i += 2) {
+        connected += view.isConnected(ops[i], ops[i + 1]);
+    }
+    t.query = elapsedMs(start);
+
+    long count = 0;
+    start = Clock::now();
+    for (int i = 0; i < 100; ++i) {
+        count += view.getSetCount();
+    }
+    t.count = elapsedMs(start);
+    t.check = connected * 1000 + count / 100;
+    return t;
+}
+
+template<typename Set, typename Make>
+Timing best3(Make make, const std::vector<int>& ops) {
+    Timing best = {0, 0, 0, 0};
+    for (int round = 0; round < 3; ++round) {
+        std::unique_ptr<Set> set(make());
+        Timing t = run(*set, ops);
+        if (round == 0 || t.merge < best.merge) best.merge = t.merge;
+        if (round == 0 || t.query < best.query) best.query = t.query;
+        if (round == 0 || t.count < best.count) best.count = t.count;
+        best.check = t.check;
+        sink = sink + t.check;
+    }
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc > 1 ? std::atoi(argv[1]) : 10000000;
+    if (n < 2) {
+        n = 2;
+    }
+
+    // n merges followed by n queries, each a pair of indices
+    std::uint32_t seed = 2463534242u;
+    std::vector<int> ops(4 * static_cast<size_t>(n));
+    for (size_t i = 0; i < ops.size(); ++i) {
+        ops[i] = static_cast<int>(nextRandom(seed) % static_cast<std::uint32_t>(n));
+    }
+
+    Timing legacy = best3<LegacyUnionSet>([n]() { return new LegacyUnionSet(n); }, ops);
+    Timing rank = best3<UnionSet<int>>([n]() { return new UnionSet<int>(n, UnionBy::Rank); }, ops);
+    Timing bySize = best3<UnionSet<int>>([n]() { return new UnionSet<int>(n, UnionBy::Size); }, ops);
+    if (legacy.check != rank.check || legacy.check != bySize.check) {
+        std::cout << "result mismatch" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Random union/find on " << n << " elements, ms (best of 3)" << std::endl;
+    std::cout << std::setw(10) << "" << std::setw(12) << "legacy" << std::setw(12) << "rank"
+              << std::setw(12) << "size" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << std::setw(10) << "merge" << std::setw(12) << legacy.merge << std::setw(12) << rank.merge
+              << std::setw(12) << bySize.merge << std::endl;
+    std::cout << std::setw(10) << "query" << std::setw(12) << legacy.query << std::setw(12) << rank.query
+              << std::setw(12) << bySize.query << std::endl;
+    std::cout << std::setw(10) << "count" << std::setw(12) << legacy.count << std::setw(12) << rank.count
+              << std::setw(12) << bySize.count << std::endl;
+    return 0;
+}
@@ -1,6 +1,8 @@
 #include <iostream>
 #include <cassert>
 #include <string>
+#include <vector>
+#include <cstdlib>
 #include "UnionSet.hpp"
 
 void testBasicOperations() {
@@ -147,6 +149,129 @@ void testWithCustomType() {
     std::cout << "Custom type test passed!" << std::endl;
 }
 
+void testMergeResult() {
+    std::cout << "Testing merge result and set sizes..." << std::endl;
+    
+    UnionSet<int> set(5, UnionBy::Size);
+    assert(set.merge(0, 1));   // Union happened
+    assert(!set.merge(1, 0));  // Already in same set
+    assert(!set.merge(2, 2));
+    assert(set.getSetCount() == 4);
+    
+    assert(set.merge(2, 3));
+    assert(set.merge(3, 1));
+    assert(!set.merge(0, 2));
+    assert(set.getSetCount() == 2);
+    assert(set.getSetSize(0) == 4);
+    assert(set.getSetSize(3) == 4);
+    assert(set.getSetSize(4) == 1);
+    
+    std::cout << "Merge result test passed!" << std::endl;
+}
+
+void testUnionBySize() {
+    std::cout << "Testing union by size..." << std::endl;
+    
+    UnionSet<int> set(6, UnionBy::Size);
+    assert(set.getStrategy() == UnionBy::Size);
+    set.merge(0, 1);
+    set.merge(0, 2);  // {0,1,2} {3} {4} {5}
+    set.merge(3, 4);  // {0,1,2} {3,4} {5}
+    
+    // The smaller set is always attached below the root of the larger one
+    int root = set.find(0);
+    set.merge(3, 0);
+    assert(set.find(4) == root);
+    set.merge(5, 4);
+    assert(set.find(5) == root);
+    assert(set.getSetCount() == 1);
+    assert(set.getSetSize(5) == 6);
+    
+    // Strategy survives copying
+    UnionSet<int> copy(set);
+    assert(copy.getStrategy() == UnionBy::Size);
+    
+    // Ranks are only maintained with union by rank and set sizes only with union by size
+    try {
+        set.getRank(0);
+        assert(false);
+    } catch (const std::runtime_error& e) {
+        // Expected exception
+    }
+    UnionSet<int> byRank(2);
+    try {
+        byRank.getSetSize(0);
+        assert(false);
+    } catch (const std::runtime_error& e) {
+        // Expected exception
+    }
+    
+    std::cout << "Union by size test passed!" << std::endl;
+}
+
+// Compare both strategies against a naive labelling on a random sequence
+void testRandomAgainstNaive() {
+    std::cout << "Testing random operations against naive labelling..." << std::endl;
+    
+    const int n = 2000;
+    UnionBy strategies[] = {UnionBy::Rank, UnionBy::Size};
+    for (UnionBy by : strategies) {
+        UnionSet<int> set(n, by);
+        std::vector<int> label(n);
+        for (int i = 0; i < n; i++) label[i] = i;
+        int count = n;
+        std::srand(7);
+        for (int step = 0; step < 3000; step++) {
+            int x = std::rand() % n;
+            int y = std::rand() % n;
+            if (step % 2 == 0) {
+                bool expected = label[x] != label[y];
+                if (expected) {
+                    int from = label[x];
+                    for (int i = 0; i < n; i++) {
+                        if (label[i] == from) label[i] = label[y];
+                    }
+                    count--;
+                }
+                assert(set.merge(x, y) == expected);
+                assert(set.getSetCount() == count);
+            } else {
+                assert(set.isConnected(x, y) == (label[x] == label[y]));
+            }
+        }
+        for (int i = 0; by == UnionBy::Size && i < n; i++) {
+            int members = 0;
+            for (int j = 0; j < n; j++) {
+                if (label[j] == label[i]) members++;
+            }
+            assert(set.getSetSize(i) == members);
+        }
+    }
+    
+    std::cout << "Random operations test passed!" << std::endl;
+}
+
+void testLargeSet() {
+    std::cout << "Testing a large set..." << std::endl;
+    
+    // A single set of a million elements must not exhaust the stack in find
+    const int n = 1000000;
+    UnionSet<char> set(n, UnionBy::Size);
+    for (int i = 1; i < n; i++) {
+        assert(set.merge(i - 1, i));
+    }
+    assert(set.getSetCount() == 1);
+    assert(set.getSetSize(n / 2) == n);
+    
+    // Const queries compress paths as well
+    const UnionSet<char>& view = set;
+    for (int i = 0; i < n; i += 1000) {
+        assert(view.isConnected(0, i));
+    }
+    
+    std::cout << "Large set test passed!" << std::endl;
+}
+
 int main() {
     std::cout << "Starting UnionSet tests..." << std::endl;
     
@@ -155,6 +280,10 @@ int main() {
     testCopyAndAssignment();
     testEdgeCases();
     testWithCustomType();
+    testMergeResult();
+    testUnionBySize();
+    testRandomAgainstNaive();
+    testLargeSet();
     
     std::cout << "All tests passed successfully!" << std::endl;
     return 0;
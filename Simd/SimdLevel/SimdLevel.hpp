@@ -0,0 +1,64 @@
+#ifndef SIMD_LEVEL_HPP
+#define SIMD_LEVEL_HPP
+
+// 向量化内核共用的指令集级别：运行时检测 CPU 支持的最高级别，
+// 并提供一个全局开关指定实际使用的级别。HeapSimd.hpp 和 SeqListSimd.hpp 的内核
+// 都按这里的级别分派，setLevel 对所有模块同时生效。
+// 非 GCC/Clang 或非 x86 平台上级别固定为 LevelScalar。
+
+#include <atomic>
+
+namespace simd {
+
+enum Level {
+    LevelScalar = 0,
+    LevelSSE41 = 1,
+    LevelAVX2 = 2
+};
+
+namespace detail {
+
+inline int detectLevel() {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return LevelAVX2;
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+        return LevelSSE41;
+    }
+#endif
+    return LevelScalar;
+}
+
+inline int supportedLevel() {
+    static const int level = detectLevel();
+    return level;
+}
+
+inline std::atomic<int>& activeLevel() {
+    static std::atomic<int> level(supportedLevel());
+    return level;
+}
+
+} // namespace detail
+
+// 当前 CPU 支持的最高指令集
+inline Level supportedLevel() {
+    return static_cast<Level>(detail::supportedLevel());
+}
+
+// 当前使用的指令集
+inline Level level() {
+    return static_cast<Level>(detail::activeLevel().load(std::memory_order_relaxed));
+}
+
+// 指定使用的指令集（用于测试和性能对比），不会超过 CPU 实际支持的级别
+inline void setLevel(Level value) {
+    int supported = detail::supportedLevel();
+    detail::activeLevel().store(value < supported ? value : supported, std::memory_order_relaxed);
+}
+
+} // namespace simd
+
+#endif // SIMD_LEVEL_HPP
@@ -2,6 +2,9 @@
 #define SEQ_STACK_HPP
 
 #include <iostream>
+#include <new>
+#include <stdexcept>
+#include <utility>
 
 template<typename T>
 class SeqStack {
@@ -9,41 +12,116 @@ private:
     T* data;
     int maxSize;
     int top;
+    bool growable;
+
+    // Allocate raw storage for n elements without constructing them
+    static T* allocate(int n) {
+        return static_cast<T*>(::operator new(sizeof(T) * n));
+    }
+
+    // Destroy the live elements [0, top] and release the storage
+    void release() {
+        for (int i = 0; i <= top; ++i) {
+            data[i].~T();
+        }
+        ::operator delete(data);
+    }
+
+    // Move the live elements into a new buffer of the given capacity
+    void reallocate(int newSize) {
+        T* newData = allocate(newSize);
+        int i = 0;
+        try {
+            for (; i <= top; ++i) {
+                new (newData + i) T(std::move_if_noexcept(data[i]));
+            }
+        } catch (...) {
+            while (i-- > 0) {
+                newData[i].~T();
+            }
+            ::operator delete(newData);
+            throw;
+        }
+        release();
+        data = newData;
+        maxSize = newSize;
+    }
+
+    // Make room for one more element, growing geometrically if allowed
+    bool ensureSpace() {
+        if (!full()) {
+            return true;
+        }
+        if (!growable) {
+            return false;
+        }
+        reallocate(maxSize > 0 ? maxSize * 2 : 1);
+        return true;
+    }
 
 public:
     // Constructor
-    explicit SeqStack(int size = 10) : maxSize(size), top(-1) {
-        data = new T[size];
+    explicit SeqStack(int size = 10, bool grow = false)
+        : maxSize(size), top(-1), growable(grow) {
+        if (size <= 0) {
+            throw std::invalid_argument("Stack size must be positive");
+        }
+        data = allocate(size);
     }
 
     // Destructor
     ~SeqStack() {
-        delete[] data;
+        release();
     }
 
     // Copy constructor (Rule of 3)
-    SeqStack(const SeqStack& other) : maxSize(other.maxSize), top(other.top) {
-        data = new T[maxSize];
-        for (int i = 0; i <= top; ++i) {
-            data[i] = other.data[i];
+    SeqStack(const SeqStack& other)
+        : maxSize(other.maxSize), top(-1), growable(other.growable) {
+        data = allocate(maxSize);
+        try {
+            for (int i = 0; i <= other.top; ++i) {
+                new (data + i) T(other.data[i]);
+                top = i;
+            }
+        } catch (...) {
+            release();
+            throw;
         }
     }
 
     // Assignment operator (Rule of 3)
     SeqStack& operator=(const SeqStack& other) {
         if (this != &other) {
-            T* newData = new T[other.maxSize];
-            for (int i = 0; i <= other.top; ++i) {
-                newData[i] = other.data[i];
-            }
-            delete[] data;
-            data = newData;
-            maxSize = other.maxSize;
-            top = other.top;
+            SeqStack temp(other);
+            swap(temp);
         }
         return *this;
     }
 
+    // Move constructor
+    SeqStack(SeqStack&& other) noexcept
+        : data(other.data), maxSize(other.maxSize), top(other.top), growable(other.growable) {
+        other.data = nullptr;
+        other.maxSize = 0;
+        other.top = -1;
+    }
+
+    // Move assignment operator
+    SeqStack& operator=(SeqStack&& other) noexcept {
+        if (this != &other) {
+            swap(other);
+        }
+        return *this;
+    }
+
+    // Exchange contents with another stack
+    void swap(SeqStack& other) noexcept {
+        std::swap(data, other.data);
+        std::swap(maxSize, other.maxSize);
+        std::swap(top, other.top);
+        std::swap(growable, other.growable);
+    }
+
     // Check if stack is empty
     bool empty() const {
         return top == -1;
@@ -56,10 +134,37 @@ public:
 
     // Push element onto stack
     bool push(const T& x) {
+        if (full() && growable) {
+            // x may refer to an element of this stack, copy it before reallocating
+            T copy(x);
+            return push(std::move(copy));
+        }
         if (full()) {
             return false;
         }
-        data[++top] = x;
+        new (data + top + 1) T(x);
+        ++top;
+        return true;
+    }
+
+    // Push element onto stack by moving it
+    bool push(T&& x) {
+        if (!ensureSpace()) {
+            return false;
+        }
+        new (data + top + 1) T(std::move(x));
+        ++top;
+        return true;
+    }
+
+    // Construct element in place on top of stack
+    template<typename... Args>
+    bool emplace(Args&&... args) {
+        if (!ensureSpace()) {
+            return false;
+        }
+        new (data + top + 1) T(std::forward<Args>(args)...);
+        ++top;
         return true;
     }
 
@@ -68,7 +173,8 @@ public:
         if (empty()) {
             return false;
         }
-        e = data[top--];
+        e = std::move(data[top]);
+        data[top--].~T();
         return true;
     }
 
@@ -90,6 +196,31 @@ public:
     int capacity() const {
         return maxSize;
     }
-}; 
+
+    // Check if stack grows automatically when full
+    bool isGrowable() const {
+        return growable;
+    }
+
+    // Enable or disable automatic growth
+    void setGrowable(bool value) {
+        growable = value;
+    }
+
+    // Ensure capacity for at least n elements
+    void reserve(int n) {
+        if (n > maxSize) {
+            reallocate(n);
+        }
+    }
+
+    // Release unused capacity (keeps room for at least one element)
+    void shrink_to_fit() {
+        int newSize = size() > 0 ? size() : 1;
+        if (newSize < maxSize) {
+            reallocate(newSize);
+        }
+    }
+};
 
 #endif // SEQ_STACK_HPP
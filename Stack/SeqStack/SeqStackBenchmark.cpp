@@ -0,0 +1,99 @@
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <stack>
+#include <vector>
+#include <string>
+#include "SeqStack.hpp"
+
+// Compares the growable SeqStack against std::stack backed by std::vector.
+// Each round pushes n elements and pops them all, starting from a small stack
+// so that the cost of geometric reallocation is included.
+// Usage: ./SeqStackBenchmark [maxExponent]   (default 8, i.e. up to 10^8 ops)
+
+typedef std::chrono::steady_clock Clock;
+
+static double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+template<typename T, typename Make>
+double benchSeqStack(long long n, Make make) {
+    Clock::time_point start = Clock::now();
+    SeqStack<T> stack(16, true);
+    for (long long i = 0; i < n; ++i) {
+        stack.push(make(i));
+    }
+    T value;
+    long long checksum = 0;
+    while (stack.pop(value)) {
+        ++checksum;
+    }
+    double ms = elapsedMs(start);
+    if (checksum != n) {
+        std::cerr << "SeqStack checksum mismatch" << std::endl;
+    }
+    return ms;
+}
+
+template<typename T, typename Make>
+double benchStdStack(long long n, Make make) {
+    Clock::time_point start = Clock::now();
+    std::stack<T, std::vector<T>> stack;
+    for (long long i = 0; i < n; ++i) {
+        stack.push(make(i));
+    }
+    T value;
+    long long checksum = 0;
+    while (!stack.empty()) {
+        value = std::move(stack.top());
+        stack.pop();
+        ++checksum;
+    }
+    (void)value;
+    double ms = elapsedMs(start);
+    if (checksum != n) {
+        std::cerr << "std::stack checksum mismatch" << std::endl;
+    }
+    return ms;
+}
+
+struct MakeInt {
+    int operator()(long long i) const { return static_cast<int>(i); }
+};
+
+struct MakeString {
+    std::string operator()(long long i) const { return std::string(24, static_cast<char>('a' + i % 26)); }
+};
+
+template<typename T, typename Make>
+void runSuite(const char* name, int maxExp, int maxExpForType) {
+    std::cout << "\n== " << name << " ==" << std::endl;
+    std::cout << std::setw(12) << "ops"
+              << std::setw(16) << "SeqStack(ms)"
+              << std::setw(16) << "std::stack(ms)"
+              << std::setw(10) << "ratio" << std::endl;
+    long long n = 1000;
+    for (int e = 3; e <= maxExp && e <= maxExpForType; ++e, n *= 10) {
+        // Best of three runs to smooth out allocator warm-up
+        double a = 1e300, b = 1e300;
+        for (int r = 0; r < 3; ++r) {
+            a = std::min(a, benchSeqStack<T>(n, Make()));
+            b = std::min(b, benchStdStack<T>(n, Make()));
+        }
+        std::cout << std::setw(12) << n
+                  << std::setw(16) << std::fixed << std::setprecision(3) << a
+                  << std::setw(16) << b
+                  << std::setw(10) << std::setprecision(2) << (b > 0 ? a / b : 0) << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int maxExp = argc > 1 ? std::atoi(argv[1]) : 8;
+    runSuite<int, MakeInt>("int", maxExp, 8);
+    // Strings are heavier, cap at 10^7 to keep memory reasonable
+    runSuite<std::string, MakeString>("std::string (24 chars)", maxExp, 7);
+    return 0;
+}
@@ -1,6 +1,7 @@
 #include <iostream>
 #include <cassert>
 #include <string>
+#include <utility>
 #include "SeqStack.hpp"
 
 void testEmptyStack() {
@@ -129,6 +130,143 @@ void testDifferentTypes() {
     std::cout << "Different types tests passed!" << std::endl;
 }
 
+// Counts constructions so tests can verify storage is not default-initialized
+struct Tracked {
+    static int defaultCtor;
+    static int copyCtor;
+    static int moveCtor;
+    int value;
+
+    Tracked() : value(0) { ++defaultCtor; }
+    explicit Tracked(int v) : value(v) {}
+    Tracked(const Tracked& other) : value(other.value) { ++copyCtor; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { ++moveCtor; }
+    Tracked& operator=(const Tracked& other) { value = other.value; return *this; }
+    Tracked& operator=(Tracked&& other) noexcept { value = other.value; return *this; }
+
+    static void reset() { defaultCtor = copyCtor = moveCtor = 0; }
+};
+int Tracked::defaultCtor = 0;
+int Tracked::copyCtor = 0;
+int Tracked::moveCtor = 0;
+
+void testGrowable() {
+    std::cout << "Testing growable stack..." << std::endl;
+    SeqStack<int> stack(2, true);
+    assert(stack.isGrowable() == true);
+
+    // Push beyond the initial capacity
+    for (int i = 0; i < 100; i++) {
+        assert(stack.push(i) == true);
+    }
+    assert(stack.size() == 100);
+    assert(stack.capacity() >= 100);
+
+    // Capacity doubles, so it stays a power-of-two multiple of the initial size
+    assert(stack.capacity() == 128);
+
+    int value;
+    for (int i = 99; i >= 0; i--) {
+        assert(stack.pop(value) == true);
+        assert(value == i);
+    }
+    assert(stack.empty() == true);
+
+    // Pushing an element of the stack itself must survive reallocation
+    SeqStack<std::string> strStack(1, true);
+    strStack.push("self");
+    std::string top;
+    strStack.getTop(top);
+    assert(strStack.push(top) == true);
+    assert(strStack.size() == 2);
+
+    // Fixed stack can be switched to growable mode
+    SeqStack<int> fixed(1);
+    assert(fixed.push(1) == true);
+    assert(fixed.push(2) == false);
+    fixed.setGrowable(true);
+    assert(fixed.push(2) == true);
+    assert(fixed.capacity() == 2);
+    std::cout << "Growable stack tests passed!" << std::endl;
+}
+
+void testEmplaceAndMove() {
+    std::cout << "Testing emplace and move operations..." << std::endl;
+    Tracked::reset();
+    SeqStack<Tracked> stack(4, true);
+    // Storage is raw, no element is default-constructed up front
+    assert(Tracked::defaultCtor == 0);
+
+    assert(stack.emplace(1) == true);
+    assert(stack.push(Tracked(2)) == true);
+    assert(Tracked::copyCtor == 0);
+    assert(Tracked::moveCtor == 1);
+
+    // Growth relocates by move construction
+    Tracked::reset();
+    for (int i = 3; i <= 5; i++) {
+        stack.emplace(i);
+    }
+    assert(Tracked::copyCtor == 0);
+    assert(Tracked::defaultCtor == 0);
+    assert(Tracked::moveCtor == 4);  // Four elements relocated when growing from 4 to 8
+
+    // Emplace with multiple constructor arguments
+    SeqStack<std::pair<int, std::string>> pairStack(1, true);
+    assert(pairStack.emplace(1, "one") == true);
+    assert(pairStack.emplace(2, "two") == true);
+    std::pair<int, std::string> p;
+    assert(pairStack.pop(p) == true);
+    assert(p.first == 2 && p.second == "two");
+
+    // Move constructor and move assignment
+    SeqStack<int> src(3);
+    src.push(7);
+    SeqStack<int> moved(std::move(src));
+    int value;
+    assert(moved.getTop(value) == true && value == 7);
+    assert(src.empty() == true);
+    SeqStack<int> assigned;
+    assigned = std::move(moved);
+    assert(assigned.getTop(value) == true && value == 7);
+    std::cout << "Emplace and move tests passed!" << std::endl;
+}
+
+void testReserveAndShrink() {
+    std::cout << "Testing reserve and shrink_to_fit..." << std::endl;
+    SeqStack<std::string> stack(2);
+    stack.push("a");
+    stack.push("b");
+    assert(stack.push("c") == false);
+
+    stack.reserve(10);
+    assert(stack.capacity() == 10);
+    assert(stack.push("c") == true);
+
+    // reserve never shrinks
+    stack.reserve(5);
+    assert(stack.capacity() == 10);
+
+    stack.shrink_to_fit();
+    assert(stack.capacity() == 3);
+    assert(stack.full() == true);
+
+    std::string value;
+    assert(stack.pop(value) == true && value == "c");
+    assert(stack.pop(value) == true && value == "b");
+    assert(stack.pop(value) == true && value == "a");
+    stack.shrink_to_fit();
+    assert(stack.capacity() == 1);
+
+    try {
+        SeqStack<int> invalid(0);
+        assert(false);  // Should not reach here
+    } catch (const std::invalid_argument& e) {
+        // Expected exception
+    }
+    std::cout << "Reserve and shrink_to_fit tests passed!" << std::endl;
+}
+
 int main() {
     std::cout << "Starting SeqStack tests..." << std::endl;
     
@@ -138,6 +276,9 @@ int main() {
     testCopyConstructor();
     testAssignmentOperator();
     testDifferentTypes();
+    testGrowable();
+    testEmplaceAndMove();
+    testReserveAndShrink();
     
     std::cout << "All tests passed successfully!" << std::endl;
     return 0;